@@ -206,11 +206,19 @@ else
     OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_I2C
     QUANTUM_LIB_SRC += i2c_master.c
     SRC += eeprom_driver.c eeprom_i2c.c
+    ifeq ($(strip $(EEPROM_CACHE_ENABLE)), yes)
+      OPT_DEFS += -DEEPROM_CACHE
+      SRC += eeprom_cache.c
+    endif
   else ifeq ($(strip $(EEPROM_DRIVER)), spi)
     # External SPI EEPROM implementation
     OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_SPI
     QUANTUM_LIB_SRC += spi_master.c
     SRC += eeprom_driver.c eeprom_spi.c
+    ifeq ($(strip $(EEPROM_CACHE_ENABLE)), yes)
+      OPT_DEFS += -DEEPROM_CACHE
+      SRC += eeprom_cache.c
+    endif
   else ifeq ($(strip $(EEPROM_DRIVER)), legacy_stm32_flash)
     # STM32 Emulated EEPROM, backed by MCU flash (soon to be deprecated)
     OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_LEGACY_EMULATED_FLASH
@@ -820,6 +828,11 @@ ifeq ($(strip $(SEND_STRING_ENABLE)), yes)
     OPT_DEFS += -DSEND_STRING_ENABLE
     COMMON_VPATH += $(QUANTUM_DIR)/send_string
     SRC += $(QUANTUM_DIR)/send_string/send_string.c
+
+    ifeq ($(strip $(SEND_STRING_ASYNC_ENABLE)), yes)
+        OPT_DEFS += -DSEND_STRING_ASYNC_ENABLE
+        SRC += $(QUANTUM_DIR)/send_string/send_string_async.c
+    endif
 endif
 
 ifeq ($(strip $(AUTO_SHIFT_ENABLE)), yes)
@@ -0,0 +1,171 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <stdint.h>
+#include <string.h>
+
+#include "util.h"
+#include "timer.h"
+#include "eeprom_driver.h"
+#include "eeprom_cache.h"
+
+/*
+    Write-back RAM cache in front of an external EEPROM chip.
+
+    The first EEPROM_CACHE_SIZE bytes of the EEPROM are mirrored in RAM, a page
+    at a time. Each page is read from the chip the first time any part of it is
+    accessed, and reads are served from RAM from then on. Writes only modify
+    RAM, marking the page dirty; eeprom_driver_task() writes back one dirty page
+    at a time, once the chip has completed its previous write cycle, so nothing
+    waits on the chip's write cycle time. eeprom_driver_flush() writes back
+    everything still dirty, and is called before a reset or suspend.
+*/
+
+#define EEPROM_CACHE_PAGE_COUNT ((EEPROM_CACHE_SIZE) / (EXTERNAL_EEPROM_PAGE_SIZE))
+
+_Static_assert((EEPROM_CACHE_SIZE) % (EXTERNAL_EEPROM_PAGE_SIZE) == 0, "EEPROM cache size must be a multiple of the EEPROM page size");
+_Static_assert((EEPROM_CACHE_SIZE) <= (EXTERNAL_EEPROM_BYTE_COUNT), "EEPROM cache size must not exceed the EEPROM size");
+
+static struct {
+    __attribute__((aligned(4))) uint8_t data[(EEPROM_CACHE_SIZE)];
+    uint8_t                             valid[((EEPROM_CACHE_PAGE_COUNT) + 7) / 8]; // page has been read from the chip
+    uint8_t                             dirty[((EEPROM_CACHE_PAGE_COUNT) + 7) / 8]; // page needs writing back to the chip
+    uint16_t                            dirty_count;
+    uint16_t                            next_page; // where to start looking for the next dirty page
+} eeprom_cache;
+
+static inline bool page_flag(const uint8_t *flags, uint16_t page) {
+    return (flags[page / 8] & (1 << (page % 8))) != 0;
+}
+
+static inline void set_page_flag(uint8_t *flags, uint16_t page, bool value) {
+    if (value) {
+        flags[page / 8] |= (1 << (page % 8));
+    } else {
+        flags[page / 8] &= ~(1 << (page % 8));
+    }
+}
+
+/**
+ * Waits for the chip to complete any write cycle in progress.
+ */
+static void eeprom_cache_wait(void) {
+    uint32_t deadline = timer_read32() + (EEPROM_CACHE_TIMEOUT);
+    while (eeprom_backing_busy() && !timer_expired32(timer_read32(), deadline)) {
+    }
+}
+
+/**
+ * Reads the page from the chip, unless it's already been read.
+ */
+static void eeprom_cache_load(uint16_t page) {
+    if (page_flag(eeprom_cache.valid, page)) {
+        return;
+    }
+
+    eeprom_cache_wait();
+    eeprom_backing_read_block(&eeprom_cache.data[page * (EXTERNAL_EEPROM_PAGE_SIZE)], (const void *)(uintptr_t)(page * (EXTERNAL_EEPROM_PAGE_SIZE)), EXTERNAL_EEPROM_PAGE_SIZE);
+    set_page_flag(eeprom_cache.valid, page, true);
+}
+
+/**
+ * Writes back the next dirty page, without waiting for the chip to complete its write cycle.
+ */
+static void eeprom_cache_write_back(void) {
+    uint16_t page = eeprom_cache.next_page;
+    while (!page_flag(eeprom_cache.dirty, page)) {
+        page = (page + 1) % (EEPROM_CACHE_PAGE_COUNT);
+    }
+
+    eeprom_backing_write_page(&eeprom_cache.data[page * (EXTERNAL_EEPROM_PAGE_SIZE)], (void *)(uintptr_t)(page * (EXTERNAL_EEPROM_PAGE_SIZE)), EXTERNAL_EEPROM_PAGE_SIZE);
+    set_page_flag(eeprom_cache.dirty, page, false);
+    --eeprom_cache.dirty_count;
+    eeprom_cache.next_page = (page + 1) % (EEPROM_CACHE_PAGE_COUNT);
+}
+
+void eeprom_driver_init(void) {
+    memset(&eeprom_cache, 0, sizeof(eeprom_cache));
+    eeprom_backing_init();
+}
+
+void eeprom_driver_erase(void) {
+    eeprom_cache_wait();
+    eeprom_backing_erase();
+
+    // The chip now matches a blank cache
+    memset(&eeprom_cache, 0, sizeof(eeprom_cache));
+    memset(eeprom_cache.valid, 0xFF, sizeof(eeprom_cache.valid));
+}
+
+void eeprom_driver_task(void) {
+    if (eeprom_cache.dirty_count == 0 || eeprom_backing_busy()) {
+        return;
+    }
+
+    eeprom_cache_write_back();
+}
+
+void eeprom_driver_flush(void) {
+    while (eeprom_cache.dirty_count > 0) {
+        eeprom_cache_wait();
+        eeprom_cache_write_back();
+    }
+    eeprom_cache_wait();
+}
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    uintptr_t offset = (uintptr_t)addr;
+    uint8_t * out    = (uint8_t *)buf;
+
+    while (len > 0 && offset < (EEPROM_CACHE_SIZE)) {
+        uint16_t page  = offset / (EXTERNAL_EEPROM_PAGE_SIZE);
+        size_t   count = MIN(len, (page + 1) * (EXTERNAL_EEPROM_PAGE_SIZE) - offset);
+
+        eeprom_cache_load(page);
+        memcpy(out, &eeprom_cache.data[offset], count);
+
+        out += count;
+        offset += count;
+        len -= count;
+    }
+
+    if (len > 0) {
+        eeprom_cache_wait();
+        eeprom_backing_read_block(out, (const void *)offset, len);
+    }
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    uintptr_t      offset = (uintptr_t)addr;
+    const uint8_t *in     = (const uint8_t *)buf;
+
+    while (len > 0 && offset < (EEPROM_CACHE_SIZE)) {
+        uint16_t page  = offset / (EXTERNAL_EEPROM_PAGE_SIZE);
+        size_t   count = MIN(len, (page + 1) * (EXTERNAL_EEPROM_PAGE_SIZE) - offset);
+
+        bool changed = true;
+        if (count == (EXTERNAL_EEPROM_PAGE_SIZE) && !page_flag(eeprom_cache.valid, page)) {
+            // Overwriting a whole page doesn't need its previous contents
+            set_page_flag(eeprom_cache.valid, page, true);
+        } else {
+            eeprom_cache_load(page);
+            changed = memcmp(&eeprom_cache.data[offset], in, count) != 0;
+        }
+
+        if (changed) {
+            memcpy(&eeprom_cache.data[offset], in, count);
+            if (!page_flag(eeprom_cache.dirty, page)) {
+                set_page_flag(eeprom_cache.dirty, page, true);
+                ++eeprom_cache.dirty_count;
+            }
+        }
+
+        in += count;
+        offset += count;
+        len -= count;
+    }
+
+    if (len > 0) {
+        eeprom_cache_wait();
+        eeprom_backing_write_block(in, (void *)offset, len);
+    }
+}
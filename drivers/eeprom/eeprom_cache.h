@@ -0,0 +1,57 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+    The number of bytes, from the start of the EEPROM, held in RAM. Accesses
+    beyond this go straight to the EEPROM chip. Must be a multiple of the page
+    size of the EEPROM.
+
+    Every byte cached costs a byte of RAM, so by default only enough for
+    eeconfig and the start of the dynamic keymap is kept: 128 bytes on AVR and
+    1024 bytes elsewhere, rounded up to whole pages.
+*/
+#ifndef EEPROM_CACHE_SIZE
+#    if defined(__AVR__)
+#        define EEPROM_CACHE_DEFAULT_SIZE 128
+#    else
+#        define EEPROM_CACHE_DEFAULT_SIZE 1024
+#    endif
+#    if (EXTERNAL_EEPROM_BYTE_COUNT) > (EEPROM_CACHE_DEFAULT_SIZE)
+#        define EEPROM_CACHE_SIZE (((EEPROM_CACHE_DEFAULT_SIZE) + (EXTERNAL_EEPROM_PAGE_SIZE)-1) / (EXTERNAL_EEPROM_PAGE_SIZE) * (EXTERNAL_EEPROM_PAGE_SIZE))
+#    else
+#        define EEPROM_CACHE_SIZE (EXTERNAL_EEPROM_BYTE_COUNT)
+#    endif
+#endif
+
+/*
+    The maximum time in milliseconds to wait for the EEPROM chip to finish a
+    write cycle before accessing it again.
+*/
+#ifndef EEPROM_CACHE_TIMEOUT
+#    define EEPROM_CACHE_TIMEOUT 100
+#endif
+
+/*
+    Entry points of the EEPROM chip driver. With the cache enabled, the chip
+    driver's eeprom_driver_init(), eeprom_driver_erase(), eeprom_read_block()
+    and eeprom_write_block() are renamed to these, and only called by the cache.
+*/
+void eeprom_backing_init(void);
+void eeprom_backing_erase(void);
+void eeprom_backing_read_block(void *buf, const void *addr, size_t len);
+void eeprom_backing_write_block(const void *buf, void *addr, size_t len);
+
+/*
+    Writes a single page, or part of one, returning without waiting for the
+    EEPROM chip to complete its write cycle.
+*/
+void eeprom_backing_write_page(const void *buf, void *addr, size_t len);
+
+/*
+    Whether the EEPROM chip is still completing a write cycle.
+*/
+bool eeprom_backing_busy(void);
@@ -20,3 +20,5 @@
 
 void eeprom_driver_init(void);
 void eeprom_driver_erase(void);
+void eeprom_driver_task(void);  // weak implementation already provided, drivers which defer writes can progress them here
+void eeprom_driver_flush(void); // weak implementation already provided, drivers which defer writes must complete them all here
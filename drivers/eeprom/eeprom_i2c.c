@@ -38,10 +38,21 @@
 #include "eeprom.h"
 #include "eeprom_i2c.h"
 
+#if defined(EEPROM_CACHE)
+// The RAM cache sits in front of this driver, and calls it through these instead
+#    include "eeprom_cache.h"
+#    define eeprom_driver_init eeprom_backing_init
+#    define eeprom_driver_erase eeprom_backing_erase
+#    define eeprom_read_block eeprom_backing_read_block
+#    define eeprom_write_block eeprom_backing_write_block
+#endif // EEPROM_CACHE
+
 // #define DEBUG_EEPROM_OUTPUT
 
-#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
+#if (defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)) || defined(EEPROM_CACHE)
 #    include "timer.h"
+#endif
+#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
 #    include "debug.h"
 #endif // DEBUG_EEPROM_OUTPUT
 
@@ -53,6 +64,25 @@ static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     }
 }
 
+static void i2c_eeprom_write_page(uint8_t device_address, uintptr_t target_addr, const uint8_t *buf, size_t len) {
+    uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + EXTERNAL_EEPROM_PAGE_SIZE];
+
+    fill_target_address(complete_packet, (const void *)target_addr);
+    for (uint8_t i = 0; i < len; i++) {
+        complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + i] = buf[i];
+    }
+
+#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
+    dprintf("[EEPROM W] 0x%04X: ", ((int)target_addr));
+    for (uint8_t i = 0; i < len; i++) {
+        dprintf(" %02X", (int)(buf[i]));
+    }
+    dprintf("\n");
+#endif // DEBUG_EEPROM_OUTPUT
+
+    i2c_transmit(device_address, complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + len, 100);
+}
+
 void eeprom_driver_init(void) {
     i2c_init();
 #if defined(EXTERNAL_EEPROM_WP_PIN)
@@ -95,7 +125,6 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 }
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
-    uint8_t   complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + EXTERNAL_EEPROM_PAGE_SIZE];
     uint8_t * read_buf    = (uint8_t *)buf;
     uintptr_t target_addr = (uintptr_t)addr;
 
@@ -111,20 +140,7 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
             write_length = len;
         }
 
-        fill_target_address(complete_packet, (const void *)target_addr);
-        for (uint8_t i = 0; i < write_length; i++) {
-            complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + i] = read_buf[i];
-        }
-
-#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-        dprintf("[EEPROM W] 0x%04X: ", ((int)target_addr));
-        for (uint8_t i = 0; i < write_length; i++) {
-            dprintf(" %02X", (int)(read_buf[i]));
-        }
-        dprintf("\n");
-#endif // DEBUG_EEPROM_OUTPUT
-
-        i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + write_length, 100);
+        i2c_eeprom_write_page(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), target_addr, read_buf, write_length);
         wait_ms(EXTERNAL_EEPROM_WRITE_TIME);
 
         read_buf += write_length;
@@ -138,3 +154,34 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     setPinInputHigh(EXTERNAL_EEPROM_WP_PIN);
 #endif
 }
+
+#if defined(EEPROM_CACHE)
+static bool     write_pending = false;
+static uint16_t last_write    = 0;
+
+void eeprom_backing_write_page(const void *buf, void *addr, size_t len) {
+#    if defined(EXTERNAL_EEPROM_WP_PIN)
+    setPinOutput(EXTERNAL_EEPROM_WP_PIN);
+    writePin(EXTERNAL_EEPROM_WP_PIN, 0);
+#    endif
+
+    i2c_eeprom_write_page(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), (uintptr_t)addr, (const uint8_t *)buf, len);
+    write_pending = true;
+    last_write    = timer_read();
+
+#    if defined(EXTERNAL_EEPROM_WP_PIN)
+    /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
+    writePin(EXTERNAL_EEPROM_WP_PIN, 1);
+    setPinInputHigh(EXTERNAL_EEPROM_WP_PIN);
+#    endif
+}
+
+bool eeprom_backing_busy(void) {
+    // There's no status register to poll, so go by the write cycle time in the datasheet
+    if (write_pending && timer_elapsed(last_write) <= EXTERNAL_EEPROM_WRITE_TIME) {
+        return true;
+    }
+    write_pending = false;
+    return false;
+}
+#endif // EEPROM_CACHE
@@ -37,6 +37,15 @@
 #include "eeprom.h"
 #include "eeprom_spi.h"
 
+#if defined(EEPROM_CACHE)
+// The RAM cache sits in front of this driver, and calls it through these instead
+#    include "eeprom_cache.h"
+#    define eeprom_driver_init eeprom_backing_init
+#    define eeprom_driver_erase eeprom_backing_erase
+#    define eeprom_read_block eeprom_backing_read_block
+#    define eeprom_write_block eeprom_backing_write_block
+#endif // EEPROM_CACHE
+
 #define CMD_WREN 6
 #define CMD_WRDI 4
 #define CMD_RDSR 5
@@ -215,3 +224,23 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     spi_write(CMD_WRDI);
     spi_stop();
 }
+
+#if defined(EEPROM_CACHE)
+void eeprom_backing_write_page(const void *buf, void *addr, size_t len) {
+    // Writing doesn't wait for the write cycle to complete, only for the previous one before starting
+    eeprom_backing_write_block(buf, addr, len);
+}
+
+bool eeprom_backing_busy(void) {
+    // Another device holding the bus is treated the same as the EEPROM being busy
+    if (!spi_eeprom_start()) {
+        return true;
+    }
+
+    spi_write(CMD_RDSR);
+    spi_status_t response = spi_read();
+    spi_stop();
+
+    return (response & SR_WIP) != 0;
+}
+#endif // EEPROM_CACHE
@@ -14,6 +14,10 @@ void eeprom_driver_erase(void) {
     wear_leveling_erase();
 }
 
+void eeprom_driver_flush(void) {
+    wear_leveling_flush();
+}
+
 void eeprom_read_block(void *buf, const void *addr, size_t len) {
     wear_leveling_read((uint32_t)addr, buf, len);
 }
@@ -21,3 +25,11 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
     wear_leveling_write((uint32_t)addr, buf, len);
 }
+
+void eeprom_transaction_begin(void) {
+    wear_leveling_begin();
+}
+
+void eeprom_transaction_commit(void) {
+    wear_leveling_commit();
+}
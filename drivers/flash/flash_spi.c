@@ -24,13 +24,6 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "flash_spi.h"
 #include "spi_master.h"
 
-/*
-    The time-out time of spi flash transmission.
-*/
-#ifndef EXTERNAL_FLASH_SPI_TIMEOUT
-#    define EXTERNAL_FLASH_SPI_TIMEOUT 1000
-#endif
-
 /* ID comands */
 #define FLASH_CMD_RDID 0x9F /* RDID (Read Identification) */
 #define FLASH_CMD_RES 0xAB  /* RES (Read Electronic ID) */
@@ -69,8 +62,8 @@ static bool spi_flash_start(void) {
     return spi_start(EXTERNAL_FLASH_SPI_SLAVE_SELECT_PIN, EXTERNAL_FLASH_SPI_LSBFIRST, EXTERNAL_FLASH_SPI_MODE, EXTERNAL_FLASH_SPI_CLOCK_DIVISOR);
 }
 
-static flash_status_t spi_flash_wait_while_busy(void) {
-    uint32_t       deadline = timer_read32() + EXTERNAL_FLASH_SPI_TIMEOUT;
+static flash_status_t spi_flash_wait_while_busy(uint32_t timeout) {
+    uint32_t       deadline = timer_read32() + timeout;
     flash_status_t response = FLASH_STATUS_SUCCESS;
     uint8_t        retval;
 
@@ -170,7 +163,7 @@ flash_status_t flash_erase_chip(void) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
 
     /* Wait for the write-in-progress bit to be cleared. */
-    response = spi_flash_wait_while_busy();
+    response = spi_flash_wait_while_busy(EXTERNAL_FLASH_SPI_TIMEOUT);
     if (response != FLASH_STATUS_SUCCESS) {
         dprint("Failed to check WIP flag! [spi flash erase chip]\n");
         return response;
@@ -193,7 +186,7 @@ flash_status_t flash_erase_chip(void) {
     spi_stop();
 
     /* Wait for the write-in-progress bit to be cleared.*/
-    response = spi_flash_wait_while_busy();
+    response = spi_flash_wait_while_busy(EXTERNAL_FLASH_SPI_TIMEOUT);
     if (response != FLASH_STATUS_SUCCESS) {
         dprint("Failed to check WIP flag! [spi flash erase chip]\n");
         return response;
@@ -205,35 +198,21 @@ flash_status_t flash_erase_chip(void) {
 flash_status_t flash_erase_sector(uint32_t addr) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
 
-    /* Check that the address exceeds the limit. */
-    if ((addr + (EXTERNAL_FLASH_SECTOR_SIZE)) >= (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_SECTOR_SIZE)) != 0)) {
-        dprintf("Flash erase sector address over limit! [addr:0x%lx]\n", (uint32_t)addr);
-        return FLASH_STATUS_ERROR;
-    }
-
     /* Wait for the write-in-progress bit to be cleared. */
-    response = spi_flash_wait_while_busy();
+    response = spi_flash_wait_while_busy(EXTERNAL_FLASH_SPI_TIMEOUT);
     if (response != FLASH_STATUS_SUCCESS) {
         dprint("Failed to check WIP flag! [spi flash erase sector]\n");
         return response;
     }
 
-    /* Enable writes. */
-    response = spi_flash_write_enable();
-    if (response != FLASH_STATUS_SUCCESS) {
-        dprint("Failed to write-enable! [spi flash erase sector]\n");
-        return response;
-    }
-
     /* Erase Sector. */
-    response = spi_flash_transaction(FLASH_CMD_SE, addr, NULL, 0);
+    response = flash_begin_erase_sector(addr);
     if (response != FLASH_STATUS_SUCCESS) {
-        dprint("Failed to erase sector! [spi flash erase sector]\n");
         return response;
     }
 
     /* Wait for the write-in-progress bit to be cleared.*/
-    response = spi_flash_wait_while_busy();
+    response = spi_flash_wait_while_busy(EXTERNAL_FLASH_ERASE_TIMEOUT);
     if (response != FLASH_STATUS_SUCCESS) {
         dprint("Failed to check WIP flag! [spi flash erase sector]\n");
         return response;
@@ -245,35 +224,21 @@ flash_status_t flash_erase_sector(uint32_t addr) {
 flash_status_t flash_erase_block(uint32_t addr) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
 
-    /* Check that the address exceeds the limit. */
-    if ((addr + (EXTERNAL_FLASH_BLOCK_SIZE)) >= (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_BLOCK_SIZE)) != 0)) {
-        dprintf("Flash erase block address over limit! [addr:0x%lx]\n", (uint32_t)addr);
-        return FLASH_STATUS_ERROR;
-    }
-
     /* Wait for the write-in-progress bit to be cleared. */
-    response = spi_flash_wait_while_busy();
+    response = spi_flash_wait_while_busy(EXTERNAL_FLASH_SPI_TIMEOUT);
     if (response != FLASH_STATUS_SUCCESS) {
         dprint("Failed to check WIP flag! [spi flash erase block]\n");
         return response;
     }
 
-    /* Enable writes. */
-    response = spi_flash_write_enable();
-    if (response != FLASH_STATUS_SUCCESS) {
-        dprint("Failed to write-enable! [spi flash erase block]\n");
-        return response;
-    }
-
     /* Erase Block. */
-    response = spi_flash_transaction(FLASH_CMD_BE, addr, NULL, 0);
+    response = flash_begin_erase_block(addr);
     if (response != FLASH_STATUS_SUCCESS) {
-        dprint("Failed to erase block! [spi flash erase block]\n");
         return response;
     }
 
     /* Wait for the write-in-progress bit to be cleared.*/
-    response = spi_flash_wait_while_busy();
+    response = spi_flash_wait_while_busy(EXTERNAL_FLASH_ERASE_TIMEOUT);
     if (response != FLASH_STATUS_SUCCESS) {
         dprint("Failed to check WIP flag! [spi flash erase block]\n");
         return response;
@@ -287,7 +252,7 @@ flash_status_t flash_read_block(uint32_t addr, void *buf, size_t len) {
     uint8_t *      read_buf = (uint8_t *)buf;
 
     /* Wait for the write-in-progress bit to be cleared. */
-    response = spi_flash_wait_while_busy();
+    response = spi_flash_wait_while_busy(EXTERNAL_FLASH_SPI_TIMEOUT);
     if (response != FLASH_STATUS_SUCCESS) {
         dprint("Failed to check WIP flag! [spi flash read block]\n");
         memset(read_buf, 0, len);
@@ -325,31 +290,15 @@ flash_status_t flash_write_block(uint32_t addr, const void *buf, size_t len) {
         }
 
         /* Wait for the write-in-progress bit to be cleared. */
-        response = spi_flash_wait_while_busy();
+        response = spi_flash_wait_while_busy(EXTERNAL_FLASH_SPI_TIMEOUT);
         if (response != FLASH_STATUS_SUCCESS) {
             dprint("Failed to check WIP flag! [spi flash write block]\n");
             return response;
         }
 
-        /* Enable writes. */
-        response = spi_flash_write_enable();
-        if (response != FLASH_STATUS_SUCCESS) {
-            dprint("Failed to write-enable! [spi flash write block]\n");
-            return response;
-        }
-
-#if defined(CONSOLE_ENABLE) && defined(DEBUG_FLASH_SPI_OUTPUT)
-        dprintf("[SPI FLASH W] 0x%08lx: ", addr);
-        for (size_t i = 0; i < write_length; i++) {
-            dprintf(" %02X", (int)(uint8_t)(write_buf[i]));
-        }
-        dprintf("\n");
-#endif // DEBUG_FLASH_SPI_OUTPUT
-
         /* Perform the write. */
-        response = spi_flash_transaction(FLASH_CMD_PP, addr, write_buf, write_length);
+        response = flash_begin_write_page(addr, write_buf, write_length);
         if (response != FLASH_STATUS_SUCCESS) {
-            dprint("Failed to write block! [spi flash write block]\n");
             return response;
         }
 
@@ -359,7 +308,7 @@ flash_status_t flash_write_block(uint32_t addr, const void *buf, size_t len) {
     }
 
     /* Wait for the write-in-progress bit to be cleared. */
-    response = spi_flash_wait_while_busy();
+    response = spi_flash_wait_while_busy(EXTERNAL_FLASH_SPI_TIMEOUT);
     if (response != FLASH_STATUS_SUCCESS) {
         dprint("Failed to check WIP flag! [spi flash write block]\n");
         return response;
@@ -374,3 +323,119 @@ flash_status_t flash_write_block(uint32_t addr, const void *buf, size_t len) {
 
     return response;
 }
+
+flash_status_t flash_check_busy(void) {
+    if (!spi_flash_start()) {
+        return FLASH_STATUS_ERROR;
+    }
+
+    spi_write(FLASH_CMD_RDSR);
+
+    uint8_t retval = (uint8_t)spi_read();
+
+    spi_stop();
+
+    return (retval & FLASH_FLAG_WIP) ? FLASH_STATUS_BUSY : FLASH_STATUS_SUCCESS;
+}
+
+flash_status_t flash_begin_erase_sector(uint32_t addr) {
+    flash_status_t response = FLASH_STATUS_SUCCESS;
+
+    /* Check that the address exceeds the limit. */
+    if ((addr + (EXTERNAL_FLASH_SECTOR_SIZE)) >= (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_SECTOR_SIZE)) != 0)) {
+        dprintf("Flash erase sector address over limit! [addr:0x%lx]\n", (uint32_t)addr);
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+
+    response = flash_check_busy();
+    if (response != FLASH_STATUS_SUCCESS) {
+        return response;
+    }
+
+    /* Enable writes. */
+    response = spi_flash_write_enable();
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to write-enable! [spi flash erase sector]\n");
+        return response;
+    }
+
+    /* Erase Sector. */
+    response = spi_flash_transaction(FLASH_CMD_SE, addr, NULL, 0);
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to erase sector! [spi flash erase sector]\n");
+        return response;
+    }
+
+    return response;
+}
+
+flash_status_t flash_begin_erase_block(uint32_t addr) {
+    flash_status_t response = FLASH_STATUS_SUCCESS;
+
+    /* Check that the address exceeds the limit. */
+    if ((addr + (EXTERNAL_FLASH_BLOCK_SIZE)) >= (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_BLOCK_SIZE)) != 0)) {
+        dprintf("Flash erase block address over limit! [addr:0x%lx]\n", (uint32_t)addr);
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+
+    response = flash_check_busy();
+    if (response != FLASH_STATUS_SUCCESS) {
+        return response;
+    }
+
+    /* Enable writes. */
+    response = spi_flash_write_enable();
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to write-enable! [spi flash erase block]\n");
+        return response;
+    }
+
+    /* Erase Block. */
+    response = spi_flash_transaction(FLASH_CMD_BE, addr, NULL, 0);
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to erase block! [spi flash erase block]\n");
+        return response;
+    }
+
+    return response;
+}
+
+flash_status_t flash_begin_write_page(uint32_t addr, const void *buf, size_t len) {
+    flash_status_t response  = FLASH_STATUS_SUCCESS;
+    uint8_t *      write_buf = (uint8_t *)buf;
+
+    /* A single page program wraps around within the page, so it must not cross into the next one. */
+    if (len == 0 || (addr % EXTERNAL_FLASH_PAGE_SIZE) + len > EXTERNAL_FLASH_PAGE_SIZE) {
+        dprintf("Flash write crosses page boundary! [addr:0x%lx len:%d]\n", (uint32_t)addr, (int)len);
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+
+    response = flash_check_busy();
+    if (response != FLASH_STATUS_SUCCESS) {
+        return response;
+    }
+
+    /* Enable writes. */
+    response = spi_flash_write_enable();
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to write-enable! [spi flash write block]\n");
+        return response;
+    }
+
+#if defined(CONSOLE_ENABLE) && defined(DEBUG_FLASH_SPI_OUTPUT)
+    dprintf("[SPI FLASH W] 0x%08lx: ", addr);
+    for (size_t i = 0; i < len; i++) {
+        dprintf(" %02X", (int)(uint8_t)(write_buf[i]));
+    }
+    dprintf("\n");
+#endif // DEBUG_FLASH_SPI_OUTPUT
+
+    /* Perform the write. */
+    response = spi_flash_transaction(FLASH_CMD_PP, addr, write_buf, len);
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to write block! [spi flash write block]\n");
+        return response;
+    }
+
+    return response;
+}
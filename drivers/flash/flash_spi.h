@@ -56,6 +56,21 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define EXTERNAL_FLASH_SPI_LSBFIRST false
 #endif
 
+/*
+    The time-out time of spi flash transmission, in milliseconds.
+*/
+#ifndef EXTERNAL_FLASH_SPI_TIMEOUT
+#    define EXTERNAL_FLASH_SPI_TIMEOUT 1000
+#endif
+
+/*
+    The time-out time of a sector or block erase, in milliseconds. A 64 KB block
+    erase can take around two seconds.
+*/
+#ifndef EXTERNAL_FLASH_ERASE_TIMEOUT
+#    define EXTERNAL_FLASH_ERASE_TIMEOUT 3000
+#endif
+
 /*
     The Flash address size in bytes, as specified in datasheet.
 */
@@ -112,11 +127,14 @@ typedef int16_t flash_status_t;
 #define FLASH_STATUS_ERROR (-1)
 #define FLASH_STATUS_TIMEOUT (-2)
 #define FLASH_STATUS_BAD_ADDRESS (-3)
+#define FLASH_STATUS_BUSY (-4)
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 void flash_init(void);
@@ -131,6 +149,24 @@ flash_status_t flash_read_block(uint32_t addr, void *buf, size_t len);
 
 flash_status_t flash_write_block(uint32_t addr, const void *buf, size_t len);
 
+/*
+    Non-blocking operations, for callers which poll flash_check_busy() from a
+    task instead of waiting for every erase or program to complete. Each starts a
+    single operation and returns as soon as it has been issued, or returns
+    FLASH_STATUS_BUSY without doing anything if the FLASH is still busy.
+
+    flash_check_busy() returns FLASH_STATUS_SUCCESS once the FLASH is idle,
+    FLASH_STATUS_BUSY while an operation is in progress, or FLASH_STATUS_ERROR
+    if the SPI bus could not be acquired, e.g. while another device holds it.
+*/
+flash_status_t flash_check_busy(void);
+
+flash_status_t flash_begin_erase_block(uint32_t addr);
+
+flash_status_t flash_begin_erase_sector(uint32_t addr);
+
+flash_status_t flash_begin_write_page(uint32_t addr, const void *buf, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
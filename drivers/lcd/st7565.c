@@ -81,6 +81,10 @@ uint32_t st7565_timeout;
 #if ST7565_UPDATE_INTERVAL > 0
 uint16_t st7565_update_timeout;
 #endif
+#if defined(ST7565_ASYNC_RENDER)
+// A block is still being clocked out, with the display selected, until a later render sees it complete
+static bool st7565_transfer_pending = false;
+#endif
 
 // Flips the rendering bits for a character at the current cursor position
 static void InvertCharacter(uint8_t *cursor) {
@@ -159,6 +163,16 @@ void st7565_render(void) {
         return;
     }
 
+#if defined(ST7565_ASYNC_RENDER)
+    // Check again on the next call rather than waiting for the previous block to finish sending
+    if (st7565_transfer_pending) {
+        if (spi_transmit_busy()) {
+            return;
+        }
+        st7565_transfer_pending = false;
+    }
+#endif
+
     // Do we have work to do?
     st7565_dirty &= ST7565_ALL_BLOCKS_MASK;
     if (!st7565_dirty) {
@@ -179,16 +193,33 @@ void st7565_render(void) {
         start_column += (132 - ST7565_DISPLAY_WIDTH);
     }
 
+#if defined(ST7565_ASYNC_RENDER)
+    // Turn on display if it is off, before the bus is left busy with the block
+    st7565_on();
+#endif
+
     spi_start(ST7565_SS_PIN, false, 0, ST7565_SPI_CLK_DIVISOR);
 
     st7565_send_cmd(PAM_PAGE_ADDR | start_page);
     st7565_send_cmd(PAM_SETCOLUMN_LSB | ((ST7565_COLUMN_OFFSET + start_column) & 0x0f));
     st7565_send_cmd(PAM_SETCOLUMN_MSB | ((ST7565_COLUMN_OFFSET + start_column) >> 4 & 0x0f));
 
+#if defined(ST7565_ASYNC_RENDER)
+    // Sent from a copy, as the buffer may be written to before the transfer completes
+    static uint8_t transfer_buffer[ST7565_BLOCK_SIZE];
+    memcpy(transfer_buffer, &st7565_buffer[ST7565_BLOCK_SIZE * update_start], ST7565_BLOCK_SIZE);
+    writePinHigh(ST7565_A0_PIN);
+    spi_transmit_async(transfer_buffer, ST7565_BLOCK_SIZE);
+    // Other SPI devices can take the bus over once the transfer completes
+    spi_stop_async();
+    st7565_transfer_pending = true;
+#else
     st7565_send_data(&st7565_buffer[ST7565_BLOCK_SIZE * update_start], ST7565_BLOCK_SIZE);
+    spi_stop();
 
     // Turn on display if it is off
     st7565_on();
+#endif
 
     // Clear dirty flag
     st7565_dirty &= ~((ST7565_BLOCK_TYPE)1 << update_start);
@@ -495,6 +526,7 @@ void st7565_reset(void) {
 }
 
 spi_status_t st7565_send_cmd(uint8_t cmd) {
+    spi_transmit_wait(); // A0 must not change while render data is still being clocked out
     writePinLow(ST7565_A0_PIN);
     return spi_write(cmd);
 }
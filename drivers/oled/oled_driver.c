@@ -27,6 +27,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include OLED_FONT_H
 #include "timer.h"
 #include "print.h"
+#include "debug.h"
 #include <string.h>
 #include "progmem.h"
 #include "wait.h"
@@ -166,6 +167,38 @@ uint32_t oled_scroll_timeout;
 uint16_t oled_update_timeout;
 #endif
 
+// Hash of the data last sent to the display for each block, only valid for blocks flagged in oled_sent.
+// Blocks marked dirty but rewritten with identical content are not transferred again.
+static uint32_t        oled_block_hashes[OLED_BLOCK_COUNT];
+static OLED_BLOCK_TYPE oled_sent = 0;
+
+#if defined(DEBUG_OLED_TRANSFER_RATE)
+static uint32_t oled_transfer_timer      = 0;
+static uint32_t oled_transfer_count      = 0;
+static uint32_t last_oled_transfer_count = 0;
+
+static void oled_transfer_perf_task(void) {
+    uint32_t timer_now = timer_read32();
+    if (TIMER_DIFF_32(timer_now, oled_transfer_timer) >= 1000) {
+#    if defined(CONSOLE_ENABLE)
+        dprintf("oled transfer rate: %lu bytes/s\n", oled_transfer_count);
+#    endif
+        last_oled_transfer_count = oled_transfer_count;
+        oled_transfer_timer      = timer_now;
+        oled_transfer_count      = 0;
+    }
+}
+
+uint32_t oled_get_transfer_rate(void) {
+    return last_oled_transfer_count;
+}
+
+#    define oled_count_transfer(size) (oled_transfer_count += (size))
+#else
+#    define oled_transfer_perf_task()
+#    define oled_count_transfer(size)
+#endif
+
 #if defined(OLED_TRANSPORT_SPI)
 #    ifndef OLED_DC_PIN
 #        error "The OLED driver in SPI needs a D/C pin defined"
@@ -258,6 +291,32 @@ __attribute__((weak)) bool oled_send_data(const uint8_t *data, uint16_t size) {
 #endif
 }
 
+#if defined(OLED_ASYNC_RENDER)
+#    if !defined(OLED_TRANSPORT_I2C)
+#        error "OLED_ASYNC_RENDER requires the I2C transport"
+#    endif
+
+#    if defined(I2C_ASYNC_BUFFER_SIZE)
+// Each block is queued in one transfer, along with the data control byte
+_Static_assert(OLED_BLOCK_SIZE + 1 <= I2C_ASYNC_BUFFER_SIZE, "OLED_BLOCK_SIZE does not fit in I2C_ASYNC_BUFFER_SIZE, increase it for OLED_ASYNC_RENDER");
+#    endif
+
+// Blocks queued by the previous render, marked dirty again if their transfer fails
+static OLED_BLOCK_TYPE oled_async_blocks = 0;
+
+// Render data is copied into the I2C driver's queue, so these return without waiting for the bus
+static bool oled_render_cmd(const uint8_t *data, uint16_t size) {
+    return i2c_transmit_async((OLED_DISPLAY_ADDRESS << 1), data, size, OLED_I2C_TIMEOUT) == I2C_STATUS_SUCCESS;
+}
+
+static bool oled_render_data(const uint8_t *data, uint16_t size) {
+    return i2c_writeReg_async((OLED_DISPLAY_ADDRESS << 1), I2C_DATA, data, size, OLED_I2C_TIMEOUT) == I2C_STATUS_SUCCESS;
+}
+#else
+#    define oled_render_cmd oled_send_cmd
+#    define oled_render_data oled_send_data
+#endif
+
 __attribute__((weak)) void oled_driver_init(void) {
 #if defined(OLED_TRANSPORT_SPI)
     spi_init();
@@ -368,6 +427,7 @@ bool oled_init(oled_rotation_t rotation) {
 #endif
 
     oled_clear();
+    oled_sent        = 0;
     oled_initialized = true;
     oled_active      = true;
     oled_scrolling   = false;
@@ -451,13 +511,58 @@ static void rotate_90(const uint8_t *src, uint8_t *dest) {
     }
 }
 
+static uint32_t oled_hash_block(uint8_t block) {
+    // FNV-1a
+    const uint8_t *data = &oled_buffer[OLED_BLOCK_SIZE * block];
+    uint32_t       hash = 2166136261UL;
+    for (uint16_t i = 0; i < OLED_BLOCK_SIZE; ++i) {
+        hash = (hash ^ data[i]) * 16777619UL;
+    }
+    return hash;
+}
+
+// Clears the dirty flag of any block whose content matches what was last sent to the display
+static void oled_discard_unchanged_blocks(void) {
+    OLED_BLOCK_TYPE candidates = oled_dirty & oled_sent;
+    for (uint8_t block = 0; candidates; ++block) {
+        OLED_BLOCK_TYPE mask = (OLED_BLOCK_TYPE)1 << block;
+        if (candidates & mask) {
+            if (oled_hash_block(block) == oled_block_hashes[block]) {
+                oled_dirty &= ~mask;
+            }
+            candidates &= ~mask;
+        }
+    }
+}
+
 void oled_render(void) {
+#if defined(OLED_ASYNC_RENDER)
+    // Leave the previously queued blocks to finish sending rather than stalling the caller
+    if (i2c_transmit_busy()) {
+        return;
+    }
+    if (oled_async_blocks) {
+        if (i2c_transmit_wait() != I2C_STATUS_SUCCESS) {
+            print("oled_render async transfer failed\n");
+            oled_dirty |= oled_async_blocks;
+            oled_sent &= ~oled_async_blocks;
+        }
+        oled_async_blocks = 0;
+    }
+#endif
+
     // Do we have work to do?
     oled_dirty &= OLED_ALL_BLOCKS_MASK;
     if (!oled_dirty || !oled_initialized || oled_scrolling) {
         return;
     }
 
+    // Rewriting identical content shouldn't cause any transfers, nor wake the display
+    oled_discard_unchanged_blocks();
+    if (!oled_dirty) {
+        return;
+    }
+
     // Turn on display if it is off
     oled_on();
 
@@ -481,18 +586,24 @@ void oled_render(void) {
             calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
         }
 
+        // The block's hash is only trusted once all of its data has been sent
+        oled_block_hashes[update_start] = oled_hash_block(update_start);
+        oled_sent &= ~((OLED_BLOCK_TYPE)1 << update_start);
+
         // Send column & page position
-        if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+        if (!oled_render_cmd(display_start, ARRAY_SIZE(display_start))) {
             print("oled_render offset command failed\n");
             return;
         }
+        oled_count_transfer(ARRAY_SIZE(display_start));
 
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
             // Send render data chunk as is
-            if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
+            if (!oled_render_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
                 print("oled_render data failed\n");
                 return;
             }
+            oled_count_transfer(OLED_BLOCK_SIZE);
         } else {
             // Rotate the render chunks
             const static uint8_t source_map[] = OLED_SOURCE_MAP;
@@ -506,10 +617,11 @@ void oled_render(void) {
 
 #if OLED_IC_HAS_HORIZONTAL_MODE
             // Send render data chunk after rotating
-            if (!oled_send_data(&temp_buffer[0], OLED_BLOCK_SIZE)) {
+            if (!oled_render_data(&temp_buffer[0], OLED_BLOCK_SIZE)) {
                 print("oled_render90 data failed\n");
                 return;
             }
+            oled_count_transfer(OLED_BLOCK_SIZE);
 #else
             // For SH1106 or SH1107 the data chunk must be split into separate pieces for each page
             const uint8_t columns_in_block = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
@@ -518,22 +630,28 @@ void oled_render(void) {
                 // Send column & page position for all pages except the first one
                 if (i > 0) {
                     display_start[1]++;
-                    if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+                    if (!oled_render_cmd(display_start, ARRAY_SIZE(display_start))) {
                         print("oled_render offset command failed\n");
                         return;
                     }
+                    oled_count_transfer(ARRAY_SIZE(display_start));
                 }
                 // Send data for the page
-                if (!oled_send_data(&temp_buffer[columns_in_block * i], columns_in_block)) {
+                if (!oled_render_data(&temp_buffer[columns_in_block * i], columns_in_block)) {
                     print("oled_render90 data failed\n");
                     return;
                 }
+                oled_count_transfer(columns_in_block);
             }
 #endif
         }
 
         // Clear dirty flag of just rendered block
         oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+        oled_sent |= ((OLED_BLOCK_TYPE)1 << update_start);
+#if defined(OLED_ASYNC_RENDER)
+        oled_async_blocks |= ((OLED_BLOCK_TYPE)1 << update_start);
+#endif
     }
 }
 
@@ -883,6 +1001,7 @@ bool oled_scroll_off(void) {
         }
         oled_scrolling = false;
         oled_dirty     = OLED_ALL_BLOCKS_MASK;
+        oled_sent      = 0; // scrolling moved the display's contents
     }
     return !oled_scrolling;
 }
@@ -946,6 +1065,8 @@ void oled_task(void) {
 #endif
 
 #if OLED_SCROLL_TIMEOUT > 0
+    // Only content changes should stop scrolling
+    oled_discard_unchanged_blocks();
     if (oled_dirty && oled_scrolling) {
         oled_scroll_timeout = timer_read32() + OLED_SCROLL_TIMEOUT;
         oled_scroll_off();
@@ -954,6 +1075,7 @@ void oled_task(void) {
 
     // Smart render system, no need to check for dirty
     oled_render();
+    oled_transfer_perf_task();
 
     // Display timeout check
 #if OLED_TIMEOUT > 0
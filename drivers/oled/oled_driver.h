@@ -354,8 +354,14 @@ oled_rotation_t oled_init_user(oled_rotation_t rotation);
 void oled_clear(void);
 
 // Renders the dirty chunks of the buffer to oled display
+// Chunks whose content is identical to what was last sent are skipped
 void oled_render(void);
 
+#ifdef DEBUG_OLED_TRANSFER_RATE
+// Returns the number of bytes oled_render sent to the display over the last second
+uint32_t oled_get_transfer_rate(void);
+#endif
+
 // Moves cursor to character position indicated by column and line, wraps if out of bounds
 // Max column denoted by 'oled_max_chars()' and max lines by 'oled_max_lines()' functions
 void oled_set_cursor(uint8_t col, uint8_t line);
@@ -2,11 +2,20 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 #include "color.h"
 #include "qp_rgb565_surface.h"
+#include "qp_comms.h"
 #include "qp_draw.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Common
 
+// Dirty region, inclusive coordinates
+typedef struct rgb565_surface_dirty_rect_t {
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+} rgb565_surface_dirty_rect_t;
+
 // Device definition
 typedef struct rgb565_surface_painter_device_t {
     painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
@@ -24,12 +33,15 @@ typedef struct rgb565_surface_painter_device_t {
     uint16_t pixdata_x;
     uint16_t pixdata_y;
 
-    // Maintain a dirty region so we can stream only what we need
-    bool     is_dirty;
-    uint16_t dirty_l;
-    uint16_t dirty_t;
-    uint16_t dirty_r;
-    uint16_t dirty_b;
+    // Maintain a list of dirty regions so we can stream only what we need
+    uint8_t                     dirty_count;
+    uint8_t                     dirty_last; // most recently extended region, checked first
+    rgb565_surface_dirty_rect_t dirty[RGB565_SURFACE_NUM_DIRTY_RECTS];
+
+    // Display the surface is composited onto when flushed, if any
+    painter_device_t target;
+    uint16_t         target_x;
+    uint16_t         target_y;
 
 } rgb565_surface_painter_device_t;
 
@@ -55,25 +67,96 @@ static inline void increment_pixdata_location(rgb565_surface_painter_device_t *s
     }
 }
 
-static inline void setpixel(rgb565_surface_painter_device_t *surface, uint16_t x, uint16_t y, uint16_t rgb565) {
-    // Skip messing with the dirty info if the original value already matches
-    if (surface->buffer[y * surface->base.panel_width + x] != rgb565) {
-        // Maintain dirty region
-        if (surface->dirty_l > x) {
-            surface->dirty_l = x;
-        }
-        if (surface->dirty_r < x) {
-            surface->dirty_r = x;
+static inline uint32_t dirty_rect_area(const rgb565_surface_dirty_rect_t *rect) {
+    return ((uint32_t)(rect->r - rect->l + 1)) * (rect->b - rect->t + 1);
+}
+
+static inline void dirty_rect_union(rgb565_surface_dirty_rect_t *out, const rgb565_surface_dirty_rect_t *a, const rgb565_surface_dirty_rect_t *b) {
+    out->l = QP_MIN(a->l, b->l);
+    out->t = QP_MIN(a->t, b->t);
+    out->r = QP_MAX(a->r, b->r);
+    out->b = QP_MAX(a->b, b->b);
+}
+
+// Two regions are combined if the combined region doesn't transfer much more than the two would separately
+static inline bool dirty_rect_should_merge(const rgb565_surface_dirty_rect_t *a, const rgb565_surface_dirty_rect_t *b) {
+    rgb565_surface_dirty_rect_t combined;
+    dirty_rect_union(&combined, a, b);
+    return dirty_rect_area(&combined) <= 2 * (dirty_rect_area(a) + dirty_rect_area(b));
+}
+
+static inline void reset_dirty(rgb565_surface_painter_device_t *surface) {
+    surface->dirty_count = 0;
+    surface->dirty_last  = 0;
+}
+
+// After a region has grown, fold in any other regions it should now be combined with
+static void merge_dirty_rects(rgb565_surface_painter_device_t *surface, uint8_t idx) {
+    uint8_t i = 0;
+    while (i < surface->dirty_count) {
+        if (i != idx && dirty_rect_should_merge(&surface->dirty[idx], &surface->dirty[i])) {
+            dirty_rect_union(&surface->dirty[idx], &surface->dirty[idx], &surface->dirty[i]);
+
+            // Remove the merged region by moving the last one into its slot
+            surface->dirty[i] = surface->dirty[--surface->dirty_count];
+            if (idx == surface->dirty_count) {
+                idx = i;
+            }
+
+            // The grown region may now overlap regions already checked
+            i = 0;
+            continue;
         }
-        if (surface->dirty_t > y) {
-            surface->dirty_t = y;
+        ++i;
+    }
+    surface->dirty_last = idx;
+}
+
+static void mark_dirty_rect(rgb565_surface_painter_device_t *surface, const rgb565_surface_dirty_rect_t *area) {
+    // Most writes land in the same region as the previous one
+    for (uint8_t n = 0; n < surface->dirty_count; ++n) {
+        uint8_t                      i    = (surface->dirty_last + n) % surface->dirty_count;
+        rgb565_surface_dirty_rect_t *rect = &surface->dirty[i];
+        if (area->l >= rect->l && area->r <= rect->r && area->t >= rect->t && area->b <= rect->b) {
+            surface->dirty_last = i;
+            return;
         }
-        if (surface->dirty_b < y) {
-            surface->dirty_b = y;
+    }
+
+    // Find the region that grows the least by including this area
+    uint8_t  best      = 0;
+    uint32_t best_area = UINT32_MAX;
+    for (uint8_t i = 0; i < surface->dirty_count; ++i) {
+        rgb565_surface_dirty_rect_t combined;
+        dirty_rect_union(&combined, &surface->dirty[i], area);
+        uint32_t growth = dirty_rect_area(&combined) - dirty_rect_area(&surface->dirty[i]);
+        if (growth < best_area) {
+            best      = i;
+            best_area = growth;
         }
+    }
+
+    // Start a new region if it's not worth combining, or extend the closest one if we've run out
+    if (surface->dirty_count < RGB565_SURFACE_NUM_DIRTY_RECTS && (surface->dirty_count == 0 || !dirty_rect_should_merge(&surface->dirty[best], area))) {
+        surface->dirty[surface->dirty_count] = *area;
+        surface->dirty_last                  = surface->dirty_count++;
+        return;
+    }
+
+    dirty_rect_union(&surface->dirty[best], &surface->dirty[best], area);
+    merge_dirty_rects(surface, best);
+}
+
+static inline void mark_dirty(rgb565_surface_painter_device_t *surface, uint16_t x, uint16_t y) {
+    rgb565_surface_dirty_rect_t pixel = {.l = x, .t = y, .r = x, .b = y};
+    mark_dirty_rect(surface, &pixel);
+}
 
-        // Always dirty after a setpixel
-        surface->is_dirty = true;
+static inline void setpixel(rgb565_surface_painter_device_t *surface, uint16_t x, uint16_t y, uint16_t rgb565) {
+    // Skip messing with the dirty info if the original value already matches
+    if (surface->buffer[y * surface->base.panel_width + x] != rgb565) {
+        // Maintain dirty regions
+        mark_dirty(surface, x, y);
 
         // Update the pixel data in the buffer
         surface->buffer[y * surface->base.panel_width + x] = rgb565;
@@ -112,13 +195,23 @@ static bool qp_rgb565_surface_clear(painter_device_t device) {
     return true;
 }
 
+static bool qp_rgb565_surface_blit(rgb565_surface_painter_device_t *surface, painter_device_t display, uint16_t x, uint16_t y);
+
 static bool qp_rgb565_surface_flush(painter_device_t device) {
     painter_driver_t *               driver  = (painter_driver_t *)device;
     rgb565_surface_painter_device_t *surface = (rgb565_surface_painter_device_t *)driver;
-    surface->dirty_l = surface->dirty_t = UINT16_MAX;
-    surface->dirty_r = surface->dirty_b = 0;
-    surface->is_dirty                   = false;
-    return true;
+
+    // Without a compositor target, flushing just resets the dirty regions
+    if (!surface->target) {
+        reset_dirty(surface);
+        return true;
+    }
+
+    if (!qp_rgb565_surface_blit(surface, surface->target, surface->target_x, surface->target_y)) {
+        return false;
+    }
+    reset_dirty(surface);
+    return qp_flush(surface->target);
 }
 
 static bool qp_rgb565_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
@@ -170,6 +263,31 @@ static bool qp_rgb565_surface_append_pixdata(painter_device_t device, uint8_t *t
     return true;
 }
 
+// Fill a region directly in the buffer, marking only the pixels that actually changed as dirty
+static bool qp_rgb565_surface_fill(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, qp_pixel_t native_color) {
+    painter_driver_t *               driver  = (painter_driver_t *)device;
+    rgb565_surface_painter_device_t *surface = (rgb565_surface_painter_device_t *)driver;
+
+    rgb565_surface_dirty_rect_t changed = {.l = UINT16_MAX, .t = UINT16_MAX, .r = 0, .b = 0};
+    for (uint16_t y = top; y <= bottom; ++y) {
+        uint16_t *row = &surface->buffer[y * driver->panel_width];
+        for (uint16_t x = left; x <= right; ++x) {
+            if (row[x] != native_color.rgb565) {
+                row[x]    = native_color.rgb565;
+                changed.l = QP_MIN(changed.l, x);
+                changed.r = QP_MAX(changed.r, x);
+                changed.t = QP_MIN(changed.t, y);
+                changed.b = y;
+            }
+        }
+    }
+
+    if (changed.l <= changed.r) {
+        mark_dirty_rect(surface, &changed);
+    }
+    return true;
+}
+
 const painter_driver_vtable_t rgb565_surface_driver_vtable = {
     .init            = qp_rgb565_surface_init,
     .power           = qp_rgb565_surface_power,
@@ -180,6 +298,7 @@ const painter_driver_vtable_t rgb565_surface_driver_vtable = {
     .palette_convert = qp_rgb565_surface_palette_convert_rgb565_swapped,
     .append_pixels   = qp_rgb565_surface_append_pixels_rgb565,
     .append_pixdata  = qp_rgb565_surface_append_pixdata,
+    .fill            = qp_rgb565_surface_fill,
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -224,6 +343,8 @@ painter_device_t qp_rgb565_make_surface(uint16_t panel_width, uint16_t panel_hei
             driver->base.offset_x              = 0;
             driver->base.offset_y              = 0;
             driver->buffer                     = (uint16_t *)buffer;
+            driver->target                     = NULL;
+            reset_dirty(driver);
             return (painter_device_t)driver;
         }
     }
@@ -231,54 +352,84 @@ painter_device_t qp_rgb565_make_surface(uint16_t panel_width, uint16_t panel_hei
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Drawing routine to copy out the dirty region and send it to another device
+// Drawing routines to copy out the dirty regions and send them to another device
 
-bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y) {
-    painter_driver_t *               surface_driver = (painter_driver_t *)surface;
-    rgb565_surface_painter_device_t *surface_handle = (rgb565_surface_painter_device_t *)surface_driver;
+static bool qp_rgb565_surface_blit(rgb565_surface_painter_device_t *surface, painter_device_t display, uint16_t x, uint16_t y) {
+    painter_driver_t *display_driver = (painter_driver_t *)display;
 
-    // If we're not dirty... we're done.
-    if (!surface_handle->is_dirty) {
+    // Nothing to transfer
+    if (surface->dirty_count == 0) {
         return true;
     }
 
-    // Set the target drawing area
-    bool ok = qp_viewport(display, x + surface_handle->dirty_l, y + surface_handle->dirty_t, x + surface_handle->dirty_r, y + surface_handle->dirty_b);
-    if (!ok) {
+    if (!qp_comms_start(display)) {
         return false;
     }
 
     // Housekeeping of the amount of pixels to transfer
-    uint32_t  total_pixel_count = QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE / sizeof(uint16_t);
-    uint32_t  pixel_counter     = 0;
-    uint16_t *target_buffer     = (uint16_t *)qp_internal_global_pixdata_buffer;
-
-    // Fill the global pixdata area so that we can start transferring to the panel
-    for (uint16_t y = surface_handle->dirty_t; y <= surface_handle->dirty_b; ++y) {
-        for (uint16_t x = surface_handle->dirty_l; x <= surface_handle->dirty_r; ++x) {
-            // Update the target buffer
-            target_buffer[pixel_counter++] = surface_handle->buffer[y * surface_handle->base.panel_width + x];
-
-            // If we've accumulated enough data, send it
-            if (pixel_counter == total_pixel_count) {
-                ok = qp_pixdata(display, qp_internal_global_pixdata_buffer, pixel_counter);
-                if (!ok) {
-                    return false;
+    const uint32_t total_pixel_count = QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE / sizeof(uint16_t);
+    bool           ok                = true;
+
+    for (uint8_t i = 0; ok && i < surface->dirty_count; ++i) {
+        const rgb565_surface_dirty_rect_t *rect = &surface->dirty[i];
+
+        // Set the target drawing area
+        ok = display_driver->driver_vtable->viewport(display, x + rect->l, y + rect->t, x + rect->r, y + rect->b);
+
+        // Fill the global pixdata area a row segment at a time, transferring to the panel whenever it fills up
+        uint32_t pixel_counter = 0;
+        for (uint16_t row = rect->t; ok && row <= rect->b; ++row) {
+            const uint16_t *src       = &surface->buffer[row * surface->base.panel_width + rect->l];
+            uint32_t        remaining = rect->r - rect->l + 1;
+            while (ok && remaining > 0) {
+                uint32_t count = QP_MIN(remaining, total_pixel_count - pixel_counter);
+                memcpy(&((uint16_t *)qp_internal_global_pixdata_buffer)[pixel_counter], src, count * sizeof(uint16_t));
+                src += count;
+                remaining -= count;
+                pixel_counter += count;
+
+                // If we've accumulated enough data, send it
+                if (pixel_counter == total_pixel_count) {
+                    ok = display_driver->driver_vtable->pixdata(display, qp_internal_global_pixdata_buffer, pixel_counter);
+                    qp_internal_swap_pixdata_buffer();
+                    pixel_counter = 0;
                 }
-                // Reset the counter
-                pixel_counter = 0;
             }
         }
-    }
 
-    // If there's any leftover data, send it
-    if (pixel_counter > 0) {
-        ok = qp_pixdata(display, qp_internal_global_pixdata_buffer, pixel_counter);
-        if (!ok) {
-            return false;
+        // If there's any leftover data, send it
+        if (ok && pixel_counter > 0) {
+            ok = display_driver->driver_vtable->pixdata(display, qp_internal_global_pixdata_buffer, pixel_counter);
+            qp_internal_swap_pixdata_buffer();
         }
     }
 
+    qp_comms_stop(display);
+    return ok;
+}
+
+bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y) {
+    painter_driver_t *               surface_driver = (painter_driver_t *)surface;
+    rgb565_surface_painter_device_t *surface_handle = (rgb565_surface_painter_device_t *)surface_driver;
+
+    if (!qp_rgb565_surface_blit(surface_handle, display, x, y)) {
+        return false;
+    }
+
     // Clear the dirty info for the surface
-    return qp_flush(surface);
+    reset_dirty(surface_handle);
+    return true;
+}
+
+bool qp_rgb565_surface_set_target(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y) {
+    painter_driver_t *               surface_driver = (painter_driver_t *)surface;
+    rgb565_surface_painter_device_t *surface_handle = (rgb565_surface_painter_device_t *)surface_driver;
+    if (!surface_driver || surface_driver->driver_vtable != &rgb565_surface_driver_vtable) {
+        return false;
+    }
+
+    surface_handle->target   = display;
+    surface_handle->target_x = x;
+    surface_handle->target_y = y;
+    return true;
 }
@@ -13,6 +13,14 @@
 #    define RGB565_SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef RGB565_SURFACE_NUM_DIRTY_RECTS
+/**
+ * @def This controls the maximum number of separate dirty regions tracked per surface. Each region is transferred to
+ *      the display separately, so distant updates don't force the area between them to be sent.
+ */
+#    define RGB565_SURFACE_NUM_DIRTY_RECTS 4
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -39,4 +47,17 @@ painter_device_t qp_rgb565_make_surface(uint16_t panel_width, uint16_t panel_hei
  * @return whether the draw operation completed successfully
  */
 bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y);
+
+/**
+ * Sets the display that the surface is composited onto whenever `qp_flush()` is invoked on the surface.
+ *
+ * Each dirty region is copied to the display, then the display itself is flushed.
+ *
+ * @param surface[in] the surface to copy from
+ * @param display[in] the display to copy into, or NULL to only reset the dirty regions on flush
+ * @param x[in] the x-location of the framebuffer on the display
+ * @param y[in] the y-location of the framebuffer on the display
+ * @return whether the target was set
+ */
+bool qp_rgb565_surface_set_target(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y);
 #endif // QUANTUM_PAINTER_RGB565_SURFACE_ENABLE
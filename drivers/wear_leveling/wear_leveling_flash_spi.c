@@ -1,18 +1,195 @@
 // Copyright 2022 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 #include <stdbool.h>
+#include <string.h>
 #include <hal.h>
 #include "util.h"
 #include "timer.h"
 #include "wear_leveling.h"
 #include "wear_leveling_internal.h"
 
-#ifndef WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT
-#    define WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT 32
-#endif // WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT
+/* Erases and page programs are queued rather than waited upon -- each is issued once the previous one has completed,
+ * with the FLASH's busy status polled from backing_store_task() instead of spinning. Contiguous writes within a page
+ * are coalesced into a single page program. The queue is only waited upon when it is full, or when reading. */
+
+#ifndef WEAR_LEVELING_EXTERNAL_FLASH_QUEUE_SIZE
+#    define WEAR_LEVELING_EXTERNAL_FLASH_QUEUE_SIZE 4
+#endif // WEAR_LEVELING_EXTERNAL_FLASH_QUEUE_SIZE
+
+_Static_assert(WEAR_LEVELING_EXTERNAL_FLASH_QUEUE_SIZE > 0 && WEAR_LEVELING_EXTERNAL_FLASH_QUEUE_SIZE < 256, "External flash queue size must be between 1 and 255");
+_Static_assert((EXTERNAL_FLASH_PAGE_SIZE) % (BACKING_STORE_WRITE_SIZE) == 0, "External flash page size must be a multiple of the write size");
+
+typedef enum flash_op_type_t {
+    FLASH_OP_ERASE_BLOCK,
+    FLASH_OP_ERASE_SECTOR,
+    FLASH_OP_PROGRAM,
+} flash_op_type_t;
+
+typedef struct flash_op_t {
+    flash_op_type_t type;
+    uint32_t        address;
+    uint16_t        length;
+    uint8_t         data[(EXTERNAL_FLASH_PAGE_SIZE)];
+} flash_op_t;
+
+static struct {
+    flash_op_t queue[(WEAR_LEVELING_EXTERNAL_FLASH_QUEUE_SIZE)];
+    uint8_t    head;
+    uint8_t    count;
+    bool       started;  // the operation at the head of the queue has been given its deadline
+    bool       issued;   // the operation at the head of the queue is in progress on the FLASH
+    bool       failed;   // an operation has failed since the last time it was reported
+    uint32_t   deadline; // time by which the operation at the head of the queue should have completed
+} flash_queue;
+
+static flash_op_t *flash_queue_at(uint8_t index) {
+    return &flash_queue.queue[(flash_queue.head + index) % (WEAR_LEVELING_EXTERNAL_FLASH_QUEUE_SIZE)];
+}
+
+static void flash_queue_pop(void) {
+    flash_queue.head = (flash_queue.head + 1) % (WEAR_LEVELING_EXTERNAL_FLASH_QUEUE_SIZE);
+    --flash_queue.count;
+    flash_queue.started = false;
+    flash_queue.issued  = false;
+}
+
+/**
+ * Reports whether any operation has failed since the last time failure was reported.
+ *
+ * @return true if none of the operations failed
+ */
+static bool flash_queue_report(void) {
+    bool ret           = !flash_queue.failed;
+    flash_queue.failed = false;
+    return ret;
+}
+
+/**
+ * Gives up on the operation at the head of the queue if it has run past its deadline.
+ *
+ * @return true if the operation was given up on
+ */
+static bool flash_queue_check_deadline(void) {
+    if (!timer_expired32(timer_read32(), flash_queue.deadline)) {
+        return false;
+    }
+
+    bs_dprintf("Timed out waiting for FLASH\n");
+    flash_queue.failed = true;
+    flash_queue_pop();
+    return true;
+}
+
+/**
+ * Retires the operation in progress if the FLASH has finished with it, then issues the next one. Never waits.
+ *
+ * Each operation has a deadline from when it reaches the head of the queue, covering both waiting for the FLASH or
+ * the SPI bus to become free and the operation itself, so that a FLASH which never becomes ready can't stall the
+ * queue forever.
+ */
+static void flash_queue_poll(void) {
+    if (flash_queue.count == 0) {
+        return;
+    }
+
+    if (flash_queue.issued) {
+        // The bus may be held by another device, so only the deadline decides a failure to read the status
+        if (flash_check_busy() != FLASH_STATUS_SUCCESS) {
+            flash_queue_check_deadline();
+            return;
+        }
+        flash_queue_pop();
+        if (flash_queue.count == 0) {
+            return;
+        }
+    }
+
+    flash_op_t *op = flash_queue_at(0);
+    if (!flash_queue.started) {
+        flash_queue.started  = true;
+        flash_queue.deadline = timer_read32() + (op->type == FLASH_OP_PROGRAM ? (EXTERNAL_FLASH_SPI_TIMEOUT) : (EXTERNAL_FLASH_ERASE_TIMEOUT));
+    }
+
+    flash_status_t status;
+    switch (op->type) {
+        case FLASH_OP_ERASE_BLOCK:
+            status = flash_begin_erase_block(op->address);
+            break;
+        case FLASH_OP_ERASE_SECTOR:
+            status = flash_begin_erase_sector(op->address);
+            break;
+        default:
+            status = flash_begin_write_page(op->address, op->data, op->length);
+            break;
+    }
+
+    if (status == FLASH_STATUS_BUSY || status == FLASH_STATUS_ERROR) {
+        // Still busy, or the bus is held by another device -- try again next time around
+        flash_queue_check_deadline();
+        return;
+    }
+
+    if (status != FLASH_STATUS_SUCCESS) {
+        flash_queue.failed = true;
+        flash_queue_pop();
+        return;
+    }
+
+    flash_queue.issued = true;
+}
+
+/**
+ * Waits for every queued operation to complete.
+ *
+ * @return true if none of the operations failed since the last time failure was reported
+ */
+static bool flash_queue_drain(void) {
+    while (flash_queue.count > 0) {
+        flash_queue_poll();
+    }
+
+    return flash_queue_report();
+}
+
+/**
+ * Adds an operation to the end of the queue, waiting for space if it is full.
+ */
+static flash_op_t *flash_queue_push(flash_op_type_t type, uint32_t address) {
+    while (flash_queue.count == (WEAR_LEVELING_EXTERNAL_FLASH_QUEUE_SIZE)) {
+        flash_queue_poll();
+    }
+
+    flash_op_t *op = flash_queue_at(flash_queue.count++);
+    op->type       = type;
+    op->address    = address;
+    op->length     = 0;
+    return op;
+}
+
+/**
+ * Queues data to be programmed, appending it to the last queued page program if it follows on within the same page.
+ * The data must not cross a page boundary.
+ */
+static void flash_queue_program(uint32_t address, const void *data, size_t length) {
+    flash_op_t *op = NULL;
+    if (flash_queue.count > 0 && !(flash_queue.issued && flash_queue.count == 1)) {
+        flash_op_t *last = flash_queue_at(flash_queue.count - 1);
+        if (last->type == FLASH_OP_PROGRAM && last->address + last->length == address && (address % (EXTERNAL_FLASH_PAGE_SIZE)) != 0) {
+            op = last;
+        }
+    }
+
+    if (!op) {
+        op = flash_queue_push(FLASH_OP_PROGRAM, address);
+    }
+
+    memcpy(&op->data[op->length], data, length);
+    op->length += length;
+}
 
 bool backing_store_init(void) {
     bs_dprintf("Init\n");
+    memset(&flash_queue, 0, sizeof(flash_queue));
     flash_init();
     return true;
 }
@@ -24,30 +201,41 @@ bool backing_store_unlock(void) {
 }
 
 bool backing_store_erase(void) {
-#ifdef WEAR_LEVELING_DEBUG_OUTPUT
-    uint32_t start = timer_read32();
-#endif
-
-    bool ret = true;
     for (int i = 0; i < (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_COUNT); ++i) {
-        flash_status_t status = flash_erase_block(((WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) + i) * (EXTERNAL_FLASH_BLOCK_SIZE));
-        if (status != FLASH_STATUS_SUCCESS) {
-            ret = false;
-            break;
-        }
+        flash_queue_push(FLASH_OP_ERASE_BLOCK, ((WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) + i) * (EXTERNAL_FLASH_BLOCK_SIZE));
     }
 
-    bs_dprintf("Backing store erase took %ldms to complete\n", ((long)(timer_read32() - start)));
-    return ret;
+    bs_dprintf("Backing store erase queued\n");
+    flash_queue_poll();
+    // Failures of the erase itself are reported by the next write or flush
+    return flash_queue_report();
 }
 
+#ifdef WEAR_LEVELING_DUAL_BANK
+bool backing_store_erase_range(uint32_t address, size_t length) {
+    // Only whole sectors can be erased
+    if ((address % (EXTERNAL_FLASH_SECTOR_SIZE)) != 0 || (length % (EXTERNAL_FLASH_SECTOR_SIZE)) != 0) {
+        return false;
+    }
+
+    uint32_t offset = (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE) + address;
+    bs_dprintf("Erase 0x%08lX, %d bytes\n", (unsigned long)offset, (int)length);
+    for (uint32_t i = 0; i < length; i += (EXTERNAL_FLASH_SECTOR_SIZE)) {
+        flash_queue_push(FLASH_OP_ERASE_SECTOR, offset + i);
+    }
+    flash_queue_poll();
+    return flash_queue_report();
+}
+#endif // WEAR_LEVELING_DUAL_BANK
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
 
 bool backing_store_lock(void) {
     bs_dprintf("Lock  \n");
-    // No-op -- handled by the flash driver as it is.
+    // Start on whatever was queued while unlocked
+    flash_queue_poll();
     return true;
 }
 
@@ -56,6 +244,11 @@ bool backing_store_read(uint32_t address, backing_store_int_t *value) {
 }
 
 bool backing_store_read_bulk(uint32_t address, backing_store_int_t *values, size_t item_count) {
+    // Anything still queued may affect what's read back
+    if (!flash_queue_drain()) {
+        return false;
+    }
+
     bs_dprintf("Read  ");
     uint32_t       offset = (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE) + address;
     flash_status_t status = flash_read_block(offset, values, sizeof(backing_store_int_t) * item_count);
@@ -69,33 +262,29 @@ bool backing_store_read_bulk(uint32_t address, backing_store_int_t *values, size
 }
 
 bool backing_store_write_bulk(uint32_t address, backing_store_int_t *values, size_t item_count) {
-    uint32_t            offset = (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE) + address;
-    size_t              index  = 0;
-    backing_store_int_t temp[WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT];
-    do {
-        // Copy out the block of data we want to transmit first
-        size_t this_loop = MIN(item_count, WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT);
-        for (size_t i = 0; i < this_loop; ++i) {
-            temp[i] = values[index + i];
-        }
+    uint32_t offset = (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE) + address;
 
-        bs_dprintf("Write ");
-        wl_dump(offset, temp, sizeof(backing_store_int_t) * this_loop);
+    bs_dprintf("Write ");
+    wl_dump(offset, values, sizeof(backing_store_int_t) * item_count);
 
+    // Report any earlier failure
+    if (!flash_queue_report()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < item_count; ++i) {
         // Take the complement instead
-        for (size_t i = 0; i < this_loop; ++i) {
-            temp[i] = ~temp[i];
-        }
+        backing_store_int_t value = ~values[i];
+        flash_queue_program(offset + i * sizeof(backing_store_int_t), &value, sizeof(value));
+    }
 
-        // Write out the block
-        if (flash_write_block(offset, temp, sizeof(backing_store_int_t) * this_loop) != FLASH_STATUS_SUCCESS) {
-            return false;
-        }
+    return true;
+}
 
-        offset += this_loop * sizeof(backing_store_int_t);
-        index += this_loop;
-        item_count -= this_loop;
-    } while (item_count > 0);
+void backing_store_task(void) {
+    flash_queue_poll();
+}
 
-    return true;
+bool backing_store_flush(void) {
+    return flash_queue_drain();
 }
@@ -2,6 +2,7 @@
 """
 import math
 import re
+from collections import deque
 from string import Template
 from PIL import Image, ImageOps
 
@@ -239,6 +240,8 @@ def convert_image_bytes(im, format):
         # Export the palette
         palette = []
         pal = im.getpalette()
+        # Newer versions of Pillow only return the palette entries that are in use, so pad it out to the full size
+        pal += [0] * (ncolors * 3 - len(pal))
         for n in range(0, ncolors * 3, 3):
             palette.append((pal[n + 0], pal[n + 1], pal[n + 2]))
 
@@ -328,3 +331,73 @@ def compress_bytes_qmk_rle(bytearray):
                 temp = []
                 repeat = False
     return output
+
+
+def compress_bytes_qmk_lz(bytearray):
+    """Compresses a byte sequence using QMK LZ, matching against a window of the previous 256 bytes.
+
+    See docs/quantum_painter_lz.md for the encoding.
+    """
+    window_size = 256
+    min_match = 3
+    max_match = 130
+    max_literals = 128
+    output = []
+    literals = []
+    positions = {}
+
+    def flush_literals():
+        while len(literals) > 0:
+            chunk = literals[0:max_literals]
+            output.append(len(chunk) - 1)
+            output.extend(chunk)
+            del literals[0:len(chunk)]
+
+    def insert(n):
+        if n + min_match <= len(bytearray):
+            chain = positions.setdefault(bytes(bytearray[n:n + min_match]), deque())
+            chain.append(n)
+
+    def find_match(n):
+        best_length, best_distance = 0, 0
+        if n + min_match > len(bytearray):
+            return (best_length, best_distance)
+        chain = positions.get(bytes(bytearray[n:n + min_match]), None)
+        if chain is None:
+            return (best_length, best_distance)
+        while len(chain) > 0 and n - chain[0] > window_size:
+            chain.popleft()
+        limit = min(max_match, len(bytearray) - n)
+        for pos in reversed(chain):
+            length = min_match
+            while length < limit and bytearray[pos + length] == bytearray[n + length]:
+                length += 1
+            if length > best_length:
+                best_length, best_distance = length, n - pos
+                if length == limit:
+                    break
+        return (best_length, best_distance)
+
+    n = 0
+    while n < len(bytearray):
+        (length, distance) = find_match(n)
+        insert(n)
+
+        # Defer to a literal if the next position yields a longer match
+        if 0 < length < max_match and find_match(n + 1)[0] > length:
+            length = 0
+
+        if length == 0:
+            literals.append(bytearray[n])
+            n += 1
+            continue
+
+        flush_literals()
+        output.append(128 + length - min_match)
+        output.append(distance - 1)
+        for i in range(n + 1, n + length):
+            insert(i)
+        n += length
+
+    flush_literals()
+    return output
@@ -0,0 +1,88 @@
+import random
+
+import qmk.painter
+
+
+def decompress_qmk_lz(data):
+    """Decodes QMK LZ as described in docs/quantum_painter_lz.md, checking every token stays within the format's limits.
+    """
+    output = []
+    n = 0
+    while n < len(data):
+        marker = data[n]
+        n += 1
+        if marker < 128:
+            length = marker + 1
+            assert n + length <= len(data), 'literal run past the end of the data'
+            output.extend(data[n:n + length])
+            n += length
+        else:
+            length = marker - 128 + 3
+            assert n < len(data), 'match without a distance'
+            distance = data[n] + 1
+            n += 1
+            assert distance <= len(output), 'match refers to data before the start of the frame'
+            assert distance <= 256, 'match refers to data outside the window'
+            for _ in range(length):
+                output.append(output[-distance])
+    return output
+
+
+def roundtrip_qmk_lz(data):
+    compressed = qmk.painter.compress_bytes_qmk_lz(data)
+    assert all(0 <= b <= 255 for b in compressed)
+    assert decompress_qmk_lz(compressed) == list(data)
+    return compressed
+
+
+def test_qmk_lz_empty():
+    assert roundtrip_qmk_lz([]) == []
+
+
+def test_qmk_lz_literals():
+    data = list(range(200))
+    compressed = roundtrip_qmk_lz(data)
+    # Split into two literal runs, as a run holds at most 128 octets
+    assert compressed[0] == 127
+    assert compressed[129] == 200 - 128 - 1
+
+
+def test_qmk_lz_runs():
+    data = [0x55] * 1000 + [0xAA] + [0x55] * 3
+    compressed = roundtrip_qmk_lz(data)
+    assert len(compressed) < 30
+
+
+def test_qmk_lz_repeated_patterns():
+    data = [0x12, 0x34, 0x56, 0x78, 0x9A] * 100
+    compressed = roundtrip_qmk_lz(data)
+    assert len(compressed) < len(qmk.painter.compress_bytes_qmk_rle(data))
+
+
+def test_qmk_lz_window_edge():
+    # Repeated from exactly the start of the window
+    block = list(range(256))
+    compressed = roundtrip_qmk_lz(block + block)
+    assert len(compressed) < 256 + 10
+
+    # Repeated from just beyond the window, so it can't be matched
+    rng = random.Random(1)
+    block = [rng.randrange(256) for _ in range(257)]
+    roundtrip_qmk_lz(block + block)
+
+
+def test_qmk_lz_random():
+    rng = random.Random(0x5eed)
+    for _ in range(50):
+        # Few distinct values and varying run lengths, like palette-based images
+        data = []
+        for _ in range(rng.randrange(1, 40)):
+            if rng.random() < 0.3 and len(data) > 0:
+                start = rng.randrange(len(data))
+                data.extend(data[start:start + rng.randrange(1, 200)])
+            else:
+                data.extend([rng.randrange(4)] * rng.randrange(1, 150))
+        roundtrip_qmk_lz(data)
+
+        data = [rng.randrange(256) for _ in range(rng.randrange(1, 600))]
+        roundtrip_qmk_lz(data)
@@ -167,6 +167,23 @@ i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length,
     return status;
 }
 
+// No DMA available, so asynchronous transfers complete before returning
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    return i2c_transmit(address, data, length, timeout);
+}
+
+i2c_status_t i2c_writeReg_async(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    return i2c_writeReg(devaddr, regaddr, data, length, timeout);
+}
+
+bool i2c_transmit_busy(void) {
+    return false;
+}
+
+i2c_status_t i2c_transmit_wait(void) {
+    return I2C_STATUS_SUCCESS;
+}
+
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
     i2c_status_t status = i2c_start(address | I2C_ACTION_READ, timeout);
 
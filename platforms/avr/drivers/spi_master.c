@@ -151,6 +151,17 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+// No DMA available, so asynchronous transfers complete before returning
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    return spi_transmit(data, length);
+}
+
+void spi_transmit_wait(void) {}
+
+bool spi_transmit_busy(void) {
+    return false;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spi_status_t status;
 
@@ -178,3 +189,7 @@ void spi_stop(void) {
         currentSlave2X     = false;
     }
 }
+
+void spi_stop_async(void) {
+    spi_stop();
+}
@@ -125,11 +125,108 @@ static i2c_status_t i2c_epilogue(const msg_t status) {
     // From ChibiOS HAL: "After a timeout the driver must be stopped and
     // restarted because the bus is in an uncertain state." We also issue that
     // hard stop in case of any error.
-    i2c_stop();
+    i2cStop(&I2C_DRIVER);
 
     return status == MSG_TIMEOUT ? I2C_STATUS_TIMEOUT : I2C_STATUS_ERROR;
 }
 
+/* Asynchronous transmits are copied into a buffer and queued for a dedicated
+ * thread, which sleeps while the transfer is performed by the I2C driver's
+ * interrupts/DMA -- leaving the main thread free to carry on.
+ * Every synchronous function first waits for queued transfers to finish.
+ */
+typedef struct i2c_async_transfer_t {
+    uint8_t  address;
+    uint16_t offset;
+    uint16_t length;
+    uint16_t timeout;
+} i2c_async_transfer_t;
+
+static THD_WORKING_AREA(waI2CAsyncThread, 256);
+static thread_t*            i2c_async_thread = NULL;
+static semaphore_t          i2c_async_queued;
+static threads_queue_t      i2c_async_waiters;
+static i2c_async_transfer_t i2c_async_queue[I2C_ASYNC_QUEUE_SIZE];
+static uint8_t              i2c_async_buffer[I2C_ASYNC_BUFFER_SIZE];
+static uint16_t             i2c_async_buffer_used = 0;
+static uint8_t              i2c_async_head        = 0;
+static uint8_t              i2c_async_tail        = 0;
+static volatile uint8_t     i2c_async_count       = 0;
+static i2c_status_t         i2c_async_status      = I2C_STATUS_SUCCESS;
+
+static THD_FUNCTION(I2CAsyncThread, arg) {
+    (void)arg;
+    chRegSetThreadName("i2c_async");
+    while (true) {
+        chSemWait(&i2c_async_queued);
+
+        // The producer never modifies queued entries, so the transfer can be read outside the lock
+        const i2c_async_transfer_t* transfer = &i2c_async_queue[i2c_async_head];
+        i2cStart(&I2C_DRIVER, &i2cconfig);
+        i2c_status_t status = i2c_epilogue(i2cMasterTransmitTimeout(&I2C_DRIVER, (transfer->address >> 1), &i2c_async_buffer[transfer->offset], transfer->length, 0, 0, TIME_MS2I(transfer->timeout)));
+
+        osalSysLock();
+        if (status != I2C_STATUS_SUCCESS && i2c_async_status == I2C_STATUS_SUCCESS) {
+            i2c_async_status = status;
+        }
+        i2c_async_head = (i2c_async_head + 1) % I2C_ASYNC_QUEUE_SIZE;
+        if (--i2c_async_count == 0) {
+            osalThreadDequeueAllI(&i2c_async_waiters, MSG_OK);
+            osalOsRescheduleS();
+        }
+        osalSysUnlock();
+    }
+}
+
+// Blocks until all transfers queued by i2c_transmit_async() or i2c_writeReg_async() have completed
+static void i2c_wait_async(void) {
+    osalSysLock();
+    while (i2c_async_count > 0) {
+        osalThreadEnqueueTimeoutS(&i2c_async_waiters, TIME_INFINITE);
+    }
+    osalSysUnlock();
+}
+
+static i2c_status_t i2c_queue_async(uint8_t address, const uint8_t* prefix, uint8_t prefix_length, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    uint16_t total_length = prefix_length + length;
+    if (total_length > I2C_ASYNC_BUFFER_SIZE) {
+        return I2C_STATUS_ERROR;
+    }
+
+    if (i2c_async_thread == NULL) {
+        chSemObjectInit(&i2c_async_queued, 0);
+        osalThreadQueueObjectInit(&i2c_async_waiters);
+        i2c_async_thread = chThdCreateStatic(waI2CAsyncThread, sizeof(waI2CAsyncThread), NORMALPRIO + 1, I2CAsyncThread, NULL);
+    }
+
+    // The buffer is reused once everything in it has been sent, so wait if either it or the queue is full
+    if (i2c_async_count == I2C_ASYNC_QUEUE_SIZE || i2c_async_buffer_used + total_length > I2C_ASYNC_BUFFER_SIZE) {
+        i2c_wait_async();
+    }
+    if (i2c_async_count == 0) {
+        i2c_async_buffer_used = 0;
+    }
+
+    i2c_async_transfer_t* transfer = &i2c_async_queue[i2c_async_tail];
+    transfer->address              = address;
+    transfer->offset               = i2c_async_buffer_used;
+    transfer->length               = total_length;
+    transfer->timeout              = timeout;
+    if (prefix_length > 0) {
+        memcpy(&i2c_async_buffer[i2c_async_buffer_used], prefix, prefix_length);
+    }
+    memcpy(&i2c_async_buffer[i2c_async_buffer_used + prefix_length], data, length);
+    i2c_async_buffer_used += total_length;
+    i2c_async_tail = (i2c_async_tail + 1) % I2C_ASYNC_QUEUE_SIZE;
+
+    osalSysLock();
+    i2c_async_count++;
+    chSemSignalI(&i2c_async_queued);
+    osalOsRescheduleS();
+    osalSysUnlock();
+    return I2C_STATUS_SUCCESS;
+}
+
 __attribute__((weak)) void i2c_init(void) {
     static bool is_initialised = false;
     if (!is_initialised) {
@@ -151,19 +248,43 @@ __attribute__((weak)) void i2c_init(void) {
 }
 
 i2c_status_t i2c_start(uint8_t address) {
+    i2c_wait_async();
     i2c_address = address;
     i2cStart(&I2C_DRIVER, &i2cconfig);
     return I2C_STATUS_SUCCESS;
 }
 
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_wait_async();
     i2c_address = address;
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    return i2c_queue_async(address, NULL, 0, data, length, timeout);
+}
+
+i2c_status_t i2c_writeReg_async(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    return i2c_queue_async(devaddr, &regaddr, 1, data, length, timeout);
+}
+
+bool i2c_transmit_busy(void) {
+    return i2c_async_count > 0;
+}
+
+i2c_status_t i2c_transmit_wait(void) {
+    i2c_wait_async();
+    osalSysLock();
+    i2c_status_t status = i2c_async_status;
+    i2c_async_status    = I2C_STATUS_SUCCESS;
+    osalSysUnlock();
+    return status;
+}
+
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_wait_async();
     i2c_address = address;
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, TIME_MS2I(timeout));
@@ -171,6 +292,7 @@ i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16
 }
 
 i2c_status_t i2c_writeReg(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_wait_async();
     i2c_address = devaddr;
     i2cStart(&I2C_DRIVER, &i2cconfig);
 
@@ -185,6 +307,7 @@ i2c_status_t i2c_writeReg(uint8_t devaddr, uint8_t regaddr, const uint8_t* data,
 }
 
 i2c_status_t i2c_writeReg16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_wait_async();
     i2c_address = devaddr;
     i2cStart(&I2C_DRIVER, &i2cconfig);
 
@@ -200,6 +323,7 @@ i2c_status_t i2c_writeReg16(uint8_t devaddr, uint16_t regaddr, const uint8_t* da
 }
 
 i2c_status_t i2c_readReg(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_wait_async();
     i2c_address = devaddr;
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
@@ -207,6 +331,7 @@ i2c_status_t i2c_readReg(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16
 }
 
 i2c_status_t i2c_readReg16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_wait_async();
     i2c_address = devaddr;
     i2cStart(&I2C_DRIVER, &i2cconfig);
     uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
@@ -215,5 +340,6 @@ i2c_status_t i2c_readReg16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uin
 }
 
 void i2c_stop(void) {
+    i2c_wait_async();
     i2cStop(&I2C_DRIVER);
 }
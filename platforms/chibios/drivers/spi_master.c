@@ -19,6 +19,7 @@
 #include "timer.h"
 
 static pin_t currentSlavePin = NO_PIN;
+static bool  asyncRelease    = false;
 
 #if defined(K20x) || defined(KL2x) || defined(RP2040)
 static SPIConfig spiConfig = {NULL, 0, 0, 0};
@@ -52,6 +53,11 @@ __attribute__((weak)) void spi_init(void) {
 }
 
 bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
+    // Take the bus over from a transaction ended with spi_stop_async()
+    if (asyncRelease) {
+        spi_stop();
+    }
+
     if (currentSlavePin != NO_PIN || slavePin == NO_PIN) {
         return false;
     }
@@ -258,7 +264,18 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
     return true;
 }
 
+// Blocks until any transfer started by spi_transmit_async() has completed
+static inline void spi_wait_async(void) {
+    osalSysLock();
+    if (SPI_DRIVER.state == SPI_ACTIVE) {
+        osalThreadSuspendS(&SPI_DRIVER.thread);
+    }
+    osalSysUnlock();
+}
+
 spi_status_t spi_write(uint8_t data) {
+    spi_wait_async();
+
     uint8_t rxData;
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
@@ -266,6 +283,8 @@ spi_status_t spi_write(uint8_t data) {
 }
 
 spi_status_t spi_read(void) {
+    spi_wait_async();
+
     uint8_t data = 0;
     spiReceive(&SPI_DRIVER, 1, &data);
 
@@ -273,19 +292,52 @@ spi_status_t spi_read(void) {
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_wait_async();
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spi_wait_async();
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_transmit_wait(void) {
+    spi_wait_async();
+}
+
+bool spi_transmit_busy(void) {
+    if (SPI_DRIVER.state == SPI_ACTIVE) {
+        return true;
+    }
+    if (asyncRelease) {
+        spi_stop();
+    }
+    return false;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_wait_async();
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
     if (currentSlavePin != NO_PIN) {
+        spi_wait_async();
         spiUnselect(&SPI_DRIVER);
         spiStop(&SPI_DRIVER);
         currentSlavePin = NO_PIN;
     }
+    asyncRelease = false;
+}
+
+// Ends the transaction without waiting for an asynchronous transfer, the bus is released as soon as anything else
+// finds the transfer complete
+void spi_stop_async(void) {
+    if (currentSlavePin != NO_PIN) {
+        asyncRelease = true;
+        spi_transmit_busy();
+    }
 }
@@ -36,6 +36,23 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+#ifdef WEAR_LEVELING_DUAL_BANK
+bool backing_store_erase_range(uint32_t address, size_t length) {
+    // Only whole pages can be erased
+    if ((address % (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE)) != 0 || (length % (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE)) != 0) {
+        return false;
+    }
+
+    bool ret = true;
+    for (uint32_t i = 0; i < length; i += (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE)) {
+        if (FLASH_ErasePage(WEAR_LEVELING_LEGACY_EMULATION_BASE_PAGE_ADDRESS + address + i) != FLASH_COMPLETE) {
+            ret = false;
+        }
+    }
+    return ret;
+}
+#endif // WEAR_LEVELING_DUAL_BANK
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     uint32_t offset = ((WEAR_LEVELING_LEGACY_EMULATION_BASE_PAGE_ADDRESS) + address);
     bs_dprintf("Write ");
@@ -52,6 +52,10 @@
 #    define BACKING_STORE_WRITE_SIZE 2
 #endif
 
+#if !defined(BACKING_STORE_ERASE_SIZE) && defined(WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE)
+#    define BACKING_STORE_ERASE_SIZE (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE)
+#endif
+
 // The amount of space to use for the entire set of emulation
 #ifndef WEAR_LEVELING_BACKING_SIZE
 #    if defined(QMK_MCU_STM32F042) || defined(QMK_MCU_STM32F070) || defined(QMK_MCU_STM32F072)
@@ -187,6 +187,21 @@ bool backing_store_erase(void) {
     return true;
 }
 
+#ifdef WEAR_LEVELING_DUAL_BANK
+bool backing_store_erase_range(uint32_t address, size_t length) {
+    // Only whole sectors can be erased
+    if ((address % (FLASH_SECTOR_SIZE)) != 0 || (length % (FLASH_SECTOR_SIZE)) != 0) {
+        return false;
+    }
+
+    bs_dprintf("Erase 0x%08lX, %d bytes\n", (unsigned long)((WEAR_LEVELING_RP2040_FLASH_BASE) + address), (int)length);
+    interrupts = save_and_disable_interrupts();
+    flash_range_erase((WEAR_LEVELING_RP2040_FLASH_BASE) + address, length);
+    restore_interrupts(interrupts);
+    return true;
+}
+#endif // WEAR_LEVELING_DUAL_BANK
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
@@ -22,6 +22,21 @@ void     eeprom_update_dword(uint32_t *__p, uint32_t __value);
 void     eeprom_update_block(const void *__src, void *__dst, size_t __n);
 #endif
 
+/* Groups a sequence of EEPROM writes, so that drivers which can do so write them out in one go on commit, rather than
+ * one at a time. Reads within a transaction see the new values straight away. Transactions may be nested.
+ */
+#if defined(EEPROM_WEAR_LEVELING)
+void eeprom_transaction_begin(void);
+void eeprom_transaction_commit(void);
+#else
+#    define eeprom_transaction_begin() \
+        do {                           \
+        } while (0)
+#    define eeprom_transaction_commit() \
+        do {                            \
+        } while (0)
+#endif
+
 #if defined(EEPROM_CUSTOM)
 #    ifndef EEPROM_SIZE
 #        error EEPROM_SIZE has not been defined for custom driver.
@@ -1010,10 +1010,13 @@ __attribute__((weak)) void unregister_code(uint8_t code) {
  * \param delay The amount of time in milliseconds to leave the keycode registered, before unregistering it.
  */
 __attribute__((weak)) void tap_code_delay(uint8_t code, uint16_t delay) {
+    // Both reports have to reach the host, or the tap is lost
+    host_keyboard_wait_ready();
     register_code(code);
     for (uint16_t i = delay; i > 0; i--) {
         wait_ms(1);
     }
+    host_keyboard_wait_ready();
     unregister_code(code);
 }
 
@@ -5,6 +5,7 @@
 #include "action_layer.h"
 #include "action_tapping.h"
 #include "keycode.h"
+#include "matrix.h"
 #include "timer.h"
 
 #ifndef NO_ACTION_TAPPING
@@ -59,13 +60,29 @@ __attribute__((weak)) bool get_hold_on_other_key_press(uint16_t keycode, keyreco
 #        include "process_auto_shift.h"
 #    endif
 
+#    if WAITING_BUFFER_SIZE > 255
+#        error WAITING_BUFFER_SIZE must be less than 256
+#    endif
+
+#    define WAITING_BUFFER_IS_INDEXED(key) ((key).row < MATRIX_ROWS && (key).col < MATRIX_COLS)
+#    define WAITING_BUFFER_INDEX_TEST(index, key) (((index)[(key).row] >> (key).col) & 1)
+
 static keyrecord_t tapping_key                         = {};
 static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
 
+/* Per-key index of the waiting buffer contents, so that lookups don't need to
+ * walk the buffer. Positions outside the matrix (encoders, combos) are not
+ * indexed and fall back to a linear scan.
+ */
+static matrix_row_t waiting_buffer_pressed_keys[MATRIX_ROWS]  = {};
+static matrix_row_t waiting_buffer_released_keys[MATRIX_ROWS] = {};
+static uint8_t      waiting_buffer_pressed_count              = 0;
+
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
+static void waiting_buffer_deq(void);
 static void waiting_buffer_clear(void);
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
@@ -98,11 +115,12 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    while (waiting_buffer_tail != waiting_buffer_head) {
         if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
             debug_record(waiting_buffer[waiting_buffer_tail]);
             ac_dprintf("\n\n");
+            waiting_buffer_deq();
         } else {
             break;
         }
@@ -456,25 +474,65 @@ bool waiting_buffer_enq(keyrecord_t record) {
     waiting_buffer[waiting_buffer_head] = record;
     waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
 
+    if (record.event.pressed) {
+        waiting_buffer_pressed_count++;
+    }
+    if (WAITING_BUFFER_IS_INDEXED(record.event.key)) {
+        matrix_row_t *index = record.event.pressed ? waiting_buffer_pressed_keys : waiting_buffer_released_keys;
+        index[record.event.key.row] |= (matrix_row_t)1 << record.event.key.col;
+    }
+
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
     return true;
 }
 
+/** \brief Waiting buffer deq
+ *
+ * Drops the oldest record and updates the index. The index bit for its key
+ * is only cleared if no other record for the same key and direction is left.
+ */
+void waiting_buffer_deq(void) {
+    keyevent_t event    = waiting_buffer[waiting_buffer_tail].event;
+    waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+
+    if (event.pressed) {
+        waiting_buffer_pressed_count--;
+    }
+    if (WAITING_BUFFER_IS_INDEXED(event.key)) {
+        for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+            if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed == waiting_buffer[i].event.pressed) {
+                return;
+            }
+        }
+        matrix_row_t *index = event.pressed ? waiting_buffer_pressed_keys : waiting_buffer_released_keys;
+        index[event.key.row] &= ~((matrix_row_t)1 << event.key.col);
+    }
+}
+
 /** \brief Waiting buffer clear
  *
  * FIXME: Needs docs
  */
 void waiting_buffer_clear(void) {
-    waiting_buffer_head = 0;
-    waiting_buffer_tail = 0;
+    waiting_buffer_head          = 0;
+    waiting_buffer_tail          = 0;
+    waiting_buffer_pressed_count = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        waiting_buffer_pressed_keys[row]  = 0;
+        waiting_buffer_released_keys[row] = 0;
+    }
 }
 
 /** \brief Waiting buffer typed
  *
- * FIXME: Needs docs
+ * Checks whether the buffer holds the opposite transition of `event`'s key.
  */
 bool waiting_buffer_typed(keyevent_t event) {
+    if (WAITING_BUFFER_IS_INDEXED(event.key)) {
+        return WAITING_BUFFER_INDEX_TEST(event.pressed ? waiting_buffer_released_keys : waiting_buffer_pressed_keys, event.key);
+    }
+
     for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
         if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
             return true;
@@ -488,10 +546,7 @@ bool waiting_buffer_typed(keyevent_t event) {
  * FIXME: Needs docs
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (waiting_buffer[i].event.pressed) return true;
-    }
-    return false;
+    return waiting_buffer_pressed_count > 0;
 }
 
 /** \brief Scan buffer for tapping
@@ -505,6 +560,10 @@ void waiting_buffer_scan_tap(void) {
     if ((tapping_key.tap.count > 0) || !tapping_key.event.pressed) {
         return;
     }
+    // - the tapping key has not been released yet
+    if (WAITING_BUFFER_IS_INDEXED(tapping_key.event.key) && !WAITING_BUFFER_INDEX_TEST(waiting_buffer_released_keys, tapping_key.event.key)) {
+        return;
+    }
 
     for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
         keyrecord_t *candidate = &waiting_buffer[i];
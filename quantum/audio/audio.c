@@ -117,6 +117,8 @@ void eeconfig_update_audio_current(void) {
     eeconfig_update_audio(audio_config.raw);
 }
 
+EECONFIG_DEFERRED_HELPER(audio, eeconfig_update_audio_current);
+
 void audio_init(void) {
     if (audio_initialized) {
         return;
@@ -162,7 +164,7 @@ void audio_toggle(void) {
         stop_all_notes();
     }
     audio_config.enable ^= 1;
-    eeconfig_update_audio(audio_config.raw);
+    eeconfig_flag_audio(true);
     if (audio_config.enable) {
         audio_on_user();
     } else {
@@ -172,7 +174,7 @@ void audio_toggle(void) {
 
 void audio_on(void) {
     audio_config.enable = 1;
-    eeconfig_update_audio(audio_config.raw);
+    eeconfig_flag_audio(true);
     audio_on_user();
     PLAY_SONG(audio_on_song);
 }
@@ -183,7 +185,7 @@ void audio_off(void) {
     wait_ms(100);
     audio_stop_all();
     audio_config.enable = 0;
-    eeconfig_update_audio(audio_config.raw);
+    eeconfig_flag_audio(true);
 }
 
 bool audio_is_on(void) {
@@ -59,6 +59,12 @@ typedef struct {
  */
 void eeconfig_update_audio_current(void);
 
+/**
+ * @brief Flag the current choices to be saved to the eeprom, once they have settled
+ */
+void eeconfig_flag_audio(bool v);
+void eeconfig_flush_audio(bool force);
+
 /**
  * @brief one-time initialization called by quantum/quantum.c
  * @details usually done lazy, when some tones are to be played
@@ -62,6 +62,8 @@ uint8_t eeconfig_read_backlight(void);
 void    eeconfig_update_backlight(uint8_t val);
 void    eeconfig_update_backlight_current(void);
 void    eeconfig_update_backlight_default(void);
+void    eeconfig_flag_backlight(bool v);
+void    eeconfig_flush_backlight(bool force);
 
 // implementation specific
 void backlight_init_ports(void);
@@ -27,6 +27,12 @@
 
 keymap_config_t keymap_config;
 
+static void eeconfig_update_keymap_current(void) {
+    eeconfig_update_keymap(keymap_config.raw);
+}
+
+EECONFIG_DEFERRED_HELPER(keymap, eeconfig_update_keymap_current);
+
 __attribute__((weak)) void bootmagic(void) {}
 
 /** \brief Magic
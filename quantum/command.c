@@ -247,6 +247,9 @@ static void print_status(void) {
 
 #if !defined(NO_PRINT) && !defined(USER_PRINT)
 static void print_eeconfig(void) {
+    // Write out settings still waiting on the flush timeout, so the dump matches what's in use
+    eeconfig_flush_all();
+
     xprintf("eeconfig:\ndefault_layer: %u\n", eeconfig_read_default_layer());
 
     debug_config_t dc;
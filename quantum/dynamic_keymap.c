@@ -22,6 +22,19 @@
 #include "send_string.h"
 #include "keycodes.h"
 
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include "send_string_async.h"
+#endif
+
+#ifdef DYNAMIC_KEYMAP_MACRO_BYTECODE
+#    include <ctype.h>
+#    include <string.h>
+#    include "wait.h"
+#    ifdef UNICODE_COMMON_ENABLE
+#        include "unicode.h"
+#    endif
+#endif
+
 #ifdef VIA_ENABLE
 #    include "via.h"
 #    define DYNAMIC_KEYMAP_EEPROM_START (VIA_EEPROM_CONFIG_END)
@@ -101,6 +114,33 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef DYNAMIC_KEYMAP_MACRO_BYTECODE
+// Size of the text buffer presented to the host.
+// Text macros take up less space once converted to bytecode,
+// so this can be larger than the EEPROM buffer itself.
+#    ifndef DYNAMIC_KEYMAP_MACRO_TEXT_SIZE
+#        if DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE > 32767
+#            define DYNAMIC_KEYMAP_MACRO_TEXT_SIZE 65535
+#        else
+#            define DYNAMIC_KEYMAP_MACRO_TEXT_SIZE (DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE * 2)
+#        endif
+#    endif
+
+#    if DYNAMIC_KEYMAP_MACRO_TEXT_SIZE > 65535
+#        error DYNAMIC_KEYMAP_MACRO_TEXT_SIZE must be less than 65536
+#    endif
+
+// How deeply repeats can be nested, deeper repeats are played once
+#    ifndef DYNAMIC_KEYMAP_MACRO_REPEAT_DEPTH
+#        define DYNAMIC_KEYMAP_MACRO_REPEAT_DEPTH 4
+#    endif
+
+#    define DYNAMIC_KEYMAP_MACRO_BUFFER ((uint8_t *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR))
+// The last byte of the buffer is the valid flag, macros end before it
+#    define DYNAMIC_KEYMAP_MACRO_DATA_END (DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - 1)
+#    define DYNAMIC_KEYMAP_MACRO_TEXT_FLAG (DYNAMIC_KEYMAP_MACRO_TEXT_SIZE - 1)
+#endif
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -152,6 +192,7 @@ void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwis
 
 void dynamic_keymap_reset(void) {
     // Reset the keymaps in EEPROM to what is in flash.
+    eeprom_transaction_begin();
     for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
         for (int row = 0; row < MATRIX_ROWS; row++) {
             for (int column = 0; column < MATRIX_COLS; column++) {
@@ -165,11 +206,12 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+    eeprom_transaction_commit();
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    void *   source                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *target                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
@@ -184,8 +226,9 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    void *   target                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *source                     = data;
+    eeprom_transaction_begin();
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
             eeprom_update_byte(target, *source);
@@ -193,6 +236,7 @@ void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
         source++;
         target++;
     }
+    eeprom_transaction_commit();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -220,7 +264,7 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   source = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *target = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -233,9 +277,17 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
     }
 }
 
+#ifdef DYNAMIC_KEYMAP_MACRO_BYTECODE
+static void macro_reader_reset(void);
+#endif
+
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   target = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *source = data;
+#ifdef DYNAMIC_KEYMAP_MACRO_BYTECODE
+    macro_reader_reset();
+#endif
+    eeprom_transaction_begin();
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
             eeprom_update_byte(target, *source);
@@ -243,68 +295,491 @@ void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *da
         source++;
         target++;
     }
+    eeprom_transaction_commit();
 }
 
 void dynamic_keymap_macro_reset(void) {
     void *p   = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
     void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    eeprom_transaction_begin();
     while (p != end) {
         eeprom_update_byte(p, 0);
         ++p;
     }
+    eeprom_transaction_commit();
+#ifdef DYNAMIC_KEYMAP_MACRO_BYTECODE
+    macro_reader_reset();
+#endif
 }
 
-void dynamic_keymap_macro_send(uint8_t id) {
-    if (id >= DYNAMIC_KEYMAP_MACRO_COUNT) {
-        return;
+#ifdef DYNAMIC_KEYMAP_MACRO_BYTECODE
+// Reads a varint argument, returns false if the end of the macro was reached instead
+static bool macro_read_varint(uint16_t *address, uint32_t *value) {
+    *value = 0;
+    for (uint8_t shift = 0; shift < 32; shift += 7) {
+        uint8_t byte = eeprom_read_byte(DYNAMIC_KEYMAP_MACRO_BUFFER + (*address)++);
+        if (byte == 0) {
+            return false;
+        }
+        *value |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
     }
+    return false;
+}
 
-    // Check the last byte of the buffer.
-    // If it's not zero, then we are in the middle
-    // of buffer writing, possibly an aborted buffer
-    // write. So do nothing.
-    void *p = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - 1);
-    if (eeprom_read_byte(p) != 0) {
-        return;
+// Text to bytecode conversion, fed one byte at a time as the host writes the buffer
+enum {
+    MACRO_TEXT_CHAR,    // plain characters
+    MACRO_TEXT_CODE,    // after SS_QMK_PREFIX
+    MACRO_TEXT_KEYCODE, // after SS_TAP_CODE, SS_DOWN_CODE or SS_UP_CODE
+    MACRO_TEXT_DELAY,   // after SS_DELAY_CODE, reading digits
+};
+
+static struct {
+    uint16_t text_offset; // next offset expected from the host
+    uint16_t address;     // next byte of the buffer to write
+    uint8_t  state;
+    uint8_t  opcode;
+    bool     bytecode; // the current macro has switched to bytecode
+    bool     overflow; // the converted macros did not fit
+    uint32_t delay;
+    uint8_t  run_char;   // character being repeated
+    uint16_t run_length; // number of times run_char was seen in a row
+    uint8_t  utf8_remaining;
+    uint32_t code_point;
+} macro_writer = {.text_offset = 0xFFFF};
+
+static void macro_writer_emit(uint8_t byte) {
+    if (macro_writer.address < DYNAMIC_KEYMAP_MACRO_DATA_END) {
+        eeprom_update_byte(DYNAMIC_KEYMAP_MACRO_BUFFER + macro_writer.address++, byte);
+    } else if (!macro_writer.overflow && (byte != 0 || eeprom_read_byte(DYNAMIC_KEYMAP_MACRO_BUFFER + DYNAMIC_KEYMAP_MACRO_DATA_END - 1) != 0)) {
+        // Out of space, cut the last macro short so the buffer is still a list of null terminated macros.
+        // Empty macros past the end read the same as missing ones, so only running out of space for content counts.
+        eeprom_update_byte(DYNAMIC_KEYMAP_MACRO_BUFFER + DYNAMIC_KEYMAP_MACRO_DATA_END - 1, 0);
+        macro_writer.overflow = true;
     }
+}
 
-    // Skip N null characters
-    // p will then point to the Nth macro
-    p         = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
-    void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
-    while (id > 0) {
-        // If we are past the end of the buffer, then there is
-        // no Nth macro in the buffer.
-        if (p == end) {
+static void macro_writer_emit_opcode(uint8_t opcode) {
+    if (!macro_writer.bytecode) {
+        macro_writer_emit(DYNAMIC_KEYMAP_MACRO_OP_BYTECODE);
+        macro_writer.bytecode = true;
+    }
+    macro_writer_emit(opcode);
+}
+
+static void macro_writer_emit_varint(uint32_t value) {
+    while (value > 0x7F) {
+        macro_writer_emit((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    macro_writer_emit(value);
+}
+
+// Writes out the run of repeated characters seen so far,
+// as a repeat if that takes less space than the characters themselves
+static void macro_writer_flush_run(void) {
+    if (macro_writer.run_length > (macro_writer.bytecode ? 4 : 5)) {
+        macro_writer_emit_opcode(DYNAMIC_KEYMAP_MACRO_OP_REPEAT);
+        macro_writer_emit_varint(macro_writer.run_length);
+        macro_writer_emit_varint(1);
+        macro_writer_emit(macro_writer.run_char);
+    } else {
+        for (uint16_t i = 0; i < macro_writer.run_length; i++) {
+            macro_writer_emit(macro_writer.run_char);
+        }
+    }
+    macro_writer.run_length = 0;
+}
+
+// Collects UTF-8 encoded characters into code points, invalid sequences are dropped
+static void macro_writer_feed_utf8(uint8_t byte) {
+    if ((byte & 0xC0) == 0x80) {
+        if (macro_writer.utf8_remaining > 0) {
+            macro_writer.code_point = (macro_writer.code_point << 6) | (byte & 0x3F);
+            if (--macro_writer.utf8_remaining == 0 && macro_writer.code_point >= 0x80 && macro_writer.code_point <= 0x10FFFF) {
+                macro_writer_emit_opcode(DYNAMIC_KEYMAP_MACRO_OP_UNICODE);
+                macro_writer_emit_varint(macro_writer.code_point);
+            }
+        }
+    } else if ((byte & 0xE0) == 0xC0) {
+        macro_writer.code_point     = byte & 0x1F;
+        macro_writer.utf8_remaining = 1;
+    } else if ((byte & 0xF0) == 0xE0) {
+        macro_writer.code_point     = byte & 0x0F;
+        macro_writer.utf8_remaining = 2;
+    } else if ((byte & 0xF8) == 0xF0) {
+        macro_writer.code_point     = byte & 0x07;
+        macro_writer.utf8_remaining = 3;
+    } else {
+        macro_writer.utf8_remaining = 0;
+    }
+}
+
+static void macro_writer_feed(uint8_t byte) {
+    if (macro_writer.run_length > 0) {
+        if (byte == macro_writer.run_char && macro_writer.run_length < 0xFFFF) {
+            macro_writer.run_length++;
             return;
         }
-        if (eeprom_read_byte(p) == 0) {
-            --id;
+        macro_writer_flush_run();
+    }
+    if (byte < 0x80) {
+        macro_writer.utf8_remaining = 0;
+    }
+
+    switch (macro_writer.state) {
+        case MACRO_TEXT_DELAY:
+            if (isdigit(byte)) {
+                if (macro_writer.delay < 0xFFFF) {
+                    macro_writer.delay = macro_writer.delay * 10 + byte - '0';
+                }
+                return;
+            }
+            if (macro_writer.delay) {
+                macro_writer_emit_opcode(DYNAMIC_KEYMAP_MACRO_OP_DELAY);
+                macro_writer_emit_varint(macro_writer.delay > 0xFFFF ? 0xFFFF : macro_writer.delay);
+            }
+            macro_writer.state = MACRO_TEXT_CHAR;
+            // Like send_string(), the character ending the delay is skipped
+            if (byte) {
+                return;
+            }
+            break;
+        case MACRO_TEXT_KEYCODE:
+            macro_writer.state = MACRO_TEXT_CHAR;
+            if (byte) {
+                macro_writer_emit_opcode(macro_writer.opcode);
+                macro_writer_emit(byte);
+                return;
+            }
+            break;
+        case MACRO_TEXT_CODE:
+            macro_writer.state = MACRO_TEXT_KEYCODE;
+            switch (byte) {
+                case SS_TAP_CODE:
+                    macro_writer.opcode = DYNAMIC_KEYMAP_MACRO_OP_TAP;
+                    return;
+                case SS_DOWN_CODE:
+                    macro_writer.opcode = DYNAMIC_KEYMAP_MACRO_OP_DOWN;
+                    return;
+                case SS_UP_CODE:
+                    macro_writer.opcode = DYNAMIC_KEYMAP_MACRO_OP_UP;
+                    return;
+                case SS_DELAY_CODE:
+                    macro_writer.state = MACRO_TEXT_DELAY;
+                    macro_writer.delay = 0;
+                    return;
+            }
+            // Unknown codes are dropped
+            macro_writer.state = MACRO_TEXT_CHAR;
+            if (byte) {
+                return;
+            }
+            break;
+        default:
+            if (byte == SS_QMK_PREFIX) {
+                macro_writer.state = MACRO_TEXT_CODE;
+                return;
+            }
+            // Anything beyond ASCII is UTF-8, and is typed as Unicode
+            if (byte >= 0x80) {
+                macro_writer_feed_utf8(byte);
+                return;
+            }
+            if (byte) {
+                macro_writer.run_char   = byte;
+                macro_writer.run_length = 1;
+                return;
+            }
+            break;
+    }
+
+    // End of the macro
+    macro_writer_emit(0);
+    macro_writer.bytecode = false;
+}
+
+// Bytecode to text conversion, producing one byte at a time as the host reads the buffer
+static struct {
+    uint16_t text_offset; // offset of the next byte produced
+    uint16_t address;     // next byte of the buffer to read
+    uint8_t  state;
+    bool     bytecode;
+    uint8_t  pending[8]; // text of the last opcode, at most "\1\4" + 5 digits + '|'
+    uint8_t  pending_index;
+    uint8_t  pending_length;
+    uint8_t  depth;
+    struct {
+        uint16_t start;
+        uint16_t end;
+        uint32_t count;
+    } repeat[DYNAMIC_KEYMAP_MACRO_REPEAT_DEPTH];
+} macro_reader;
+
+static void macro_reader_reset(void) {
+    memset(&macro_reader, 0, sizeof(macro_reader));
+}
+
+static uint8_t macro_reader_end_of_macro(void) {
+    macro_reader.state    = MACRO_TEXT_CHAR;
+    macro_reader.bytecode = false;
+    macro_reader.depth    = 0;
+    return 0;
+}
+
+static uint8_t macro_reader_next(void) {
+    while (true) {
+        if (macro_reader.pending_index < macro_reader.pending_length) {
+            return macro_reader.pending[macro_reader.pending_index++];
         }
-        ++p;
+        if (macro_reader.depth > 0 && macro_reader.address >= macro_reader.repeat[macro_reader.depth - 1].end) {
+            if (--macro_reader.repeat[macro_reader.depth - 1].count > 0) {
+                macro_reader.address = macro_reader.repeat[macro_reader.depth - 1].start;
+            } else {
+                macro_reader.depth--;
+            }
+            continue;
+        }
+        if (macro_reader.address >= DYNAMIC_KEYMAP_MACRO_DATA_END) {
+            return 0;
+        }
+
+        uint8_t byte = eeprom_read_byte(DYNAMIC_KEYMAP_MACRO_BUFFER + macro_reader.address++);
+        if (byte == 0) {
+            return macro_reader_end_of_macro();
+        }
+
+        if (!macro_reader.bytecode) {
+            // Text is passed through, only keeping track of where keycodes are
+            switch (macro_reader.state) {
+                case MACRO_TEXT_CODE:
+                    macro_reader.state = (byte == SS_TAP_CODE || byte == SS_DOWN_CODE || byte == SS_UP_CODE) ? MACRO_TEXT_KEYCODE : MACRO_TEXT_CHAR;
+                    return byte;
+                case MACRO_TEXT_KEYCODE:
+                    macro_reader.state = MACRO_TEXT_CHAR;
+                    return byte;
+            }
+            if (byte == SS_QMK_PREFIX) {
+                macro_reader.state = MACRO_TEXT_CODE;
+            } else if (byte == DYNAMIC_KEYMAP_MACRO_OP_BYTECODE) {
+                macro_reader.bytecode = true;
+                continue;
+            }
+            return byte;
+        }
+
+        if (byte < DYNAMIC_KEYMAP_MACRO_OP_BYTECODE) {
+            return byte;
+        }
+
+        uint32_t value;
+        uint32_t length;
+        macro_reader.pending_index  = 0;
+        macro_reader.pending_length = 0;
+        switch (byte) {
+            case DYNAMIC_KEYMAP_MACRO_OP_TAP:
+            case DYNAMIC_KEYMAP_MACRO_OP_DOWN:
+            case DYNAMIC_KEYMAP_MACRO_OP_UP:
+                value = eeprom_read_byte(DYNAMIC_KEYMAP_MACRO_BUFFER + macro_reader.address++);
+                if (value == 0) {
+                    return macro_reader_end_of_macro();
+                }
+                macro_reader.pending[0]     = SS_QMK_PREFIX;
+                macro_reader.pending[1]     = SS_TAP_CODE + (byte - DYNAMIC_KEYMAP_MACRO_OP_TAP);
+                macro_reader.pending[2]     = value;
+                macro_reader.pending_length = 3;
+                break;
+            case DYNAMIC_KEYMAP_MACRO_OP_DELAY: {
+                if (!macro_read_varint(&macro_reader.address, &value)) {
+                    return macro_reader_end_of_macro();
+                }
+                if (value > 0xFFFF) {
+                    value = 0xFFFF;
+                }
+                uint8_t digits = 1;
+                for (uint32_t i = value; i >= 10; i /= 10) {
+                    digits++;
+                }
+                macro_reader.pending[0] = SS_QMK_PREFIX;
+                macro_reader.pending[1] = SS_DELAY_CODE;
+                for (uint8_t i = digits; i > 0; i--) {
+                    macro_reader.pending[1 + i] = '0' + value % 10;
+                    value /= 10;
+                }
+                macro_reader.pending[2 + digits] = '|';
+                macro_reader.pending_length      = 3 + digits;
+                break;
+            }
+            case DYNAMIC_KEYMAP_MACRO_OP_UNICODE:
+                // Shown as UTF-8, as it was written
+                if (!macro_read_varint(&macro_reader.address, &value)) {
+                    return macro_reader_end_of_macro();
+                }
+                if (value < 0x800) {
+                    macro_reader.pending[0]     = 0xC0 | (value >> 6);
+                    macro_reader.pending_length = 2;
+                } else if (value < 0x10000) {
+                    macro_reader.pending[0]     = 0xE0 | (value >> 12);
+                    macro_reader.pending_length = 3;
+                } else if (value <= 0x10FFFF) {
+                    macro_reader.pending[0]     = 0xF0 | (value >> 18);
+                    macro_reader.pending_length = 4;
+                }
+                for (uint8_t i = 1; i < macro_reader.pending_length; i++) {
+                    macro_reader.pending[i] = 0x80 | ((value >> (6 * (macro_reader.pending_length - 1 - i))) & 0x3F);
+                }
+                break;
+            case DYNAMIC_KEYMAP_MACRO_OP_REPEAT:
+                // Repeats are expanded
+                if (!macro_read_varint(&macro_reader.address, &value) || !macro_read_varint(&macro_reader.address, &length)) {
+                    return macro_reader_end_of_macro();
+                }
+                if (value > 1 && macro_reader.depth < DYNAMIC_KEYMAP_MACRO_REPEAT_DEPTH) {
+                    macro_reader.repeat[macro_reader.depth].start = macro_reader.address;
+                    macro_reader.repeat[macro_reader.depth].end   = macro_reader.address + length;
+                    macro_reader.repeat[macro_reader.depth].count = value;
+                    macro_reader.depth++;
+                }
+                break;
+        }
+    }
+}
+
+uint16_t dynamic_keymap_macro_get_text_buffer_size(void) {
+    return DYNAMIC_KEYMAP_MACRO_TEXT_SIZE;
+}
+
+void dynamic_keymap_macro_get_text_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    // Reads carry on from where the last one stopped, so reading
+    // the whole buffer in order only converts it once.
+    if (offset < macro_reader.text_offset) {
+        macro_reader_reset();
     }
+    while (macro_reader.text_offset < offset && macro_reader.text_offset < DYNAMIC_KEYMAP_MACRO_TEXT_FLAG) {
+        macro_reader_next();
+        macro_reader.text_offset++;
+    }
+
+    for (uint16_t i = 0; i < size; i++) {
+        if (offset + i < DYNAMIC_KEYMAP_MACRO_TEXT_FLAG) {
+            data[i] = macro_reader_next();
+            macro_reader.text_offset++;
+        } else if (offset + i == DYNAMIC_KEYMAP_MACRO_TEXT_FLAG) {
+            data[i] = eeprom_read_byte(DYNAMIC_KEYMAP_MACRO_BUFFER + DYNAMIC_KEYMAP_MACRO_DATA_END);
+        } else {
+            data[i] = 0x00;
+        }
+    }
+}
+
+bool dynamic_keymap_macro_set_text_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    bool in_order  = true;
+    bool converted = false;
+    macro_reader_reset();
+
+    eeprom_transaction_begin();
+    for (uint16_t i = 0; i < size; i++, offset++) {
+        if (offset == DYNAMIC_KEYMAP_MACRO_TEXT_FLAG) {
+            // The valid flag is stored as is, after whatever the last macro was cut short at
+            if (macro_writer.text_offset == offset && macro_writer.run_length > 0) {
+                macro_writer_flush_run();
+            }
+            eeprom_update_byte(DYNAMIC_KEYMAP_MACRO_BUFFER + DYNAMIC_KEYMAP_MACRO_DATA_END, data[i]);
+            continue;
+        }
+        if (offset > DYNAMIC_KEYMAP_MACRO_TEXT_FLAG) {
+            continue;
+        }
+        if (offset == 0) {
+            memset(&macro_writer, 0, sizeof(macro_writer));
+        }
+        // Only a buffer written in order from the start can be converted
+        if (offset != macro_writer.text_offset) {
+            macro_writer.text_offset = 0xFFFF;
+            in_order                 = false;
+            break;
+        }
+        macro_writer_feed(data[i]);
+        macro_writer.text_offset++;
+        converted = true;
+    }
+    eeprom_transaction_commit();
+
+    return in_order && !(converted && macro_writer.overflow);
+}
+
+// Macros are played back from the same text the host reads back, so text
+// and bytecode go through the same send path.
+static void macro_reader_seek(uint16_t address) {
+    macro_reader_reset();
+    macro_reader.address = address;
+}
+#endif // DYNAMIC_KEYMAP_MACRO_BYTECODE
+
+// Returns the next byte of the macro text starting at p
+static uint8_t dynamic_keymap_macro_next(uint8_t **p) {
+#ifdef DYNAMIC_KEYMAP_MACRO_BYTECODE
+    // Bytecode is turned back into text as it is read, the position is kept by the reader
+    (void)p;
+    return macro_reader_next();
+#else
+    return eeprom_read_byte((*p)++);
+#endif
+}
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+// Each byte is read once, in order
+static uint8_t dynamic_keymap_macro_read(const char *p) {
+    return dynamic_keymap_macro_next((uint8_t **)&p);
+}
+#endif
 
+static void dynamic_keymap_macro_play(uint8_t *p) {
     // Send the macro string by making a temporary string.
-    char data[8] = {0};
+    char data[10] = {0};
     // We already checked there was a null at the end of
     // the buffer, so this cannot go past the end
     while (1) {
-        data[0] = eeprom_read_byte(p++);
+        data[0] = dynamic_keymap_macro_next(&p);
         data[1] = 0;
         // Stop at the null terminator of this macro string
         if (data[0] == 0) {
             break;
         }
+#ifdef DYNAMIC_KEYMAP_MACRO_BYTECODE
+        // Unicode is read back as UTF-8
+        if ((uint8_t)data[0] >= 0xC0) {
+            uint8_t length = (uint8_t)data[0] >= 0xF0 ? 4 : ((uint8_t)data[0] >= 0xE0 ? 3 : 2);
+            for (uint8_t i = 1; i < length; i++) {
+                data[i] = dynamic_keymap_macro_next(&p);
+                // Unexpected null, abort.
+                if (data[i] == 0) {
+                    return;
+                }
+            }
+            data[length] = 0;
+#    ifdef UNICODE_COMMON_ENABLE
+            send_unicode_string(data);
+#    endif
+            if (DYNAMIC_KEYMAP_MACRO_DELAY) {
+                wait_ms(DYNAMIC_KEYMAP_MACRO_DELAY);
+            }
+            continue;
+        }
+#endif
         if (data[0] == SS_QMK_PREFIX) {
             // Get the code
-            data[1] = eeprom_read_byte(p++);
+            data[1] = dynamic_keymap_macro_next(&p);
             // Unexpected null, abort.
             if (data[1] == 0) {
                 return;
             }
             if (data[1] == SS_TAP_CODE || data[1] == SS_DOWN_CODE || data[1] == SS_UP_CODE) {
                 // Get the keycode
-                data[2] = eeprom_read_byte(p++);
+                data[2] = dynamic_keymap_macro_next(&p);
                 // Unexpected null, abort.
                 if (data[2] == 0) {
                     return;
@@ -313,10 +788,10 @@ void dynamic_keymap_macro_send(uint8_t id) {
                 data[3] = 0;
             } else if (data[1] == SS_DELAY_CODE) {
                 // Get the number and '|'
-                // At most this is 4 digits plus '|'
+                // At most this is 5 digits plus '|'
                 uint8_t i = 2;
                 while (1) {
-                    data[i] = eeprom_read_byte(p++);
+                    data[i] = dynamic_keymap_macro_next(&p);
                     // Unexpected null, abort
                     if (data[i] == 0) {
                         return;
@@ -326,9 +801,9 @@ void dynamic_keymap_macro_send(uint8_t id) {
                         data[i + 1] = 0;
                         break;
                     }
-                    // If haven't found '|' by i==6 then
+                    // If haven't found '|' by i==7 then
                     // number too big, abort
-                    if (i == 6) {
+                    if (i == 7) {
                         return;
                     }
                     ++i;
@@ -338,3 +813,56 @@ void dynamic_keymap_macro_send(uint8_t id) {
         send_string_with_delay(data, DYNAMIC_KEYMAP_MACRO_DELAY);
     }
 }
+
+void dynamic_keymap_macro_send(uint8_t id) {
+    if (id >= DYNAMIC_KEYMAP_MACRO_COUNT) {
+        return;
+    }
+
+    // Check the last byte of the buffer.
+    // If it's not zero, then we are in the middle
+    // of buffer writing, possibly an aborted buffer
+    // write. So do nothing.
+    void *p = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - 1);
+    if (eeprom_read_byte(p) != 0) {
+        return;
+    }
+
+    // Skip N null characters
+    // p will then point to the Nth macro
+    p         = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
+    void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    while (id > 0) {
+        // If we are past the end of the buffer, then there is
+        // no Nth macro in the buffer.
+        if (p == end) {
+            return;
+        }
+        if (eeprom_read_byte(p) == 0) {
+            --id;
+        }
+        ++p;
+    }
+
+#ifdef DYNAMIC_KEYMAP_MACRO_BYTECODE
+    uint16_t address = (uint8_t *)p - DYNAMIC_KEYMAP_MACRO_BUFFER;
+    macro_reader_seek(address);
+#endif
+#ifdef SEND_STRING_ASYNC_ENABLE
+    // Queue the macro straight out of EEPROM, it is played back from the main loop.
+    if (!send_string_async_with_reader((const char *)p, DYNAMIC_KEYMAP_MACRO_DELAY, dynamic_keymap_macro_read)) {
+        // Too long for the room left in the queue, so it is sent straight away once everything ahead of it has been.
+        send_string_async_flush();
+#    ifdef DYNAMIC_KEYMAP_MACRO_BYTECODE
+        macro_reader_seek(address);
+#    endif
+        dynamic_keymap_macro_play(p);
+    }
+#else
+    dynamic_keymap_macro_play(p);
+#endif
+#ifdef DYNAMIC_KEYMAP_MACRO_BYTECODE
+    // Leave the reader where the host expects to find it
+    macro_reader_reset();
+#endif
+}
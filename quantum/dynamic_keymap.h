@@ -67,4 +67,38 @@ void     dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t
 void     dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 void     dynamic_keymap_macro_reset(void);
 
+#ifdef DYNAMIC_KEYMAP_MACRO_BYTECODE
+// Note regarding the bytecode macro format:
+// A macro is played back as a text macro (as above) until a
+// DYNAMIC_KEYMAP_MACRO_OP_BYTECODE byte is reached, the rest of the macro
+// up to its null terminator is then played back as bytecode.
+//
+// In bytecode, bytes below 0x80 are ASCII characters typed out with send_char(),
+// and bytes from 0x80 up are opcodes, followed by their arguments.
+// Numeric arguments are unsigned LEB128 varints (7 bits per byte, least
+// significant group first, high bit set on all but the last byte).
+// Zero-valued arguments are never encoded, so bytecode never contains a null
+// byte and the buffer can still be walked macro by macro.
+//
+// The text buffer functions below convert to and from the text format
+// VIA expects, so the host only ever sees text macros. UTF-8 characters are
+// stored as Unicode opcodes, and runs of the same character as repeats.
+// Writes must be sequential, starting at offset zero, like VIA does.
+// dynamic_keymap_macro_set_text_buffer() returns false for a write that is
+// out of order, or once the converted macros no longer fit.
+enum dynamic_keymap_macro_opcode {
+    DYNAMIC_KEYMAP_MACRO_OP_BYTECODE = 0x80, // switches the macro to bytecode
+    DYNAMIC_KEYMAP_MACRO_OP_TAP,             // keycode
+    DYNAMIC_KEYMAP_MACRO_OP_DOWN,            // keycode
+    DYNAMIC_KEYMAP_MACRO_OP_UP,              // keycode
+    DYNAMIC_KEYMAP_MACRO_OP_DELAY,           // varint milliseconds
+    DYNAMIC_KEYMAP_MACRO_OP_UNICODE,         // varint code point
+    DYNAMIC_KEYMAP_MACRO_OP_REPEAT,          // varint count, varint length, then length bytes played count times
+};
+
+uint16_t dynamic_keymap_macro_get_text_buffer_size(void);
+void     dynamic_keymap_macro_get_text_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+bool     dynamic_keymap_macro_set_text_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+#endif // DYNAMIC_KEYMAP_MACRO_BYTECODE
+
 void dynamic_keymap_macro_send(uint8_t id);
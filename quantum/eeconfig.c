@@ -4,6 +4,7 @@
 #include "eeprom.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "timer.h"
 
 #if defined(EEPROM_DRIVER)
 #    include "eeprom_driver.h"
@@ -19,6 +20,78 @@ void via_eeprom_set_valid(bool valid);
 void eeconfig_init_via(void);
 #endif
 
+static eeconfig_block_t *eeconfig_blocks        = NULL;
+static bool              eeconfig_flush_pending = false;
+static uint16_t          eeconfig_last_change   = 0;
+
+/** \brief eeconfig flag block
+ *
+ * Marks a config block as needing to be written out, registering it if this is the first time it's been flagged.
+ */
+void eeconfig_flag_block(eeconfig_block_t *block) {
+    eeconfig_block_t *b = eeconfig_blocks;
+    while (b && b != block) {
+        b = b->next;
+    }
+    if (!b) {
+        block->next     = eeconfig_blocks;
+        eeconfig_blocks = block;
+    }
+
+    block->dirty           = true;
+    eeconfig_flush_pending = true;
+    eeconfig_last_change   = timer_read();
+}
+
+/** \brief eeconfig flush block
+ *
+ * Writes out a single config block straight away, if it's dirty or `force` is set.
+ */
+void eeconfig_flush_block(eeconfig_block_t *block, bool force) {
+    if (force || block->dirty) {
+        block->dirty = false;
+        block->write();
+    }
+}
+
+/** \brief eeconfig flush all
+ *
+ * Writes out every dirty config block straight away, in a single EEPROM transaction.
+ */
+void eeconfig_flush_all(void) {
+    if (!eeconfig_flush_pending) {
+        return;
+    }
+    eeconfig_flush_pending = false;
+
+    eeprom_transaction_begin();
+    for (eeconfig_block_t *b = eeconfig_blocks; b; b = b->next) {
+        eeconfig_flush_block(b, false);
+    }
+    eeprom_transaction_commit();
+}
+
+/** \brief eeconfig discard all
+ *
+ * Drops any pending writes, as the EEPROM is being reset underneath them.
+ */
+static void eeconfig_discard_all(void) {
+    for (eeconfig_block_t *b = eeconfig_blocks; b; b = b->next) {
+        b->dirty = false;
+    }
+    eeconfig_flush_pending = false;
+}
+
+/** \brief eeconfig task
+ *
+ * Writes out dirty config blocks once settings have stopped changing for EECONFIG_FLUSH_TIMEOUT milliseconds.
+ */
+void eeconfig_task(void) {
+    if (eeconfig_flush_pending && timer_elapsed(eeconfig_last_change) >= (EECONFIG_FLUSH_TIMEOUT)) {
+        eeconfig_flush_all();
+    }
+}
+
 /** \brief eeconfig enable
  *
  * FIXME: needs doc
@@ -43,10 +116,14 @@ __attribute__((weak)) void eeconfig_init_kb(void) {
  * FIXME: needs doc
  */
 void eeconfig_init_quantum(void) {
+    eeconfig_discard_all();
 #if defined(EEPROM_DRIVER)
     eeprom_driver_erase();
 #endif
 
+    // Everything below is written out in one go
+    eeprom_transaction_begin();
+
     eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
     eeprom_update_byte(EECONFIG_DEBUG, 0);
     eeprom_update_byte(EECONFIG_DEFAULT_LAYER, 0);
@@ -84,6 +161,8 @@ void eeconfig_init_quantum(void) {
 #endif
 
     eeconfig_init_kb();
+
+    eeprom_transaction_commit();
 }
 
 /** \brief eeconfig initialization
@@ -107,6 +186,7 @@ void eeconfig_enable(void) {
  * FIXME: needs doc
  */
 void eeconfig_disable(void) {
+    eeconfig_discard_all();
 #if defined(EEPROM_DRIVER)
     eeprom_driver_erase();
 #endif
@@ -144,44 +144,76 @@ void eeconfig_update_user_datablock(const void *data);
 void eeconfig_init_user_datablock(void);
 #endif // (EECONFIG_USER_DATA_SIZE) > 0
 
+// Time since the last settings change before dirty config blocks are written out
+#ifndef EECONFIG_FLUSH_TIMEOUT
+#    define EECONFIG_FLUSH_TIMEOUT 5000
+#endif
+
+/**
+ * A config block whose RAM copy is written back to EEPROM once it has settled, rather than on every change.
+ * Blocks are registered the first time they're flagged as dirty.
+ */
+typedef struct eeconfig_block_t {
+    struct eeconfig_block_t *next;
+    void (*write)(void); // writes the RAM copy out to EEPROM
+    bool dirty;
+} eeconfig_block_t;
+
+void eeconfig_flag_block(eeconfig_block_t *block);
+void eeconfig_flush_block(eeconfig_block_t *block, bool force);
+void eeconfig_flush_all(void);
+void eeconfig_task(void);
+
+// Defers writes of a config value that already has an immediate eeconfig_update_* style function, which is passed as `writer`.
+// Provides:
+//    -- void eeconfig_flag_##name(bool v)
+//    -- void eeconfig_flush_##name(bool force)
+#define EECONFIG_DEFERRED_HELPER(name, writer)                         \
+    static eeconfig_block_t eeconfig_block_##name = {.write = writer}; \
+                                                                       \
+    void eeconfig_flag_##name(bool v) {                                \
+        if (v) {                                                       \
+            eeconfig_flag_block(&eeconfig_block_##name);               \
+        }                                                              \
+    }                                                                  \
+    void eeconfig_flush_##name(bool force) {                           \
+        eeconfig_flush_block(&eeconfig_block_##name, force);           \
+    }
+
 // Any "checked" debounce variant used requires implementation of:
 //    -- bool eeconfig_check_valid_##name(void)
 //    -- void eeconfig_post_flush_##name(void)
-#define EECONFIG_DEBOUNCE_HELPER_CHECKED(name, offset, config)          \
-    static uint8_t dirty_##name = false;                                \
-                                                                        \
-    bool eeconfig_check_valid_##name(void);                             \
-    void eeconfig_post_flush_##name(void);                              \
-                                                                        \
-    static inline void eeconfig_init_##name(void) {                     \
-        dirty_##name = true;                                            \
-        if (eeconfig_check_valid_##name()) {                            \
-            eeprom_read_block(&config, offset, sizeof(config));         \
-            dirty_##name = false;                                       \
-        }                                                               \
-    }                                                                   \
-    static inline void eeconfig_flush_##name(bool force) {              \
-        if (force || dirty_##name) {                                    \
-            eeprom_update_block(&config, offset, sizeof(config));       \
-            eeconfig_post_flush_##name();                               \
-            dirty_##name = false;                                       \
-        }                                                               \
-    }                                                                   \
-    static inline void eeconfig_flush_##name##_task(uint16_t timeout) { \
-        static uint16_t flush_timer = 0;                                \
-        if (timer_elapsed(flush_timer) > timeout) {                     \
-            eeconfig_flush_##name(false);                               \
-            flush_timer = timer_read();                                 \
-        }                                                               \
-    }                                                                   \
-    static inline void eeconfig_flag_##name(bool v) {                   \
-        dirty_##name |= v;                                              \
-    }                                                                   \
-    static inline void eeconfig_write_##name(typeof(config) *conf) {    \
-        if (memcmp(&config, conf, sizeof(config)) != 0) {               \
-            memcpy(&config, conf, sizeof(config));                      \
-            eeconfig_flag_##name(true);                                 \
-        }                                                               \
+#define EECONFIG_DEBOUNCE_HELPER_CHECKED(name, offset, config)                              \
+    bool eeconfig_check_valid_##name(void);                                                 \
+    void eeconfig_post_flush_##name(void);                                                  \
+                                                                                            \
+    static void eeconfig_write_block_##name(void) {                                         \
+        eeprom_update_block(&config, offset, sizeof(config));                               \
+        eeconfig_post_flush_##name();                                                       \
+    }                                                                                       \
+    static eeconfig_block_t eeconfig_block_##name = {.write = eeconfig_write_block_##name}; \
+                                                                                            \
+    static inline void eeconfig_init_##name(void) {                                         \
+        if (eeconfig_check_valid_##name()) {                                                \
+            eeprom_read_block(&config, offset, sizeof(config));                             \
+            eeconfig_block_##name.dirty = false;                                            \
+        } else {                                                                            \
+            eeconfig_flag_block(&eeconfig_block_##name);                                    \
+        }                                                                                   \
+    }                                                                                       \
+    static inline void eeconfig_flush_##name(bool force) {                                  \
+        eeconfig_flush_block(&eeconfig_block_##name, force);                                \
+    }                                                                                       \
+    static inline void eeconfig_flag_##name(bool v) {                                       \
+        if (v) {                                                                            \
+            eeconfig_flag_block(&eeconfig_block_##name);                                    \
+        }                                                                                   \
+    }                                                                                       \
+    static inline void eeconfig_write_##name(typeof(config) *conf) {                        \
+        if (memcmp(&config, conf, sizeof(config)) != 0) {                                   \
+            memcpy(&config, conf, sizeof(config));                                          \
+            eeconfig_flag_##name(true);                                                     \
+        }                                                                                   \
     }
 
 #define EECONFIG_DEBOUNCE_HELPER(name, offset, config)     \
@@ -54,6 +54,8 @@ typedef enum HAPTIC_FEEDBACK {
 void    haptic_init(void);
 void    haptic_task(void);
 void    eeconfig_debug_haptic(void);
+void    eeconfig_flag_haptic(bool v);
+void    eeconfig_flush_haptic(bool force);
 void    haptic_enable(void);
 void    haptic_disable(void);
 void    haptic_toggle(void);
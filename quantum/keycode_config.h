@@ -50,3 +50,6 @@ typedef union {
 _Static_assert(sizeof(keymap_config_t) == sizeof(uint16_t), "Keycode (magic) EECONFIG out of spec.");
 
 extern keymap_config_t keymap_config;
+
+void eeconfig_flag_keymap(bool v);
+void eeconfig_flush_keymap(bool force);
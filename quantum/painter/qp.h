@@ -36,6 +36,31 @@
 #    define QUANTUM_PAINTER_NUM_IMAGES 8
 #endif // QUANTUM_PAINTER_NUM_IMAGES
 
+#ifndef QUANTUM_PAINTER_IMAGE_FRAME_METADATA_ENTRIES
+/**
+ * @def This controls the number of image frames whose metadata (frame offsets, delta regions, palette locations) is
+ *      parsed once when an image is loaded, shared amongst all loaded images. Frames of images that do not fit are
+ *      located by re-reading the image's descriptors each time they are drawn. Set to 0 to disable.
+ */
+#    define QUANTUM_PAINTER_IMAGE_FRAME_METADATA_ENTRIES 16
+#endif // QUANTUM_PAINTER_IMAGE_FRAME_METADATA_ENTRIES
+
+#ifndef QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE
+/**
+ * @def This controls the amount of RAM (in bytes) used to hold animation frames pre-decoded into the display's native
+ *      pixel format. Frames are decoded when \ref qp_animate is called, and frames found in the cache are transferred
+ *      to the display without reading or decoding the image. Set to 0 to disable the animation frame cache.
+ */
+#    define QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_ENTRIES
+/**
+ * @def This controls the maximum number of frames held in the animation frame cache at any one time.
+ */
+#    define QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_ENTRIES 16
+#endif // QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_ENTRIES
+
 #ifndef QUANTUM_PAINTER_NUM_FONTS
 /**
  * @def This controls the maximum number of fonts that Quantum Painter can load. Fonts can be loaded using
@@ -56,6 +81,23 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the amount of RAM (in bytes) used to cache decoded font glyphs in the display's native pixel
+ *      format. Glyphs found in the cache are transferred to the display without reading or decoding the font. Set
+ *      to 0 to disable the glyph cache.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+/**
+ * @def This controls the maximum number of glyphs held in the glyph cache at any one time. The least recently used
+ *      glyph is evicted when either this or \ref QUANTUM_PAINTER_GLYPH_CACHE_SIZE is exceeded.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES 32
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -72,6 +114,15 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+/**
+ * @def This controls whether two pixel data buffers are used, so that the next block of pixel data can be decoded while
+ *      the previous block is still being transmitted. Only benefits comms drivers capable of asynchronous transfers,
+ *      such as SPI on ChibiOS, and doubles the RAM used by the pixel data buffer.
+ */
+#    define QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER FALSE
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -88,6 +139,14 @@
 #    define QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+/**
+ * @def This controls whether images compressed with QMK LZ can be decoded. Decoding requires a 256-byte window of
+ *      previously-decoded data to be kept in RAM, so images need to be converted with `--lz` to make use of it.
+ */
+#    define QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION FALSE
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter types
 
@@ -10,8 +10,19 @@
 // Quantum Painter utility functions
 
 // Global variable used for native pixel data streaming.
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+extern uint8_t *qp_internal_global_pixdata_buffer;
+
+// Switches to the other pixdata buffer, so the one just handed to the driver can finish transmitting while the next is filled.
+void qp_internal_swap_pixdata_buffer(void);
+#else
 extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
 
+#    define qp_internal_swap_pixdata_buffer() \
+        do {                                  \
+        } while (0)
+#endif
+
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
 
@@ -24,13 +35,36 @@ void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint
 // qp_setpixel internal implementation, but uses the global pixdata buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 
-// qp_rect internal implementation, but uses the global pixdata buffer with pre-converted native pixels.
+// qp_rect internal implementation, but uses the global pixdata buffer with pre-converted native pixels. The buffer must either be filled with enough
+// pixels for the rect, or filled entirely. Drivers with a fill function are given the colour last supplied to qp_internal_fill_pixdata() instead.
 bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 
-// Convert from input pixel data + palette to equivalent pixels
-typedef int16_t (*qp_internal_byte_input_callback)(void* cb_arg);
-typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t index, void* cb_arg);
-typedef bool (*qp_internal_byte_output_callback)(uint8_t byte, void* cb_arg);
+// Batches horizontal spans for drawing filled shapes. Spans with the same extents on adjacent rows are combined into a single rect, and spans that
+// widen the most recent row replace it, so each shape is drawn with as few viewport changes as possible. Uses qp_internal_fillrect_helper_impl().
+typedef struct qp_internal_span_batch_t {
+    painter_device_t device;
+    bool             pending;
+    uint16_t         l;
+    uint16_t         t;
+    uint16_t         r;
+    uint16_t         b;
+} qp_internal_span_batch_t;
+
+bool qp_internal_span_batch_add(qp_internal_span_batch_t* batch, uint16_t x0, uint16_t x1, uint16_t y);
+bool qp_internal_span_batch_flush(qp_internal_span_batch_t* batch);
+
+// Streams native pixels held in a caller-supplied buffer to the device's current viewport, through the pixdata buffer
+bool qp_internal_pixdata_from_buffer(painter_device_t device, const uint8_t* src, uint32_t pixel_count);
+
+// Number of bytes (and therefore palette indices) decoded at a time
+#define QP_INTERNAL_SPAN_SIZE 64
+
+// Convert from input pixel data + palette to equivalent pixels.
+// Data is passed around in spans -- if `repeated` is set, only the first element is valid and is repeated `count` times.
+// Input callbacks write up to `max_bytes` bytes into `span`, returning the number of bytes produced, or negative on failure.
+typedef int16_t (*qp_internal_byte_input_callback)(void* cb_arg, uint8_t* span, uint16_t max_bytes, bool* repeated);
+typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t* indices, uint32_t count, bool repeated, void* cb_arg);
+typedef bool (*qp_internal_byte_output_callback)(uint8_t* bytes, uint32_t count, bool repeated, void* cb_arg);
 bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_callback output_callback, void* output_arg);
 bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_pixel_output_callback output_callback, void* output_arg);
 bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_pixel_output_callback output_callback, void* output_arg);
@@ -51,6 +85,11 @@ bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888,
 // Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
 void qp_internal_invalidate_palette(void);
 
+// Records which asset palette the lookup table currently holds, already converted for the supplied device, so that it can be reused without reloading.
+// Cleared whenever the lookup table is regenerated or invalidated.
+void qp_internal_set_palette_owner(painter_device_t device, const void* asset, uint32_t offset);
+bool qp_internal_palette_owned_by(painter_device_t device, const void* asset, uint32_t offset);
+
 // Helper shared between image and font rendering -- sets up the global palette to match the palette block specified in the asset. Expects the stream to be positioned at the start of the block header.
 bool qp_internal_load_qgf_palette(qp_stream_t* stream, uint8_t bpp);
 
@@ -73,6 +112,12 @@ typedef struct qp_internal_byte_input_state_t {
             enum qp_internal_rle_mode_t mode;
             uint8_t                     remain; // number of bytes remaining in the current mode
         } rle;
+        // LZ-specific
+        struct {
+            bool     match;    // whether the current token copies from the window, rather than reading literals
+            uint8_t  remain;   // number of bytes remaining in the current token
+            uint16_t distance; // how far back in the window the current match copies from
+        } lz;
     };
 } qp_internal_byte_input_state_t;
 
@@ -82,7 +127,7 @@ typedef struct qp_internal_pixel_output_state_t {
     uint32_t         max_pixels;
 } qp_internal_pixel_output_state_t;
 
-bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg);
+bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t* indices, uint32_t count, bool repeated, void* cb_arg);
 
 typedef struct qp_internal_byte_output_state_t {
     painter_device_t device;
@@ -90,6 +135,16 @@ typedef struct qp_internal_byte_output_state_t {
     uint32_t         max_bytes;
 } qp_internal_byte_output_state_t;
 
-bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg);
+bool qp_internal_byte_appender(uint8_t* bytes, uint32_t count, bool repeated, void* cb_arg);
+
+// Output state used when decoding into a caller-supplied buffer in the device's native format, instead of the pixdata buffer
+typedef struct qp_internal_buffer_output_state_t {
+    painter_device_t device;
+    uint8_t*         target_buffer;
+    uint32_t         write_pos; // in pixels for the pixel appender, in bytes for the byte appender
+} qp_internal_buffer_output_state_t;
+
+bool qp_internal_buffer_pixel_appender(qp_pixel_t* palette, uint8_t* indices, uint32_t count, bool repeated, void* cb_arg);
+bool qp_internal_buffer_byte_appender(uint8_t* bytes, uint32_t count, bool repeated, void* cb_arg);
 
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression);
@@ -8,14 +8,16 @@
 #include "qp_draw.h"
 
 // Utilize 8-way symmetry to draw circles
-static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, qp_internal_span_batch_t *spans) {
     /*
     Circles have the property of 8-way symmetry, so eight pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
     represented by [centerx,centery].
 
     For filled circles, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
+    pixels with the same final value of y. These are batched into `spans`
+    (NULL for outlines), one batch per octant pair, so that rows with the
+    same extents are drawn as a single rect.
 
     Two special cases exist and have been optimized:
     1) offsetx == offsety (the final point), makes half the coordinates
@@ -36,17 +38,23 @@ static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uin
     int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
 
     if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, centerx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, centerx, ymy)) {
-            return false;
-        }
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, centery, xmy, centery)) {
+        if (spans) {
+            if (!qp_internal_span_batch_add(&spans[0], centerx, centerx, ypy)) {
+                return false;
+            }
+            if (!qp_internal_span_batch_add(&spans[1], centerx, centerx, ymy)) {
+                return false;
+            }
+            if (!qp_internal_span_batch_add(&spans[2], xpy, xmy, centery)) {
                 return false;
             }
         } else {
+            if (!qp_internal_setpixel_impl(device, centerx, ypy)) {
+                return false;
+            }
+            if (!qp_internal_setpixel_impl(device, centerx, ymy)) {
+                return false;
+            }
             if (!qp_internal_setpixel_impl(device, xpy, centery)) {
                 return false;
             }
@@ -55,11 +63,11 @@ static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uin
             }
         }
     } else if (offsetx == offsety) {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypy, xmy, ypy)) {
+        if (spans) {
+            if (!qp_internal_span_batch_add(&spans[0], xpy, xmy, ypy)) {
                 return false;
             }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymy, xmy, ymy)) {
+            if (!qp_internal_span_batch_add(&spans[1], xpy, xmy, ymy)) {
                 return false;
             }
         } else {
@@ -78,17 +86,17 @@ static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uin
         }
 
     } else {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
+        if (spans) {
+            if (!qp_internal_span_batch_add(&spans[0], xpx, xmx, ypy)) {
                 return false;
             }
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
+            if (!qp_internal_span_batch_add(&spans[1], xpx, xmx, ymy)) {
                 return false;
             }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypx, xmy, ypx)) {
+            if (!qp_internal_span_batch_add(&spans[2], xpy, xmy, ypx)) {
                 return false;
             }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymx, xmy, ymx)) {
+            if (!qp_internal_span_batch_add(&spans[3], xpy, xmy, ymx)) {
                 return false;
             }
         } else {
@@ -138,15 +146,19 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
     int16_t ycalc = (int16_t)radius;
     int16_t err   = ((5 - (radius >> 2)) >> 2);
 
-    qp_internal_fill_pixdata(device, (radius * 2) + 1, hue, sat, val);
+    // Filled circles are drawn as batched spans, which may cover multiple rows -- fill the whole pixdata buffer
+    qp_internal_fill_pixdata(device, filled ? qp_internal_num_pixels_in_buffer(device) : 1, hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_circle: fail (could not start comms)\n");
         return false;
     }
 
+    qp_internal_span_batch_t  spans[4] = {{.device = device}, {.device = device}, {.device = device}, {.device = device}};
+    qp_internal_span_batch_t *span_ptr = filled ? spans : NULL;
+
     bool ret = true;
-    if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
+    if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, span_ptr)) {
         ret = false;
     }
 
@@ -159,13 +171,20 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
                 ycalc--;
                 err += ((xcalc - ycalc) << 1) + 1;
             }
-            if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
+            if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, span_ptr)) {
                 ret = false;
                 break;
             }
         }
     }
 
+    // Draw whatever's left in the batches
+    for (int i = 0; i < 4; ++i) {
+        if (ret && !qp_internal_span_batch_flush(&spans[i])) {
+            ret = false;
+        }
+    }
+
     qp_dprintf("qp_circle: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret;
@@ -28,23 +28,60 @@ bool qp_internal_bpp_capable(uint8_t bits_per_pixel) {
     return true;
 }
 
+// Checks whether every pixel packed into the byte shares the same palette index
+static inline bool qp_internal_byte_is_uniform(uint8_t byteval, uint8_t bits_per_pixel) {
+    const uint8_t pixel_bitmask = (1 << bits_per_pixel) - 1;
+    uint8_t       replicated    = 0;
+    for (uint8_t q = 0; q < 8; q += bits_per_pixel) {
+        replicated = (replicated << bits_per_pixel) | (byteval & pixel_bitmask);
+    }
+    return replicated == byteval;
+}
+
 bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_callback output_callback, void* output_arg) {
     const uint8_t pixel_bitmask    = (1 << bits_per_pixel) - 1;
     const uint8_t pixels_per_byte  = 8 / bits_per_pixel;
     uint32_t      remaining_pixels = pixel_count; // don't try to derive from byte_count, we may not use an entire byte
+    uint8_t       span[QP_INTERNAL_SPAN_SIZE];
     while (remaining_pixels > 0) {
-        int16_t byteval = input_callback(input_arg);
-        if (byteval < 0) {
+        // Only ask for the bytes this call needs -- fonts continue reading the same stream for the next glyph
+        uint32_t remaining_bytes = (remaining_pixels + pixels_per_byte - 1) / pixels_per_byte;
+        uint16_t max_bytes       = QP_MIN(remaining_bytes, sizeof(span) / pixels_per_byte);
+        bool     repeated        = false;
+        int16_t  byte_count      = input_callback(input_arg, span, max_bytes, &repeated);
+        if (byte_count <= 0) {
             return false;
         }
-        uint8_t loop_pixels = remaining_pixels < pixels_per_byte ? remaining_pixels : pixels_per_byte;
-        for (uint8_t q = 0; q < loop_pixels; ++q) {
-            if (!output_callback(palette, byteval & pixel_bitmask, output_arg)) {
-                return false;
+
+        uint32_t loop_pixels = QP_MIN(remaining_pixels, ((uint32_t)byte_count) * pixels_per_byte);
+        remaining_pixels -= loop_pixels;
+
+        if (repeated) {
+            // Repeated bytes made up of a single palette index become a fill
+            if (qp_internal_byte_is_uniform(span[0], bits_per_pixel)) {
+                uint8_t index = span[0] & pixel_bitmask;
+                if (!output_callback(palette, &index, loop_pixels, true, output_arg)) {
+                    return false;
+                }
+                continue;
             }
-            byteval >>= bits_per_pixel;
+            memset(span, span[0], byte_count);
+        }
+
+        // Unpack in-place into palette indices, working backwards so no byte is overwritten before it's been read
+        if (pixels_per_byte > 1) {
+            for (int16_t i = byte_count - 1; i >= 0; --i) {
+                uint8_t byteval = span[i];
+                for (uint8_t q = 0; q < pixels_per_byte; ++q) {
+                    span[i * pixels_per_byte + q] = byteval & pixel_bitmask;
+                    byteval >>= bits_per_pixel;
+                }
+            }
+        }
+
+        if (!output_callback(palette, span, loop_pixels, false, output_arg)) {
+            return false;
         }
-        remaining_pixels -= loop_pixels;
     }
     return true;
 }
@@ -67,103 +104,228 @@ bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, u
 
 bool qp_internal_send_bytes(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_byte_output_callback output_callback, void* output_arg) {
     uint32_t remaining_bytes = byte_count;
+    uint8_t  span[QP_INTERNAL_SPAN_SIZE];
     while (remaining_bytes > 0) {
-        int16_t byteval = input_callback(input_arg);
-        if (byteval < 0) {
+        bool    repeated   = false;
+        int16_t span_count = input_callback(input_arg, span, QP_MIN(remaining_bytes, sizeof(span)), &repeated);
+        if (span_count <= 0) {
             return false;
         }
-        if (!output_callback(byteval, output_arg)) {
+        if (!output_callback(span, span_count, repeated, output_arg)) {
             return false;
         }
-        remaining_bytes -= 1;
+        remaining_bytes -= span_count;
     }
     return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Progressive pull of bytes, push of pixels
+// Progressive pull of byte spans, push of pixel spans
 
-static inline int16_t qp_drawimage_byte_uncompressed_decoder(void* cb_arg) {
+static int16_t qp_drawimage_byte_uncompressed_decoder(void* cb_arg, uint8_t* span, uint16_t max_bytes, bool* repeated) {
     qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
-    state->curr                           = qp_stream_get(state->src_stream);
-    return state->curr;
+    *repeated                             = false;
+    return qp_stream_read(span, 1, max_bytes, state->src_stream) == max_bytes ? (int16_t)max_bytes : -1;
 }
 
-static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
+static int16_t qp_drawimage_byte_rle_decoder(void* cb_arg, uint8_t* span, uint16_t max_bytes, bool* repeated) {
     qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
 
-    // Work out if we're parsing the initial marker byte
-    if (state->rle.mode == MARKER_BYTE) {
-        uint8_t c = qp_stream_get(state->src_stream);
+    // Work out if we're parsing the initial marker byte -- empty runs are skipped
+    while (state->rle.mode == MARKER_BYTE) {
+        int16_t c = qp_stream_get(state->src_stream);
+        if (c < 0) {
+            return -1;
+        }
         if (c >= 128) {
             state->rle.mode   = NON_REPEATING_RUN; // non-repeated run
             state->rle.remain = c - 127;
         } else {
             state->rle.mode   = REPEATING_RUN; // repeated run
             state->rle.remain = c;
+            state->curr       = qp_stream_get(state->src_stream);
+            if (state->curr < 0) {
+                return -1;
+            }
         }
+        if (state->rle.remain == 0) {
+            state->rle.mode = MARKER_BYTE;
+        }
+    }
+
+    // Hand back as much of the current run as will fit
+    uint16_t count = QP_MIN(state->rle.remain, max_bytes);
+    if (state->rle.mode == REPEATING_RUN) {
+        span[0]   = (uint8_t)state->curr;
+        *repeated = true;
+    } else {
+        if (qp_stream_read(span, 1, count, state->src_stream) != count) {
+            return -1;
+        }
+        *repeated = false;
+    }
 
-        state->curr = qp_stream_get(state->src_stream);
+    // Swap back to querying the marker byte mode once the run is exhausted
+    state->rle.remain -= count;
+    if (state->rle.remain == 0) {
+        state->rle.mode = MARKER_BYTE;
     }
 
-    // Work out which byte we're returning
-    uint8_t c = state->curr;
+    return count;
+}
+
+#if QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+// Window of the most recently decoded bytes -- matches copy from here. Only one stream is ever decoded at a time.
+static uint8_t qp_internal_lz_window[256];
+static uint8_t qp_internal_lz_window_pos;
 
-    // Decrement the counter of the bytes remaining
-    state->rle.remain--;
+static int16_t qp_drawimage_byte_lz_decoder(void* cb_arg, uint8_t* span, uint16_t max_bytes, bool* repeated) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
 
-    if (state->rle.remain > 0) {
-        // If we're in a non-repeating run, queue up the next byte
-        if (state->rle.mode == NON_REPEATING_RUN) {
-            state->curr = qp_stream_get(state->src_stream);
+    // Parse the next token if the previous one has been exhausted
+    if (state->lz.remain == 0) {
+        int16_t c = qp_stream_get(state->src_stream);
+        if (c < 0) {
+            return -1;
+        }
+        if (c >= 128) {
+            int16_t d = qp_stream_get(state->src_stream);
+            if (d < 0) {
+                return -1;
+            }
+            state->lz.match    = true;
+            state->lz.remain   = (c - 128) + 3;
+            state->lz.distance = d + 1;
+        } else {
+            state->lz.match  = false;
+            state->lz.remain = c + 1;
         }
+    }
+
+    uint16_t count = QP_MIN(state->lz.remain, max_bytes);
+    if (!state->lz.match) {
+        // Literals come straight from the stream
+        if (qp_stream_read(span, 1, count, state->src_stream) != count) {
+            return -1;
+        }
+        for (uint16_t i = 0; i < count; ++i) {
+            qp_internal_lz_window[qp_internal_lz_window_pos++] = span[i];
+        }
+        *repeated = false;
+    } else if (state->lz.distance == 1) {
+        // Matching the previous byte is a run of that byte, which can be handed back as a fill
+        span[0] = qp_internal_lz_window[(uint8_t)(qp_internal_lz_window_pos - 1)];
+        for (uint16_t i = 0; i < count; ++i) {
+            qp_internal_lz_window[qp_internal_lz_window_pos++] = span[0];
+        }
+        *repeated = true;
     } else {
-        // Swap back to querying the marker byte mode
-        state->rle.mode = MARKER_BYTE;
+        // Matches may overlap the bytes they produce, so copy one byte at a time
+        for (uint16_t i = 0; i < count; ++i) {
+            span[i]                                            = qp_internal_lz_window[(uint8_t)(qp_internal_lz_window_pos - state->lz.distance)];
+            qp_internal_lz_window[qp_internal_lz_window_pos++] = span[i];
+        }
+        *repeated = false;
     }
 
-    return c;
+    state->lz.remain -= count;
+    return count;
 }
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
 
-bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
+bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t* indices, uint32_t count, bool repeated, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
 
-    if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos++, 1, &index)) {
-        return false;
+    // Fills are expanded into a span of identical indices so that the driver can still append them in bulk
+    uint8_t fill[QP_INTERNAL_SPAN_SIZE];
+    if (repeated) {
+        memset(fill, indices[0], QP_MIN(count, sizeof(fill)));
     }
 
-    // If we've hit the transmit limit, send out the entire buffer and reset the write position
-    if (state->pixel_write_pos == state->max_pixels) {
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+    while (count > 0) {
+        uint32_t span_count = QP_MIN(count, state->max_pixels - state->pixel_write_pos);
+        if (repeated) {
+            span_count = QP_MIN(span_count, sizeof(fill));
+        }
+
+        if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos, span_count, repeated ? fill : indices)) {
             return false;
         }
-        state->pixel_write_pos = 0;
+        state->pixel_write_pos += span_count;
+        count -= span_count;
+        if (!repeated) {
+            indices += span_count;
+        }
+
+        // If we've hit the transmit limit, send out the entire buffer and reset the write position
+        if (state->pixel_write_pos == state->max_pixels) {
+            if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+                return false;
+            }
+            qp_internal_swap_pixdata_buffer();
+            state->pixel_write_pos = 0;
+        }
     }
 
     return true;
 }
 
-bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
+bool qp_internal_byte_appender(uint8_t* bytes, uint32_t count, bool repeated, void* cb_arg) {
     qp_internal_byte_output_state_t* state  = (qp_internal_byte_output_state_t*)cb_arg;
     painter_driver_t*                driver = (painter_driver_t*)state->device;
 
-    if (!driver->driver_vtable->append_pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos++, byteval)) {
-        return false;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (!driver->driver_vtable->append_pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos++, repeated ? bytes[0] : bytes[i])) {
+            return false;
+        }
+
+        // If we've hit the transmit limit, send out the entire buffer and reset the write position
+        if (state->byte_write_pos == state->max_bytes) {
+            if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+                return false;
+            }
+            qp_internal_swap_pixdata_buffer();
+            state->byte_write_pos = 0;
+        }
     }
 
-    // If we've hit the transmit limit, send out the entire buffer and reset the write position
-    if (state->byte_write_pos == state->max_bytes) {
-        painter_driver_t* driver = (painter_driver_t*)state->device;
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+    return true;
+}
+
+bool qp_internal_buffer_pixel_appender(qp_pixel_t* palette, uint8_t* indices, uint32_t count, bool repeated, void* cb_arg) {
+    qp_internal_buffer_output_state_t* state  = (qp_internal_buffer_output_state_t*)cb_arg;
+    painter_driver_t*                  driver = (painter_driver_t*)state->device;
+
+    // Fills are expanded into a span of identical indices so that the driver can still append them in bulk
+    uint8_t fill[QP_INTERNAL_SPAN_SIZE];
+    if (repeated) {
+        memset(fill, indices[0], QP_MIN(count, sizeof(fill)));
+    }
+
+    while (count > 0) {
+        uint32_t span_count = repeated ? QP_MIN(count, sizeof(fill)) : count;
+        if (!driver->driver_vtable->append_pixels(state->device, state->target_buffer, palette, state->write_pos, span_count, repeated ? fill : indices)) {
             return false;
         }
-        state->byte_write_pos = 0;
+        state->write_pos += span_count;
+        count -= span_count;
     }
 
     return true;
 }
 
+bool qp_internal_buffer_byte_appender(uint8_t* bytes, uint32_t count, bool repeated, void* cb_arg) {
+    qp_internal_buffer_output_state_t* state = (qp_internal_buffer_output_state_t*)cb_arg;
+    if (repeated) {
+        memset(&state->target_buffer[state->write_pos], bytes[0], count);
+    } else {
+        memcpy(&state->target_buffer[state->write_pos], bytes, count);
+    }
+    state->write_pos += count;
+    return true;
+}
+
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression) {
     switch (compression) {
         case IMAGE_UNCOMPRESSED:
@@ -172,6 +334,14 @@ qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte
             input_state->rle.mode   = MARKER_BYTE;
             input_state->rle.remain = 0;
             return qp_drawimage_byte_rle_decoder;
+#if QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+        case IMAGE_COMPRESSED_LZ:
+            input_state->lz.match     = false;
+            input_state->lz.remain    = 0;
+            input_state->lz.distance  = 0;
+            qp_internal_lz_window_pos = 0;
+            return qp_drawimage_byte_lz_decoder;
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
         default:
             return NULL;
     }
@@ -20,7 +20,13 @@ _Static_assert((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIX
 //
 
 // Buffer used for transmitting native pixel data to the downstream device.
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+// Two buffers are used in turn, one is filled while the other is being transmitted.
+__attribute__((__aligned__(4))) static uint8_t qp_internal_pixdata_buffers[2][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+uint8_t *                                      qp_internal_global_pixdata_buffer = qp_internal_pixdata_buffers[0];
+#else
 __attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif
 
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
@@ -33,6 +39,14 @@ __attribute__((__aligned__(4))) qp_pixel_t qp_internal_global_pixel_lookup_table
 __attribute__((__aligned__(4))) qp_pixel_t qp_internal_global_pixel_lookup_table[16];
 #endif
 
+// Native colour most recently generated by qp_internal_fill_pixdata, for drivers capable of filling a region directly
+static qp_pixel_t fill_native_color;
+
+// Asset palette currently held in the lookup table, if any
+static painter_device_t palette_owner_device = NULL;
+static const void *     palette_owner_asset  = NULL;
+static uint32_t         palette_owner_offset = 0;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helpers
 
@@ -41,6 +55,12 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
 }
 
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+void qp_internal_swap_pixdata_buffer(void) {
+    qp_internal_global_pixdata_buffer = (qp_internal_global_pixdata_buffer == qp_internal_pixdata_buffers[0]) ? qp_internal_pixdata_buffers[1] : qp_internal_pixdata_buffers[0];
+}
+#endif
+
 // qp_setpixel internal implementation, but accepts a buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y) {
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -56,18 +76,56 @@ void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint
     // Convert the color to native pixel format
     qp_pixel_t color = {.hsv888 = {.h = hue, .s = sat, .v = val}};
     driver->driver_vtable->palette_convert(device, 1, &color);
+    fill_native_color = color;
+
+    // Append the first few pixels -- eight pixels always occupy a whole number of bytes, regardless of the native pixel format
+    uint8_t  palette_indices[8] = {0};
+    uint32_t seeded             = QP_MIN(num_pixels, sizeof(palette_indices));
+    driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, &color, 0, seeded, palette_indices);
+
+    // ...then keep doubling them up until the required number of pixels is reached
+    uint32_t filled_bytes = (seeded * driver->native_bits_per_pixel + 7) / 8;
+    uint32_t total_bytes  = (num_pixels * driver->native_bits_per_pixel + 7) / 8;
+    while (filled_bytes < total_bytes) {
+        uint32_t copy_bytes = QP_MIN(filled_bytes, total_bytes - filled_bytes);
+        memcpy(&qp_internal_global_pixdata_buffer[filled_bytes], qp_internal_global_pixdata_buffer, copy_bytes);
+        filled_bytes += copy_bytes;
+    }
+}
 
-    // Append the required number of pixels
-    uint8_t palette_idx = 0;
-    for (uint32_t i = 0; i < num_pixels; ++i) {
-        driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, &color, i, 1, &palette_idx);
+// Streams pre-converted native pixels to the device, copying through the pixdata buffer so the source can be modified while it's in flight
+bool qp_internal_pixdata_from_buffer(painter_device_t device, const uint8_t *src, uint32_t pixel_count) {
+    painter_driver_t *driver     = (painter_driver_t *)device;
+    const uint32_t    max_pixels = qp_internal_num_pixels_in_buffer(device);
+    while (pixel_count > 0) {
+        uint32_t pixels     = QP_MIN(pixel_count, max_pixels);
+        uint32_t byte_count = (pixels * driver->native_bits_per_pixel + 7) / 8;
+        memcpy(qp_internal_global_pixdata_buffer, src, byte_count);
+        if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, pixels)) {
+            return false;
+        }
+        qp_internal_swap_pixdata_buffer();
+        src += byte_count;
+        pixel_count -= pixels;
     }
+    return true;
 }
 
 // Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
 void qp_internal_invalidate_palette(void) {
-    generated_palette = false;
-    generated_steps   = -1;
+    generated_palette   = false;
+    generated_steps     = -1;
+    palette_owner_asset = NULL;
+}
+
+void qp_internal_set_palette_owner(painter_device_t device, const void *asset, uint32_t offset) {
+    palette_owner_device = device;
+    palette_owner_asset  = asset;
+    palette_owner_offset = offset;
+}
+
+bool qp_internal_palette_owned_by(painter_device_t device, const void *asset, uint32_t offset) {
+    return asset && palette_owner_asset == asset && palette_owner_device == device && palette_owner_offset == offset;
 }
 
 // Interpolates between two colors to generate a palette
@@ -84,6 +142,7 @@ bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888,
     generated_steps        = steps;
     interpolated_fg_hsv888 = fg_hsv888;
     interpolated_bg_hsv888 = bg_hsv888;
+    palette_owner_asset    = NULL;
 
     int16_t hue_fg = fg_hsv888.hsv888.h;
     int16_t hue_bg = bg_hsv888.hsv888.h;
@@ -185,7 +244,8 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
         return false;
     }
 
-    qp_internal_fill_pixdata(device, 1, hue, sat, val);
+    // Fill the whole pixdata buffer, as runs of pixels are drawn as spans
+    qp_internal_fill_pixdata(device, qp_internal_num_pixels_in_buffer(device), hue, sat, val);
 
     // draw angled line using Bresenham's algo
     int16_t x      = ((int16_t)x0);
@@ -198,13 +258,15 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
     int16_t e  = dx + dy;
     int16_t e2 = 2 * e;
 
+    // Consecutive pixels along the same row or column are drawn as a single span, rather than pixel by pixel
+    int16_t run_x = x;
+    int16_t run_y = y;
+
     bool ret = true;
     while (x != x1 || y != y1) {
-        if (!qp_internal_setpixel_impl(device, x, y)) {
-            ret = false;
-            break;
-        }
-        e2 = 2 * e;
+        int16_t last_x = x;
+        int16_t last_y = y;
+        e2             = 2 * e;
         if (e2 >= dy) {
             e += dy;
             x += slopex;
@@ -213,9 +275,20 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
             e += dx;
             y += slopey;
         }
+
+        // Draw the current run if this step didn't continue along it, and start a new one
+        bool extends_run = (y == last_y && run_y == last_y) || (x == last_x && run_x == last_x);
+        if (!extends_run) {
+            if (!qp_internal_fillrect_helper_impl(device, run_x, run_y, last_x, last_y)) {
+                ret = false;
+                break;
+            }
+            run_x = x;
+            run_y = y;
+        }
     }
-    // draw the last pixel
-    if (!qp_internal_setpixel_impl(device, x, y)) {
+    // draw the last run
+    if (ret && !qp_internal_fillrect_helper_impl(device, run_x, run_y, x, y)) {
         ret = false;
     }
 
@@ -238,6 +311,11 @@ bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t left, ui
     uint16_t w = r - l + 1;
     uint16_t h = b - t + 1;
 
+    // Let the driver fill the region itself if it can, no need to stream any pixels
+    if (driver->driver_vtable->fill) {
+        return driver->driver_vtable->fill(device, l, t, r, b, fill_native_color);
+    }
+
     uint32_t remaining = w * h;
     driver->driver_vtable->viewport(device, l, t, r, b);
     while (remaining > 0) {
@@ -250,6 +328,56 @@ bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t left, ui
     return true;
 }
 
+bool qp_internal_span_batch_add(qp_internal_span_batch_t *batch, uint16_t x0, uint16_t x1, uint16_t y) {
+    uint16_t l = QP_MIN(x0, x1);
+    uint16_t r = QP_MAX(x0, x1);
+
+    if (batch->pending) {
+        // Redrawing the most recent row, only wider -- replace it
+        if (batch->t == y && batch->b == y && l <= batch->l && r >= batch->r) {
+            batch->l = l;
+            batch->r = r;
+            return true;
+        }
+
+        // Already covered by the pending rect
+        if (y >= batch->t && y <= batch->b && l >= batch->l && r <= batch->r) {
+            return true;
+        }
+
+        // Same extents on an adjacent row, grow the pending rect
+        if (l == batch->l && r == batch->r) {
+            if (y == batch->b + 1) {
+                batch->b = y;
+                return true;
+            }
+            if (y + 1 == batch->t) {
+                batch->t = y;
+                return true;
+            }
+        }
+
+        if (!qp_internal_span_batch_flush(batch)) {
+            return false;
+        }
+    }
+
+    batch->pending = true;
+    batch->l       = l;
+    batch->t       = y;
+    batch->r       = r;
+    batch->b       = y;
+    return true;
+}
+
+bool qp_internal_span_batch_flush(qp_internal_span_batch_t *batch) {
+    if (!batch->pending) {
+        return true;
+    }
+    batch->pending = false;
+    return qp_internal_fillrect_helper_impl(batch->device, batch->l, batch->t, batch->r, batch->b);
+}
+
 bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
     qp_dprintf("qp_rect(%d, %d, %d, %d): entry\n", (int)left, (int)top, (int)right, (int)bottom);
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -7,14 +7,16 @@
 #include "qp_draw.h"
 
 // Utilize 4-way symmetry to draw an ellipse
-static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, qp_internal_span_batch_t *spans) {
     /*
     Ellipses have the property of 4-way symmetry, so four pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
     represented by [centerx,centery].
 
     For filled ellipses, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
+    pixels with the same final value of y. These are batched into `spans`
+    (NULL for outlines), one batch each above and below the center, so that
+    rows with the same extents are drawn as a single rect.
 
     When offsetx == 0 only two pixels can be drawn for filled or unfilled ellipses
     */
@@ -24,18 +26,18 @@ static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, ui
     int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
     int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
 
-    if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
+    if (spans) {
+        if (!qp_internal_span_batch_add(&spans[0], xpx, xmx, ypy)) {
             return false;
         }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
+        if (offsety > 0 && !qp_internal_span_batch_add(&spans[1], xpx, xmx, ymy)) {
             return false;
         }
-    } else if (filled) {
-        if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
+    } else if (offsetx == 0) {
+        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
             return false;
         }
-        if (offsety > 0 && !qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
+        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
             return false;
         }
     } else {
@@ -75,16 +77,20 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     int16_t dx = 0;
     int16_t dy = ((int16_t)sizey);
 
-    qp_internal_fill_pixdata(device, QP_MAX(sizex, sizey), hue, sat, val);
+    // Filled ellipses are drawn as batched spans, which may cover multiple rows -- fill the whole pixdata buffer
+    qp_internal_fill_pixdata(device, filled ? qp_internal_num_pixels_in_buffer(device) : 1, hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_ellipse: fail (could not start comms)\n");
         return false;
     }
 
+    qp_internal_span_batch_t  spans[2] = {{.device = device}, {.device = device}};
+    qp_internal_span_batch_t *span_ptr = filled ? spans : NULL;
+
     bool ret = true;
     for (int16_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
+        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, span_ptr)) {
             ret = false;
             break;
         }
@@ -99,7 +105,7 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     dy = 0;
 
     for (int16_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
+        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, span_ptr)) {
             ret = false;
             break;
         }
@@ -110,6 +116,13 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
         delta += aa * (4 * dy + 6);
     }
 
+    // Draw whatever's left in the batches
+    for (int i = 0; i < 2; ++i) {
+        if (ret && !qp_internal_span_batch_flush(&spans[i])) {
+            ret = false;
+        }
+    }
+
     qp_dprintf("qp_ellipse: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret;
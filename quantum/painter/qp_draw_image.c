@@ -10,9 +10,27 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QGF image handles
 
+typedef struct qgf_frame_info_t {
+    painter_compression_t compression_scheme;
+    uint8_t               bpp;
+    bool                  has_palette;
+    bool                  is_delta;
+    uint16_t              left;
+    uint16_t              top;
+    uint16_t              right;
+    uint16_t              bottom;
+    uint16_t              delay;
+    uint32_t              palette_offset; // location of the palette block, if present
+    uint32_t              data_offset;    // location of the pixel data, immediately after the data block header
+} qgf_frame_info_t;
+
 typedef struct qgf_image_handle_t {
     painter_image_desc_t base;
     bool                 validate_ok;
+#if QUANTUM_PAINTER_IMAGE_FRAME_METADATA_ENTRIES > 0
+    bool     has_frame_metadata;
+    uint16_t frame_metadata_first; // index of the first frame's metadata in the shared pool
+#endif // QUANTUM_PAINTER_IMAGE_FRAME_METADATA_ENTRIES > 0
     union {
         qp_stream_t        stream;
         qp_memory_stream_t mem_stream;
@@ -24,6 +42,115 @@ typedef struct qgf_image_handle_t {
 
 static qgf_image_handle_t image_descriptors[QUANTUM_PAINTER_NUM_IMAGES] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Frame metadata
+
+// Reads the descriptors of the requested frame from the image stream
+static bool qp_drawimage_read_frame_info(qgf_image_handle_t *qgf_image, uint16_t frame_number, qgf_frame_info_t *info) {
+    // Seek to the frame
+    qgf_seek_to_frame_descriptor(&qgf_image->stream, frame_number);
+
+    // Read the frame descriptor
+    qgf_frame_v1_t frame_descriptor;
+    if (qp_stream_read(&frame_descriptor, sizeof(qgf_frame_v1_t), 1, &qgf_image->stream) != 1) {
+        qp_dprintf("Failed to read frame_descriptor, expected length was not %d\n", (int)sizeof(qgf_frame_v1_t));
+        return false;
+    }
+
+    // Parse out the frame info
+    if (!qgf_parse_frame_descriptor(&frame_descriptor, &info->bpp, &info->has_palette, &info->is_delta, &info->compression_scheme, &info->delay)) {
+        return false;
+    }
+
+    // Skip over the palette, if any, it's loaded at render time
+    info->palette_offset = qp_stream_tell(&qgf_image->stream);
+    if (info->has_palette) {
+        qp_stream_seek(&qgf_image->stream, sizeof(qgf_palette_v1_t) + (1u << info->bpp) * sizeof(qgf_palette_entry_v1_t), SEEK_CUR);
+    }
+
+    // Handle delta if needed
+    if (info->is_delta) {
+        qgf_delta_v1_t delta_descriptor;
+        if (qp_stream_read(&delta_descriptor, sizeof(qgf_delta_v1_t), 1, &qgf_image->stream) != 1) {
+            qp_dprintf("Failed to read delta_descriptor, expected length was not %d\n", (int)sizeof(qgf_delta_v1_t));
+            return false;
+        }
+
+        info->left   = delta_descriptor.left;
+        info->top    = delta_descriptor.top;
+        info->right  = delta_descriptor.right;
+        info->bottom = delta_descriptor.bottom;
+    }
+
+    // Read the data block
+    qgf_data_v1_t data_descriptor;
+    if (qp_stream_read(&data_descriptor, sizeof(qgf_data_v1_t), 1, &qgf_image->stream) != 1) {
+        qp_dprintf("Failed to read data_descriptor, expected length was not %d\n", (int)sizeof(qgf_data_v1_t));
+        return false;
+    }
+
+    info->data_offset = qp_stream_tell(&qgf_image->stream);
+    return true;
+}
+
+#if QUANTUM_PAINTER_IMAGE_FRAME_METADATA_ENTRIES > 0
+
+// Metadata for each frame of the loaded images, parsed once at load time. Each image occupies a contiguous range.
+static qgf_frame_info_t frame_metadata[QUANTUM_PAINTER_IMAGE_FRAME_METADATA_ENTRIES];
+static uint16_t         frame_metadata_used = 0;
+
+static void qp_drawimage_load_frame_metadata(qgf_image_handle_t *qgf_image) {
+    qgf_image->has_frame_metadata = false;
+    if (qgf_image->base.frame_count > QUANTUM_PAINTER_IMAGE_FRAME_METADATA_ENTRIES - frame_metadata_used) {
+        qp_dprintf("qp_load_image: frame metadata pool full, frames will be located at render time\n");
+        return;
+    }
+
+    for (uint16_t i = 0; i < qgf_image->base.frame_count; ++i) {
+        if (!qp_drawimage_read_frame_info(qgf_image, i, &frame_metadata[frame_metadata_used + i])) {
+            return;
+        }
+    }
+
+    qgf_image->frame_metadata_first = frame_metadata_used;
+    qgf_image->has_frame_metadata   = true;
+    frame_metadata_used += qgf_image->base.frame_count;
+}
+
+static void qp_drawimage_free_frame_metadata(qgf_image_handle_t *qgf_image) {
+    if (!qgf_image->has_frame_metadata) {
+        return;
+    }
+
+    // Compact the pool, shuffling down the metadata of any images stored after this one
+    uint16_t first = qgf_image->frame_metadata_first;
+    uint16_t count = qgf_image->base.frame_count;
+    memmove(&frame_metadata[first], &frame_metadata[first + count], (frame_metadata_used - first - count) * sizeof(qgf_frame_info_t));
+    for (int i = 0; i < QUANTUM_PAINTER_NUM_IMAGES; ++i) {
+        if (image_descriptors[i].validate_ok && image_descriptors[i].has_frame_metadata && image_descriptors[i].frame_metadata_first > first) {
+            image_descriptors[i].frame_metadata_first -= count;
+        }
+    }
+    frame_metadata_used -= count;
+    qgf_image->has_frame_metadata = false;
+}
+
+#endif // QUANTUM_PAINTER_IMAGE_FRAME_METADATA_ENTRIES > 0
+
+static bool qp_drawimage_get_frame_info(qgf_image_handle_t *qgf_image, uint16_t frame_number, qgf_frame_info_t *info) {
+#if QUANTUM_PAINTER_IMAGE_FRAME_METADATA_ENTRIES > 0
+    if (qgf_image->has_frame_metadata) {
+        if (frame_number >= qgf_image->base.frame_count) {
+            qp_dprintf("Invalid frame number, was %d but only %d frames in image\n", (int)frame_number, (int)qgf_image->base.frame_count);
+            return false;
+        }
+        *info = frame_metadata[qgf_image->frame_metadata_first + frame_number];
+        return true;
+    }
+#endif // QUANTUM_PAINTER_IMAGE_FRAME_METADATA_ENTRIES > 0
+    return qp_drawimage_read_frame_info(qgf_image, frame_number, info);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load image from stream
 
@@ -59,6 +186,11 @@ static painter_image_handle_t qp_load_image_internal(bool (*stream_factory)(qgf_
     // Fill out the QP image descriptor
     qgf_read_graphics_descriptor(&image->stream, &image->base.width, &image->base.height, &image->base.frame_count, NULL);
 
+#if QUANTUM_PAINTER_IMAGE_FRAME_METADATA_ENTRIES > 0
+    // Parse the frame descriptors up front, so that rendering doesn't need to
+    qp_drawimage_load_frame_metadata(image);
+#endif // QUANTUM_PAINTER_IMAGE_FRAME_METADATA_ENTRIES > 0
+
     // Validation success, we can return the handle
     image->validate_ok = true;
     qp_dprintf("qp_load_image: ok\n");
@@ -85,6 +217,115 @@ painter_image_handle_t qp_load_image_mem(const void *buffer) {
     return qp_load_image_internal(image_mem_stream_factory, (void *)buffer);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Animation frame cache
+
+#if QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE > 0
+
+// Decoded frame, already converted to the native pixel format of the device it was rendered to
+typedef struct qgf_frame_cache_entry_t {
+    const qgf_image_handle_t *image; // NULL if the entry is unused
+    painter_device_t          device;
+    qp_pixel_t                fg_hsv888;
+    qp_pixel_t                bg_hsv888;
+    qgf_frame_info_t          info;
+    uint32_t                  last_used;
+    uint32_t                  offset; // location of the pixel data in the pool
+    uint32_t                  length; // number of bytes used in the pool, including alignment padding
+    uint16_t                  frame_number;
+} qgf_frame_cache_entry_t;
+
+static qgf_frame_cache_entry_t                 frame_cache_entries[QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_ENTRIES] = {0};
+__attribute__((__aligned__(4))) static uint8_t frame_cache_pool[QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE];
+static uint32_t                                frame_cache_pool_used = 0;
+static uint32_t                                frame_cache_clock     = 0;
+
+static inline bool qp_frame_cache_color_matches(qp_pixel_t a, qp_pixel_t b) {
+    return a.hsv888.h == b.hsv888.h && a.hsv888.s == b.hsv888.s && a.hsv888.v == b.hsv888.v;
+}
+
+// Checks whether the entry was rendered from the same image, for the same device and colours -- frames with their own palette or native pixels render identically regardless of the requested colours
+static bool qp_frame_cache_key_matches(const qgf_frame_cache_entry_t *entry, const qgf_image_handle_t *qgf_image, painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    return entry->image == qgf_image && entry->device == device && (entry->info.has_palette || entry->info.bpp > 8 || (qp_frame_cache_color_matches(entry->fg_hsv888, fg_hsv888) && qp_frame_cache_color_matches(entry->bg_hsv888, bg_hsv888)));
+}
+
+static qgf_frame_cache_entry_t *qp_frame_cache_find(const qgf_image_handle_t *qgf_image, painter_device_t device, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_ENTRIES; ++i) {
+        qgf_frame_cache_entry_t *entry = &frame_cache_entries[i];
+        if (entry->frame_number == frame_number && qp_frame_cache_key_matches(entry, qgf_image, device, fg_hsv888, bg_hsv888)) {
+            entry->last_used = ++frame_cache_clock;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void qp_frame_cache_remove(qgf_frame_cache_entry_t *entry) {
+    // Compact the pool, shuffling down anything stored after the removed frame
+    uint32_t end = entry->offset + entry->length;
+    memmove(&frame_cache_pool[entry->offset], &frame_cache_pool[end], frame_cache_pool_used - end);
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_ENTRIES; ++i) {
+        if (frame_cache_entries[i].image && frame_cache_entries[i].offset > entry->offset) {
+            frame_cache_entries[i].offset -= entry->length;
+        }
+    }
+    frame_cache_pool_used -= entry->length;
+    entry->image = NULL;
+}
+
+static void qp_frame_cache_invalidate_image(const qgf_image_handle_t *qgf_image) {
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_ENTRIES; ++i) {
+        if (frame_cache_entries[i].image == qgf_image) {
+            qp_frame_cache_remove(&frame_cache_entries[i]);
+        }
+    }
+}
+
+// Reserves space for a frame, evicting the least recently used frames as required. Frames belonging to the same animation are never evicted, otherwise
+// an animation too large for the cache would continually evict its own frames. Returns NULL if the frame cannot fit.
+static qgf_frame_cache_entry_t *qp_frame_cache_insert(const qgf_image_handle_t *qgf_image, painter_device_t device, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, const qgf_frame_info_t *info, uint32_t byte_count) {
+    uint32_t length = (byte_count + 3) & ~3u; // keep each frame aligned for native pixel access
+    if (length > QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE) {
+        return NULL;
+    }
+
+    while (true) {
+        qgf_frame_cache_entry_t *free_entry = NULL;
+        qgf_frame_cache_entry_t *lru_entry  = NULL;
+        for (uint8_t i = 0; i < QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_ENTRIES; ++i) {
+            qgf_frame_cache_entry_t *entry = &frame_cache_entries[i];
+            if (!entry->image) {
+                free_entry = entry;
+            } else if (!qp_frame_cache_key_matches(entry, qgf_image, device, fg_hsv888, bg_hsv888) && (!lru_entry || entry->last_used < lru_entry->last_used)) {
+                lru_entry = entry;
+            }
+        }
+
+        if (free_entry && frame_cache_pool_used + length <= QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE) {
+            *free_entry = (qgf_frame_cache_entry_t){
+                .image        = qgf_image,
+                .device       = device,
+                .fg_hsv888    = fg_hsv888,
+                .bg_hsv888    = bg_hsv888,
+                .info         = *info,
+                .last_used    = ++frame_cache_clock,
+                .offset       = frame_cache_pool_used,
+                .length       = length,
+                .frame_number = frame_number,
+            };
+            frame_cache_pool_used += length;
+            return free_entry;
+        }
+
+        if (!lru_entry) {
+            return NULL;
+        }
+        qp_frame_cache_remove(lru_entry);
+    }
+}
+
+#endif // QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_image
 
@@ -95,6 +336,16 @@ bool qp_close_image(painter_image_handle_t image) {
         return false;
     }
 
+#if QUANTUM_PAINTER_IMAGE_FRAME_METADATA_ENTRIES > 0
+    qp_drawimage_free_frame_metadata(qgf_image);
+#endif // QUANTUM_PAINTER_IMAGE_FRAME_METADATA_ENTRIES > 0
+#if QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE > 0
+    qp_frame_cache_invalidate_image(qgf_image);
+#endif // QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE > 0
+
+    // The handle may be reused by another image, so its palette can no longer be trusted
+    qp_internal_invalidate_palette();
+
     // Free up this image for use elsewhere.
     qgf_image->validate_ok = false;
     qp_stream_close(&qgf_image->stream);
@@ -111,18 +362,6 @@ bool qp_drawimage(painter_device_t device, uint16_t x, uint16_t y, painter_image
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_drawimage_recolor
 
-typedef struct qgf_frame_info_t {
-    painter_compression_t compression_scheme;
-    uint8_t               bpp;
-    bool                  has_palette;
-    bool                  is_delta;
-    uint16_t              left;
-    uint16_t              top;
-    uint16_t              right;
-    uint16_t              bottom;
-    uint16_t              delay;
-} qgf_frame_info_t;
-
 static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device, qgf_image_handle_t *qgf_image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qgf_frame_info_t *info) {
     painter_driver_t *driver = (painter_driver_t *)device;
 
@@ -132,24 +371,11 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         return false;
     }
 
-    // Seek to the frame
-    qgf_seek_to_frame_descriptor(&qgf_image->stream, frame_number);
-
-    // Read the frame descriptor
-    qgf_frame_v1_t frame_descriptor;
-    if (qp_stream_read(&frame_descriptor, sizeof(qgf_frame_v1_t), 1, &qgf_image->stream) != 1) {
-        qp_dprintf("Failed to read frame_descriptor, expected length was not %d\n", (int)sizeof(qgf_frame_v1_t));
+    // Locate the frame
+    if (!qp_drawimage_get_frame_info(qgf_image, frame_number, info)) {
         return false;
     }
 
-    // Parse out the frame info
-    if (!qgf_parse_frame_descriptor(&frame_descriptor, &info->bpp, &info->has_palette, &info->is_delta, &info->compression_scheme, &info->delay)) {
-        return false;
-    }
-
-    // Ensure we aren't reusing any palette
-    qp_internal_invalidate_palette();
-
     if (!qp_internal_bpp_capable(info->bpp)) {
         qp_dprintf("qp_drawimage_recolor: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE or QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)\n", (int)info->bpp);
         qp_comms_stop(device);
@@ -160,13 +386,20 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
     const uint16_t palette_entries  = 1u << info->bpp;
     bool           needs_pixconvert = false;
     if (info->has_palette) {
-        // Load the palette from the stream
-        if (!qp_internal_load_qgf_palette((qp_stream_t *)&qgf_image->stream, info->bpp)) {
-            return false;
+        // Consecutive frames sharing a palette, such as repeated playback of the same frame, don't need to reload it
+        if (!qp_internal_palette_owned_by(device, qgf_image, info->palette_offset)) {
+            // Load the palette from the stream
+            qp_stream_setpos(&qgf_image->stream, info->palette_offset);
+            if (!qp_internal_load_qgf_palette((qp_stream_t *)&qgf_image->stream, info->bpp)) {
+                return false;
+            }
+
+            needs_pixconvert = true;
         }
-
-        needs_pixconvert = true;
     } else {
+        // Ensure we aren't reusing any palette
+        qp_internal_invalidate_palette();
+
         if (info->bpp <= 8) {
             // Interpolate from fg/bg
             needs_pixconvert = qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries);
@@ -180,33 +413,83 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
             qp_comms_stop(device);
             return false;
         }
-    }
 
-    // Handle delta if needed
-    if (info->is_delta) {
-        qgf_delta_v1_t delta_descriptor;
-        if (qp_stream_read(&delta_descriptor, sizeof(qgf_delta_v1_t), 1, &qgf_image->stream) != 1) {
-            qp_dprintf("Failed to read delta_descriptor, expected length was not %d\n", (int)sizeof(qgf_delta_v1_t));
-            return false;
+        if (info->has_palette) {
+            qp_internal_set_palette_owner(device, qgf_image, info->palette_offset);
         }
+    }
 
-        info->left   = delta_descriptor.left;
-        info->top    = delta_descriptor.top;
-        info->right  = delta_descriptor.right;
-        info->bottom = delta_descriptor.bottom;
+    // Stream is now at the point of being able to read pixdata
+    qp_stream_setpos(&qgf_image->stream, info->data_offset);
+    return true;
+}
+
+// Works out the region of the display covered by the frame
+static uint32_t qp_drawimage_frame_bounds(painter_image_handle_t image, const qgf_frame_info_t *frame_info, uint16_t x, uint16_t y, uint16_t *l, uint16_t *t, uint16_t *r, uint16_t *b) {
+    if (frame_info->is_delta) {
+        *l = x + frame_info->left;
+        *t = y + frame_info->top;
+        *r = x + frame_info->right - 1;
+        *b = y + frame_info->bottom - 1;
+    } else {
+        *l = x;
+        *t = y;
+        *r = x + image->width - 1;
+        *b = y + image->height - 1;
     }
+    return ((uint32_t)(*r - *l + 1)) * (*b - *t + 1);
+}
 
-    // Read the data block
-    qgf_data_v1_t data_descriptor;
-    if (qp_stream_read(&data_descriptor, sizeof(qgf_data_v1_t), 1, &qgf_image->stream) != 1) {
-        qp_dprintf("Failed to read data_descriptor, expected length was not %d\n", (int)sizeof(qgf_data_v1_t));
+#if QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE > 0
+
+// Decodes the frame into the animation frame cache, if it isn't already there and there's enough space
+static bool qp_drawimage_cache_frame(painter_device_t device, qgf_image_handle_t *qgf_image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (qp_frame_cache_find(qgf_image, device, frame_number, fg_hsv888, bg_hsv888)) {
+        return true;
+    }
+
+    qgf_frame_info_t frame_info = {0};
+    if (!qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, &frame_info)) {
         return false;
     }
 
-    // Stream is now at the point of being able to read pixdata
-    return true;
+    // Native-format frames can only be cached for displays with the same format
+    if (frame_info.bpp > 8 && frame_info.bpp != driver->native_bits_per_pixel) {
+        return false;
+    }
+
+    uint16_t                 l, t, r, b;
+    uint32_t                 pixel_count = qp_drawimage_frame_bounds((painter_image_handle_t)qgf_image, &frame_info, 0, 0, &l, &t, &r, &b);
+    qgf_frame_cache_entry_t *entry       = qp_frame_cache_insert(qgf_image, device, frame_number, fg_hsv888, bg_hsv888, &frame_info, (pixel_count * driver->native_bits_per_pixel + 7) / 8);
+    if (!entry) {
+        qp_dprintf("qp_drawimage_cache_frame: frame %d does not fit in the cache\n", (int)frame_number);
+        return false;
+    }
+
+    qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qgf_image->stream};
+    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, frame_info.compression_scheme);
+    if (input_callback == NULL) {
+        qp_frame_cache_remove(entry);
+        return false;
+    }
+
+    bool                              ret          = false;
+    qp_internal_buffer_output_state_t output_state = {.device = device, .target_buffer = &frame_cache_pool[entry->offset], .write_pos = 0};
+    if (frame_info.bpp <= 8) {
+        ret = qp_internal_decode_palette(device, pixel_count, frame_info.bpp, input_callback, &input_state, qp_internal_global_pixel_lookup_table, qp_internal_buffer_pixel_appender, &output_state);
+    } else {
+        ret = qp_internal_send_bytes(device, pixel_count * frame_info.bpp / 8, input_callback, &input_state, qp_internal_buffer_byte_appender, &output_state);
+    }
+
+    if (!ret) {
+        qp_frame_cache_remove(entry);
+    }
+    return ret;
 }
 
+#endif // QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE > 0
+
 static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
     qp_dprintf("qp_drawimage_recolor: entry\n");
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -221,10 +504,19 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
-    // Read the frame info
-    if (!qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, frame_info)) {
-        qp_dprintf("qp_drawimage_recolor: fail (could not read frame %d)\n", frame_number);
-        return false;
+#if QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE > 0
+    // Pre-decoded frames don't need the stream at all
+    qgf_frame_cache_entry_t *entry = qp_frame_cache_find(qgf_image, device, frame_number, fg_hsv888, bg_hsv888);
+    if (entry) {
+        *frame_info = entry->info;
+    } else
+#endif // QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE > 0
+    {
+        // Read the frame info
+        if (!qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, frame_info)) {
+            qp_dprintf("qp_drawimage_recolor: fail (could not read frame %d)\n", frame_number);
+            return false;
+        }
     }
 
     if (!qp_comms_start(device)) {
@@ -233,18 +525,7 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
     }
 
     uint16_t l, t, r, b;
-    if (frame_info->is_delta) {
-        l = x + frame_info->left;
-        t = y + frame_info->top;
-        r = x + frame_info->right - 1;
-        b = y + frame_info->bottom - 1;
-    } else {
-        l = x;
-        t = y;
-        r = x + image->width - 1;
-        b = y + image->height - 1;
-    }
-    uint32_t pixel_count = ((uint32_t)(r - l + 1)) * (b - t + 1);
+    uint32_t pixel_count = qp_drawimage_frame_bounds(image, frame_info, x, y, &l, &t, &r, &b);
 
     // Configure where we're going to be rendering to
     if (!driver->driver_vtable->viewport(device, l, t, r, b)) {
@@ -253,6 +534,16 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
+    bool ret = false;
+#if QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE > 0
+    if (entry) {
+        ret = qp_internal_pixdata_from_buffer(device, &frame_cache_pool[entry->offset], pixel_count);
+        qp_dprintf("qp_drawimage_recolor: %s (cached)\n", ret ? "ok" : "fail");
+        qp_comms_stop(device);
+        return ret;
+    }
+#endif // QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE > 0
+
     // Set up the input state
     qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qgf_image->stream};
     qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, frame_info->compression_scheme);
@@ -262,7 +553,6 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
-    bool ret = false;
     if (frame_info->bpp <= 8) {
         // Set up the output state
         qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
@@ -378,6 +668,17 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
     anim_state->bg_hsv888    = (qp_pixel_t){.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
     anim_state->frame_number = 0;
 
+#if QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE > 0
+    // Decode as many frames as will fit up front, so that playback doesn't need to decode them at each frame boundary
+    qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)image;
+    painter_driver_t *  driver    = (painter_driver_t *)device;
+    if (qgf_image && qgf_image->validate_ok && driver && driver->validate_ok) {
+        for (uint16_t i = 0; i < image->frame_count; ++i) {
+            qp_drawimage_cache_frame(device, qgf_image, i, anim_state->fg_hsv888, anim_state->bg_hsv888);
+        }
+    }
+#endif // QUANTUM_PAINTER_ANIMATION_FRAME_CACHE_SIZE > 0
+
     // Draw the first frame
     uint16_t delay_ms;
     if (!qp_render_animation_state(anim_state, &delay_ms)) {
@@ -35,6 +35,120 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph cache
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+_Static_assert(QUANTUM_PAINTER_GLYPH_CACHE_SIZE <= UINT16_MAX, "QUANTUM_PAINTER_GLYPH_CACHE_SIZE must fit within 16 bits");
+
+// Cached glyph, already converted to the native pixel format of the device it was rendered to
+typedef struct qp_glyph_cache_entry_t {
+    const qff_font_handle_t *font; // NULL if the entry is unused
+    painter_device_t         device;
+    uint32_t                 code_point;
+    qp_pixel_t               fg_hsv888;
+    qp_pixel_t               bg_hsv888;
+    uint32_t                 last_used;
+    uint16_t                 offset; // location of the pixel data in the pool
+    uint16_t                 length; // number of bytes used in the pool, including alignment padding
+    uint8_t                  width;
+} qp_glyph_cache_entry_t;
+
+static qp_glyph_cache_entry_t                  glyph_cache_entries[QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES] = {0};
+__attribute__((__aligned__(4))) static uint8_t glyph_cache_pool[QUANTUM_PAINTER_GLYPH_CACHE_SIZE];
+static uint16_t                                glyph_cache_pool_used = 0;
+static uint32_t                                glyph_cache_clock     = 0;
+
+static inline bool qp_glyph_cache_color_matches(qp_pixel_t a, qp_pixel_t b) {
+    return a.hsv888.h == b.hsv888.h && a.hsv888.s == b.hsv888.s && a.hsv888.v == b.hsv888.v;
+}
+
+// Finds any cached copy of the glyph, regardless of device or colour -- only useful for its width
+static qp_glyph_cache_entry_t *qp_glyph_cache_find_any(const qff_font_handle_t *qff_font, uint32_t code_point) {
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache_entries[i];
+        if (entry->font == qff_font && entry->code_point == code_point) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static qp_glyph_cache_entry_t *qp_glyph_cache_find(const qff_font_handle_t *qff_font, painter_device_t device, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache_entries[i];
+        // Fonts with their own palette render identically regardless of the requested colours
+        if (entry->font == qff_font && entry->device == device && entry->code_point == code_point && (qff_font->has_palette || (qp_glyph_cache_color_matches(entry->fg_hsv888, fg_hsv888) && qp_glyph_cache_color_matches(entry->bg_hsv888, bg_hsv888)))) {
+            entry->last_used = ++glyph_cache_clock;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void qp_glyph_cache_remove(qp_glyph_cache_entry_t *entry) {
+    // Compact the pool, shuffling down anything stored after the removed glyph
+    uint16_t end = entry->offset + entry->length;
+    memmove(&glyph_cache_pool[entry->offset], &glyph_cache_pool[end], glyph_cache_pool_used - end);
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (glyph_cache_entries[i].font && glyph_cache_entries[i].offset > entry->offset) {
+            glyph_cache_entries[i].offset -= entry->length;
+        }
+    }
+    glyph_cache_pool_used -= entry->length;
+    entry->font = NULL;
+}
+
+static void qp_glyph_cache_invalidate_font(const qff_font_handle_t *qff_font) {
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (glyph_cache_entries[i].font == qff_font) {
+            qp_glyph_cache_remove(&glyph_cache_entries[i]);
+        }
+    }
+}
+
+// Reserves space for a glyph, evicting the least recently used glyphs as required. Returns NULL if the glyph can never fit.
+static qp_glyph_cache_entry_t *qp_glyph_cache_insert(const qff_font_handle_t *qff_font, painter_device_t device, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint8_t width, uint32_t byte_count) {
+    uint32_t length = (byte_count + 3) & ~3u; // keep each glyph aligned for native pixel access
+    if (length > QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+        return NULL;
+    }
+
+    while (true) {
+        qp_glyph_cache_entry_t *free_entry = NULL;
+        qp_glyph_cache_entry_t *lru_entry  = NULL;
+        for (uint8_t i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+            qp_glyph_cache_entry_t *entry = &glyph_cache_entries[i];
+            if (!entry->font) {
+                free_entry = entry;
+            } else if (!lru_entry || entry->last_used < lru_entry->last_used) {
+                lru_entry = entry;
+            }
+        }
+
+        if (free_entry && glyph_cache_pool_used + length <= QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+            *free_entry = (qp_glyph_cache_entry_t){
+                .font       = qff_font,
+                .device     = device,
+                .code_point = code_point,
+                .fg_hsv888  = fg_hsv888,
+                .bg_hsv888  = bg_hsv888,
+                .last_used  = ++glyph_cache_clock,
+                .offset     = glyph_cache_pool_used,
+                .length     = length,
+                .width      = width,
+            };
+            glyph_cache_pool_used += length;
+            return free_entry;
+        }
+
+        qp_glyph_cache_remove(lru_entry);
+    }
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -150,6 +264,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Drop any cached glyphs, the handle may be reused for a different font
+    qp_glyph_cache_invalidate_font(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -159,8 +278,9 @@ bool qp_close_font(painter_font_handle_t font) {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helpers
 
-// Callback to be invoked for each codepoint detected in the UTF8 input string
-typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg);
+// Callback to be invoked for each codepoint detected in the UTF8 input string.
+// If stream_ready is false the width came from the glyph cache, and the stream has not been positioned at the glyph data.
+typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, bool stream_ready, void *cb_arg);
 
 // Helper that sets up the palette (if required) and returns the offset in the stream that the data starts
 static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device, qff_font_handle_t *qff_font, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint32_t *data_offset) {
@@ -252,19 +372,27 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
                                      + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
                                      + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
 
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing glyph data\n");
-            return false;
-        }
-
+        // The unicode table is sorted by code point, so binary search it rather than walking every entry
         qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
+        uint16_t               lower = 0;
+        uint16_t               upper = qff_font->num_unicode_glyphs;
+        while (lower < upper) {
+            uint16_t i = lower + (upper - lower) / 2;
+            if (qp_stream_setpos(&qff_font->stream, glyph_info_offset + i * sizeof(qff_unicode_glyph_v1_t)) < 0) {
+                qp_dprintf("Failed to set stream position while preparing glyph data\n");
+                return false;
+            }
+
             if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
                 qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
                 return false;
             }
 
-            if (glyph_info.code_point == code_point) {
+            if (glyph_info.code_point < code_point) {
+                lower = i + 1;
+            } else if (glyph_info.code_point > code_point) {
+                upper = i;
+            } else {
                 uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
                 uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
                 uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
@@ -302,12 +430,23 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
         }
 
         uint8_t width;
-        if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
-            qp_dprintf("Failed to prepare glyph for rendering.\n");
-            return false;
+        bool    stream_ready = false;
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+        // Cached glyphs already know their width, skip the glyph table lookup
+        qp_glyph_cache_entry_t *entry = qp_glyph_cache_find_any(qff_font, code_point);
+        if (entry) {
+            width = entry->width;
+        } else
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+        {
+            if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+                qp_dprintf("Failed to prepare glyph for rendering.\n");
+                return false;
+            }
+            stream_ready = true;
         }
 
-        if (!handler(qff_font, code_point, width, qff_font->base.line_height, cb_arg)) {
+        if (!handler(qff_font, code_point, width, qff_font->base.line_height, stream_ready, cb_arg)) {
             qp_dprintf("Failed to execute glyph handler.\n");
             return false;
         }
@@ -324,7 +463,7 @@ typedef struct code_point_iter_calcwidth_state_t {
 } code_point_iter_calcwidth_state_t;
 
 // Codepoint handler callback: width calc
-static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, bool stream_ready, void *cb_arg) {
     code_point_iter_calcwidth_state_t *state = (code_point_iter_calcwidth_state_t *)cb_arg;
 
     // Increment the overall width by this glyph's width
@@ -341,19 +480,45 @@ typedef struct code_point_iter_drawglyph_state_t {
     painter_device_t                  device;
     int16_t                           xpos;
     int16_t                           ypos;
+    qp_pixel_t                        fg_hsv888;
+    qp_pixel_t                        bg_hsv888;
+    bool                              palette_ready;
     qp_internal_byte_input_callback   input_callback;
     qp_internal_byte_input_state_t *  input_state;
     qp_internal_pixel_output_state_t *output_state;
 } code_point_iter_drawglyph_state_t;
 
+// Sets up the palette on first use, and positions the stream at the start of the glyph data
+static inline bool qp_font_prepare_glyph_decode(qff_font_handle_t *qff_font, uint32_t code_point, bool stream_ready, code_point_iter_drawglyph_state_t *state) {
+    // The palette is only needed when glyphs are decoded, so it's deferred until the first glyph missing from the cache
+    if (!state->palette_ready) {
+        uint32_t data_offset;
+        if (!qp_drawtext_prepare_font_for_render(state->device, qff_font, state->fg_hsv888, state->bg_hsv888, &data_offset)) {
+            qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
+            return false;
+        }
+        state->palette_ready = true;
+        if (qff_font->has_palette) {
+            stream_ready = false; // loading the palette moved the stream
+        }
+    }
+
+    uint8_t width;
+    if (!stream_ready && !qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+        qp_dprintf("Failed to prepare glyph for rendering.\n");
+        return false;
+    }
+
+    // Reset the decoder state -- the stream is now positioned at the glyph data
+    qp_internal_prepare_input_state(state->input_state, qff_font->compression_scheme);
+    return true;
+}
+
 // Codepoint handler callback: drawing
-static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, bool stream_ready, void *cb_arg) {
     code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
     painter_driver_t *                 driver = (painter_driver_t *)state->device;
 
-    // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
-    state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
-
     // Reset the output state
     state->output_state->pixel_write_pos = 0;
 
@@ -363,13 +528,42 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     // Move the x-position for the next glyph
     state->xpos += width;
 
-    // Decode the pixel data for the glyph
     uint32_t pixel_count = ((uint32_t)width) * height;
-    bool     ret         = qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, state->output_state);
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Decode the glyph into the cache if it's not already there, then stream it out from the cache
+    qp_glyph_cache_entry_t *entry = qp_glyph_cache_find(qff_font, state->device, code_point, state->fg_hsv888, state->bg_hsv888);
+    if (!entry) {
+        if (!qp_font_prepare_glyph_decode(qff_font, code_point, stream_ready, state)) {
+            return false;
+        }
+
+        entry = qp_glyph_cache_insert(qff_font, state->device, code_point, state->fg_hsv888, state->bg_hsv888, width, (pixel_count * driver->native_bits_per_pixel + 7) / 8);
+        if (entry) {
+            qp_internal_buffer_output_state_t cache_state = {.device = state->device, .target_buffer = &glyph_cache_pool[entry->offset], .write_pos = 0};
+            if (!qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_internal_buffer_pixel_appender, &cache_state)) {
+                qp_glyph_cache_remove(entry);
+                return false;
+            }
+        }
+    }
+
+    if (entry) {
+        return qp_internal_pixdata_from_buffer(state->device, &glyph_cache_pool[entry->offset], pixel_count);
+    }
+#else
+    if (!qp_font_prepare_glyph_decode(qff_font, code_point, stream_ready, state)) {
+        return false;
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+    // Decode the pixel data for the glyph
+    bool ret = qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, state->output_state);
 
     // Any leftovers need transmission as well.
     if (ret && state->output_state->pixel_write_pos > 0) {
         ret &= driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->output_state->pixel_write_pos);
+        qp_internal_swap_pixdata_buffer();
     }
 
     return ret;
@@ -439,21 +633,16 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
                                                .device = device,
                                                .xpos   = x,
                                                .ypos   = y,
+                                               // Colours, palette is set up on first use
+                                               .fg_hsv888     = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}},
+                                               .bg_hsv888     = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}},
+                                               .palette_ready = false,
                                                // Input
                                                .input_callback = input_callback,
                                                .input_state    = &input_state,
                                                // Output
                                                .output_state = &output_state};
 
-    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
-    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
-    if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
-        qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
-        qp_comms_stop(device);
-        return false;
-    }
-
     // Iterate the codepoints with the drawglyph callback
     bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
 
@@ -0,0 +1,140 @@
+// Copyright 2023 QMK -- generated source code only, font retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-font-image -i aileron12.png -f mono4`
+
+#include <qp.h>
+
+const uint32_t font_aileron12_length = 2019;
+
+// clang-format off
+const uint8_t font_aileron12[2019] = {
+    0x00, 0xFF, 0x14, 0x00, 0x00, 0x51, 0x46, 0x46, 0x01, 0xE3, 0x07, 0x00, 0x00, 0x1C, 0xF8, 0xFF,
+    0xFF, 0x0D, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x01, 0xFE, 0x1D, 0x01, 0x00, 0x03, 0x00,
+    0x00, 0x83, 0x00, 0x00, 0x44, 0x03, 0x00, 0xC7, 0x04, 0x00, 0xC7, 0x09, 0x00, 0x49, 0x0F, 0x00,
+    0xC8, 0x15, 0x00, 0x83, 0x1B, 0x00, 0x04, 0x1D, 0x00, 0x04, 0x20, 0x00, 0x87, 0x23, 0x00, 0x07,
+    0x27, 0x00, 0x83, 0x2A, 0x00, 0x03, 0x2C, 0x00, 0xC3, 0x2D, 0x00, 0x84, 0x2F, 0x00, 0x47, 0x33,
+    0x00, 0xC7, 0x38, 0x00, 0xC7, 0x3D, 0x00, 0x07, 0x43, 0x00, 0x48, 0x48, 0x00, 0xC7, 0x4D, 0x00,
+    0x07, 0x53, 0x00, 0xC7, 0x58, 0x00, 0xC7, 0x5D, 0x00, 0x07, 0x63, 0x00, 0xC3, 0x68, 0x00, 0xC3,
+    0x6B, 0x00, 0xC7, 0x6E, 0x00, 0x07, 0x73, 0x00, 0x07, 0x76, 0x00, 0x46, 0x7A, 0x00, 0xCB, 0x7E,
+    0x00, 0xC8, 0x86, 0x00, 0x87, 0x8C, 0x00, 0xC9, 0x91, 0x00, 0x48, 0x98, 0x00, 0x07, 0x9E, 0x00,
+    0x47, 0xA3, 0x00, 0x49, 0xA8, 0x00, 0x09, 0xAF, 0x00, 0x83, 0xB5, 0x00, 0x47, 0xB8, 0x00, 0x08,
+    0xBD, 0x00, 0xC7, 0xC2, 0x00, 0x0A, 0xC8, 0x00, 0x48, 0xCF, 0x00, 0x09, 0xD5, 0x00, 0x87, 0xDB,
+    0x00, 0x89, 0xE0, 0x00, 0x88, 0xE7, 0x00, 0x46, 0xED, 0x00, 0xC8, 0xF1, 0x00, 0x88, 0xF7, 0x00,
+    0x88, 0xFD, 0x00, 0x4C, 0x03, 0x01, 0x88, 0x0B, 0x01, 0x87, 0x11, 0x01, 0x88, 0x16, 0x01, 0x44,
+    0x1C, 0x01, 0x44, 0x1E, 0x01, 0x44, 0x22, 0x01, 0x47, 0x24, 0x01, 0x86, 0x27, 0x01, 0x44, 0x29,
+    0x01, 0xC7, 0x2A, 0x01, 0x47, 0x2F, 0x01, 0x87, 0x34, 0x01, 0x08, 0x39, 0x01, 0x87, 0x3E, 0x01,
+    0x44, 0x43, 0x01, 0x88, 0x45, 0x01, 0x87, 0x4B, 0x01, 0xC3, 0x50, 0x01, 0x83, 0x53, 0x01, 0x47,
+    0x56, 0x01, 0x83, 0x5B, 0x01, 0x4B, 0x5E, 0x01, 0x07, 0x64, 0x01, 0x87, 0x68, 0x01, 0x07, 0x6D,
+    0x01, 0x48, 0x72, 0x01, 0x04, 0x78, 0x01, 0x46, 0x7A, 0x01, 0x44, 0x7E, 0x01, 0x07, 0x81, 0x01,
+    0x87, 0x85, 0x01, 0x0A, 0x8A, 0x01, 0xC6, 0x8F, 0x01, 0xC7, 0x93, 0x01, 0x47, 0x99, 0x01, 0xC4,
+    0x9D, 0x01, 0x43, 0xA1, 0x01, 0x03, 0xA4, 0x01, 0xC7, 0xA6, 0x01, 0x04, 0xFB, 0xA3, 0x06, 0x00,
+    0x0A, 0x00, 0x87, 0x00, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x08, 0x02, 0x02, 0x00, 0x80, 0x00, 0x03,
+    0xCC, 0x09, 0x00, 0x02, 0x00, 0x8E, 0x60, 0x02, 0x58, 0x40, 0x09, 0xB8, 0x0B, 0x88, 0xC0, 0xBF,
+    0x90, 0x05, 0x94, 0x00, 0x22, 0x06, 0x00, 0x92, 0xC0, 0x00, 0xBD, 0xC0, 0x9D, 0x70, 0x13, 0xEC,
+    0x00, 0xB9, 0x00, 0xAC, 0x14, 0x37, 0xDD, 0x09, 0xBE, 0x01, 0x0C, 0x04, 0x00, 0x02, 0x00, 0x94,
+    0xE0, 0x41, 0xC2, 0x0D, 0x07, 0x37, 0x0A, 0x78, 0x0C, 0x00, 0x18, 0x00, 0x64, 0x1A, 0x20, 0xD3,
+    0x50, 0x4C, 0x83, 0xD0, 0x07, 0x07, 0x00, 0x02, 0x00, 0x8A, 0xE4, 0x03, 0x1C, 0x00, 0x0C, 0x04,
+    0x1C, 0x0C, 0xF4, 0x3F, 0x18, 0x03, 0x0C, 0x83, 0x1C, 0x0C, 0xE4, 0x0B, 0x06, 0x00, 0x82, 0x00,
+    0xC3, 0x30, 0x07, 0x00, 0x82, 0x20, 0x24, 0x18, 0x05, 0x0C, 0x82, 0x18, 0x24, 0x20, 0x02, 0x00,
+    0x83, 0x05, 0x0C, 0x18, 0x24, 0x03, 0x34, 0x83, 0x24, 0x18, 0x0C, 0x05, 0x02, 0x00, 0x07, 0x00,
+    0x88, 0xC0, 0x00, 0x31, 0x41, 0x6E, 0x80, 0x09, 0x14, 0x06, 0x07, 0x00, 0x06, 0x00, 0x88, 0x03,
+    0xC0, 0x00, 0x30, 0xD0, 0xFF, 0x00, 0x03, 0xC0, 0x08, 0x00, 0x07, 0x00, 0x82, 0x89, 0x32, 0x00,
+    0x04, 0x00, 0x81, 0xE0, 0x02, 0x04, 0x00, 0x06, 0x00, 0x81, 0x08, 0x02, 0x02, 0x00, 0x81, 0x00,
+    0x40, 0x03, 0x80, 0x80, 0x50, 0x02, 0x20, 0x82, 0x14, 0x08, 0x04, 0x02, 0x00, 0x02, 0x00, 0x80,
+    0xF8, 0x02, 0x82, 0x8C, 0x71, 0x90, 0x0C, 0x34, 0x03, 0xCD, 0x40, 0x73, 0x90, 0x28, 0x18, 0xF8,
+    0x02, 0x05, 0x00, 0x02, 0x00, 0x8E, 0xE4, 0x40, 0x3B, 0x10, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x30,
+    0x00, 0x0C, 0x00, 0x03, 0xC0, 0x06, 0x00, 0x02, 0x00, 0x8F, 0xB9, 0xC0, 0xA0, 0x24, 0x34, 0x00,
+    0x09, 0xC0, 0x01, 0x1C, 0x80, 0x01, 0x18, 0x80, 0xFF, 0x02, 0x05, 0x00, 0x02, 0x00, 0x8B, 0xB9,
+    0xD1, 0x90, 0x14, 0x34, 0x00, 0x06, 0xF4, 0x01, 0xA0, 0x18, 0x34, 0x02, 0x0A, 0x80, 0xBE, 0x06,
+    0x00, 0x03, 0x00, 0x90, 0x0D, 0x00, 0x0F, 0x80, 0x0D, 0x90, 0x0C, 0x30, 0x0C, 0x18, 0x0C, 0xFC,
+    0x3F, 0x00, 0x0C, 0x00, 0x0C, 0x06, 0x00, 0x02, 0x00, 0x85, 0xFF, 0x92, 0x00, 0x24, 0x00, 0xE9,
+    0x02, 0x82, 0x86, 0x02, 0xD0, 0x14, 0x34, 0x09, 0x0A, 0xBE, 0x06, 0x00, 0x02, 0x00, 0x85, 0xF4,
+    0x42, 0x82, 0x62, 0x40, 0x9C, 0x02, 0x0B, 0x83, 0xCA, 0x40, 0x33, 0xD0, 0x02, 0x28, 0x81, 0xF8,
+    0x02, 0x05, 0x00, 0x90, 0x00, 0x80, 0xFF, 0x03, 0xA0, 0x00, 0x0C, 0x80, 0x02, 0x30, 0x00, 0x0A,
+    0xC0, 0x00, 0x28, 0x00, 0x03, 0x06, 0x00, 0x02, 0x00, 0x8F, 0xF9, 0xC2, 0x81, 0x32, 0xD0, 0x1C,
+    0x28, 0xFD, 0xC7, 0x81, 0x32, 0xD0, 0x1C, 0x28, 0xF9, 0x02, 0x05, 0x00, 0x02, 0x00, 0x80, 0xF8,
+    0x02, 0x82, 0x88, 0x31, 0x90, 0x0C, 0x34, 0x0A, 0x0E, 0x6E, 0x23, 0x90, 0x02, 0x18, 0x81, 0xB8,
+    0x01, 0x05, 0x00, 0x02, 0x00, 0x81, 0x20, 0x08, 0x02, 0x00, 0x81, 0x08, 0x02, 0x02, 0x00, 0x02,
+    0x00, 0x81, 0x20, 0x08, 0x02, 0x00, 0x83, 0x40, 0x62, 0x08, 0x00, 0x06, 0x00, 0x8B, 0x10, 0x00,
+    0x0A, 0x68, 0xC0, 0x01, 0x90, 0x02, 0x40, 0x0A, 0x00, 0x01, 0x05, 0x00, 0x07, 0x00, 0x81, 0xFC,
+    0x0F, 0x03, 0x00, 0x81, 0xF0, 0x3F, 0x09, 0x00, 0x05, 0x00, 0x8B, 0x10, 0x00, 0x28, 0x00, 0xA4,
+    0x00, 0xD0, 0x00, 0x1A, 0x68, 0x00, 0x01, 0x06, 0x00, 0x8E, 0x00, 0x40, 0x6E, 0x1C, 0x89, 0xD0,
+    0x00, 0x0A, 0x24, 0x80, 0x00, 0x04, 0x80, 0x00, 0x08, 0x05, 0x00, 0x03, 0x00, 0x9A, 0x90, 0x2F,
+    0x00, 0x1D, 0x34, 0xD0, 0xB8, 0x29, 0x98, 0xA2, 0x0D, 0x33, 0x58, 0xC3, 0x0C, 0x93, 0x30, 0xD3,
+    0x18, 0x58, 0xA6, 0x01, 0x1D, 0x20, 0x00, 0xF9, 0x06, 0x06, 0x00, 0x02, 0x00, 0x91, 0xC0, 0x03,
+    0x90, 0x07, 0xA0, 0x0A, 0x70, 0x09, 0x30, 0x0C, 0xF4, 0x1F, 0x18, 0x24, 0x0C, 0x30, 0x09, 0x60,
+    0x06, 0x00, 0x02, 0x00, 0x8F, 0xBF, 0xC1, 0xD0, 0x30, 0x34, 0x0C, 0x09, 0xFF, 0xC1, 0x80, 0x32,
+    0xD0, 0x0C, 0x24, 0xFF, 0x02, 0x05, 0x00, 0x02, 0x00, 0x8B, 0x40, 0xBE, 0x40, 0x07, 0x0A, 0x06,
+    0x30, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x02, 0x00, 0x85, 0x06, 0x30, 0x74, 0x60, 0x40, 0x6E, 0x08,
+    0x00, 0x02, 0x00, 0x91, 0xFC, 0x0B, 0x0C, 0x34, 0x0C, 0xA0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0x90,
+    0x0C, 0xA0, 0x0C, 0x34, 0xFC, 0x0B, 0x06, 0x00, 0x02, 0x00, 0x8F, 0xFF, 0xC7, 0x00, 0x30, 0x00,
+    0x0C, 0x00, 0xFF, 0xC2, 0x00, 0x30, 0x00, 0x0C, 0x00, 0xFF, 0x07, 0x05, 0x00, 0x02, 0x00, 0x8E,
+    0xFF, 0xC7, 0x00, 0x30, 0x00, 0x0C, 0x00, 0xFF, 0xC2, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0x06,
+    0x00, 0x02, 0x00, 0x8E, 0x40, 0xBE, 0x40, 0x03, 0x0A, 0x06, 0x24, 0x0C, 0x00, 0x30, 0xF0, 0xC3,
+    0x00, 0x0D, 0x06, 0x02, 0x34, 0x83, 0xE4, 0x40, 0x6F, 0x03, 0x07, 0x00, 0x02, 0x00, 0x94, 0x30,
+    0x00, 0xC3, 0x00, 0x0C, 0x03, 0x30, 0x0C, 0xC0, 0xF0, 0xFF, 0xC3, 0x00, 0x0C, 0x03, 0x30, 0x0C,
+    0xC0, 0x30, 0x00, 0x03, 0x07, 0x00, 0x87, 0x00, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0x03, 0x02,
+    0x00, 0x03, 0x00, 0x8D, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0xC0, 0x30, 0x34, 0x1C,
+    0x09, 0xB9, 0x06, 0x00, 0x02, 0x00, 0x91, 0x0C, 0x24, 0x0C, 0x0D, 0x0C, 0x07, 0xCC, 0x01, 0xAC,
+    0x00, 0xEC, 0x01, 0x4C, 0x07, 0x0C, 0x0E, 0x0C, 0x28, 0x06, 0x00, 0x02, 0x00, 0x8F, 0x03, 0xC0,
+    0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0xFF, 0x07, 0x05, 0x00,
+    0x02, 0x00, 0x81, 0xC0, 0x02, 0x02, 0x3C, 0x92, 0xD0, 0xC3, 0x06, 0x39, 0x9C, 0x60, 0xC3, 0x0C,
+    0x33, 0x8C, 0x25, 0xC3, 0x94, 0x31, 0x0C, 0x0E, 0xC3, 0xB0, 0x30, 0x08, 0x00, 0x02, 0x00, 0x91,
+    0x2C, 0x30, 0x3C, 0x30, 0x9C, 0x30, 0xCC, 0x30, 0x8C, 0x31, 0x0C, 0x32, 0x0C, 0x36, 0x0C, 0x39,
+    0x0C, 0x3C, 0x06, 0x00, 0x02, 0x00, 0x94, 0x40, 0xBE, 0x41, 0x07, 0x0D, 0x06, 0xA0, 0x0C, 0x40,
+    0x33, 0x00, 0xCD, 0x00, 0x34, 0x06, 0xA0, 0x74, 0xD0, 0x40, 0xBE, 0x01, 0x07, 0x00, 0x02, 0x00,
+    0x8E, 0xFF, 0xC2, 0x40, 0x32, 0xD0, 0x0C, 0x28, 0xFF, 0xC2, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03,
+    0x06, 0x00, 0x02, 0x00, 0x96, 0x40, 0xBE, 0x40, 0x07, 0x0D, 0x06, 0xA0, 0x0C, 0x40, 0x33, 0x00,
+    0xCD, 0x00, 0x34, 0x06, 0xA0, 0x74, 0xD0, 0x40, 0xFE, 0x07, 0x00, 0x10, 0x05, 0x00, 0x02, 0x00,
+    0x91, 0xFC, 0x0B, 0x0C, 0x24, 0x0C, 0x34, 0x0C, 0x28, 0xFC, 0x0B, 0x0C, 0x1C, 0x0C, 0x28, 0x0C,
+    0x24, 0x0C, 0x34, 0x06, 0x00, 0x8E, 0x00, 0x40, 0x2E, 0x1C, 0xCA, 0x40, 0x6C, 0x00, 0x2E, 0x00,
+    0x5A, 0xD0, 0x0D, 0x49, 0x2F, 0x05, 0x00, 0x02, 0x00, 0x91, 0xFC, 0xBF, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x06, 0x00, 0x02, 0x00,
+    0x8D, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x34, 0x02,
+    0x28, 0x81, 0xE0, 0x0B, 0x06, 0x00, 0x02, 0x00, 0x91, 0x09, 0x60, 0x0C, 0x30, 0x18, 0x24, 0x28,
+    0x18, 0x34, 0x0C, 0x30, 0x09, 0x60, 0x06, 0x90, 0x03, 0xC0, 0x02, 0x06, 0x00, 0x03, 0x00, 0x8A,
+    0x0A, 0x2C, 0x70, 0x09, 0x3D, 0x30, 0x0C, 0x35, 0x24, 0x1C, 0x66, 0x02, 0x18, 0x8D, 0x93, 0x18,
+    0x64, 0x82, 0x0C, 0x70, 0xC1, 0x09, 0xB0, 0x81, 0x06, 0xE0, 0x40, 0x03, 0x09, 0x00, 0x02, 0x00,
+    0x8D, 0x0D, 0x30, 0x28, 0x18, 0x70, 0x09, 0x90, 0x03, 0xC0, 0x02, 0x90, 0x07, 0x30, 0x09, 0x02,
+    0x18, 0x81, 0x09, 0x30, 0x06, 0x00, 0x02, 0x00, 0x8E, 0x06, 0x48, 0x03, 0x83, 0xA1, 0xD0, 0x0D,
+    0xE0, 0x01, 0x34, 0x00, 0x0C, 0x00, 0x03, 0xC0, 0x06, 0x00, 0x02, 0x00, 0x91, 0xF8, 0x3F, 0x00,
+    0x28, 0x00, 0x0D, 0x00, 0x07, 0x80, 0x02, 0xD0, 0x00, 0x70, 0x00, 0x28, 0x00, 0xFC, 0x3F, 0x06,
+    0x00, 0x80, 0x7C, 0x09, 0x0C, 0x80, 0x7C, 0x02, 0x00, 0x80, 0x00, 0x02, 0x08, 0x80, 0x14, 0x02,
+    0x20, 0x80, 0x50, 0x02, 0x80, 0x80, 0x40, 0x03, 0x00, 0x80, 0x3D, 0x09, 0x30, 0x80, 0x3D, 0x02,
+    0x00, 0x04, 0x00, 0x87, 0x0C, 0x80, 0x09, 0x20, 0x02, 0x45, 0x81, 0x80, 0x0B, 0x00, 0x0F, 0x00,
+    0x81, 0xFD, 0x07, 0x03, 0x00, 0x82, 0x00, 0x05, 0x08, 0x0A, 0x00, 0x05, 0x00, 0x8C, 0x80, 0x1F,
+    0x18, 0x0D, 0x41, 0x43, 0xEB, 0x30, 0x34, 0x0C, 0x0E, 0xBD, 0x03, 0x05, 0x00, 0x02, 0x00, 0x8F,
+    0x03, 0xC0, 0x00, 0x70, 0x2F, 0x2C, 0x18, 0x03, 0xCD, 0x40, 0x33, 0x90, 0x2C, 0x18, 0xFB, 0x01,
+    0x05, 0x00, 0x05, 0x00, 0x8C, 0x80, 0x1F, 0x28, 0x1C, 0x03, 0xC5, 0x00, 0x30, 0x10, 0x28, 0x0C,
+    0xB8, 0x01, 0x05, 0x00, 0x03, 0x00, 0x90, 0x30, 0x00, 0x30, 0xE0, 0x3B, 0x28, 0x38, 0x0C, 0x34,
+    0x0C, 0x34, 0x0C, 0x34, 0x28, 0x38, 0xE0, 0x36, 0x06, 0x00, 0x05, 0x00, 0x88, 0x80, 0x2E, 0x28,
+    0x18, 0x03, 0xC9, 0xFF, 0x32, 0x40, 0x02, 0x18, 0x81, 0xF8, 0x02, 0x05, 0x00, 0x83, 0x54, 0x1C,
+    0x0C, 0x7E, 0x06, 0x0C, 0x03, 0x00, 0x06, 0x00, 0x8F, 0xE0, 0x3B, 0x28, 0x38, 0x0C, 0x34, 0x0C,
+    0x34, 0x0C, 0x34, 0x28, 0x38, 0xE0, 0x36, 0x08, 0x34, 0x02, 0x28, 0x81, 0xE0, 0x0B, 0x02, 0x00,
+    0x89, 0x03, 0xC0, 0x00, 0x70, 0x1F, 0x2C, 0x09, 0x43, 0xC3, 0xC0, 0x02, 0x30, 0x02, 0x0C, 0x02,
+    0x03, 0x05, 0x00, 0x87, 0x00, 0x02, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0x03, 0x02, 0x00, 0x89, 0x00,
+    0x02, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0xC3, 0x34, 0x0B, 0x02, 0x00, 0x8F, 0x03, 0xC0, 0x00, 0x30,
+    0x24, 0x4C, 0x02, 0x37, 0xC0, 0x0B, 0x70, 0x07, 0x4C, 0x03, 0x83, 0x02, 0x05, 0x00, 0x87, 0x00,
+    0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0x0B, 0x02, 0x00, 0x08, 0x00, 0x85, 0xB0, 0x9F, 0x1F, 0x1C,
+    0x1D, 0x0D, 0x02, 0x43, 0x80, 0xC3, 0x02, 0xC0, 0x03, 0x30, 0x03, 0x0C, 0x03, 0x03, 0x08, 0x00,
+    0x05, 0x00, 0x86, 0x70, 0x1F, 0x2C, 0x09, 0x43, 0xC3, 0xC0, 0x02, 0x30, 0x02, 0x0C, 0x02, 0x03,
+    0x05, 0x00, 0x05, 0x00, 0x8C, 0x80, 0x2F, 0x28, 0x18, 0x03, 0xC9, 0x40, 0x33, 0x90, 0x28, 0x18,
+    0xF8, 0x02, 0x05, 0x00, 0x05, 0x00, 0x91, 0x70, 0x2F, 0x2C, 0x18, 0x03, 0xCD, 0x40, 0x33, 0x90,
+    0x2C, 0x18, 0xFB, 0xC1, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x93, 0xE0, 0x3B, 0x28, 0x38,
+    0x0C, 0x34, 0x0C, 0x34, 0x0C, 0x34, 0x28, 0x38, 0xE0, 0x36, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30,
+    0x03, 0x00, 0x81, 0xAC, 0x1C, 0x05, 0x0C, 0x03, 0x00, 0x04, 0x00, 0x8A, 0x40, 0x2F, 0x0C, 0xCA,
+    0x01, 0xE4, 0x02, 0xA0, 0x0D, 0x4D, 0x6F, 0x05, 0x00, 0x83, 0x00, 0x10, 0x30, 0xFC, 0x05, 0x30,
+    0x80, 0xE0, 0x03, 0x00, 0x05, 0x00, 0x02, 0x30, 0x02, 0x0C, 0x88, 0x03, 0xC3, 0xD0, 0x30, 0x34,
+    0x1C, 0x0E, 0x6D, 0x03, 0x05, 0x00, 0x05, 0x00, 0x81, 0x18, 0x30, 0x02, 0x09, 0x87, 0x83, 0x81,
+    0x31, 0x90, 0x09, 0xB0, 0x01, 0x38, 0x06, 0x00, 0x07, 0x00, 0x03, 0x70, 0x89, 0x4A, 0x0A, 0x93,
+    0xD8, 0x24, 0x8C, 0x98, 0x81, 0x8D, 0x0D, 0x02, 0xA4, 0x80, 0x00, 0x02, 0x07, 0x08, 0x00, 0x04,
+    0x00, 0x8A, 0x80, 0xC2, 0x30, 0x09, 0x39, 0xC0, 0x02, 0x39, 0x30, 0x89, 0xC1, 0x05, 0x00, 0x05,
+    0x00, 0x81, 0x18, 0x34, 0x02, 0x09, 0x8D, 0x83, 0x81, 0x31, 0x90, 0x09, 0xA0, 0x01, 0x38, 0x00,
+    0x0A, 0x80, 0x00, 0x1D, 0x00, 0x05, 0x00, 0x8C, 0xE0, 0x3F, 0x00, 0x0A, 0x90, 0x00, 0x0C, 0x80,
+    0x01, 0x28, 0x00, 0xFF, 0x03, 0x05, 0x00, 0x80, 0xA0, 0x03, 0x30, 0x82, 0x34, 0x18, 0x34, 0x03,
+    0x30, 0x80, 0xA0, 0x02, 0x00, 0x89, 0x0C, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x0C, 0xC3, 0x30, 0x0C,
+    0x87, 0x4A, 0xC3, 0x30, 0x0C, 0xCA, 0x30, 0x4C, 0xA3, 0x02, 0x00, 0x09, 0x00, 0x82, 0x2E, 0x82,
+    0x64, 0x0B, 0x00,
+};
+// clang-format on
@@ -0,0 +1,334 @@
+// Copyright 2023 QMK -- generated source code only, font retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-font-image -i aileron16.png -f mono16`
+
+#include <qp.h>
+
+const uint32_t font_aileron16_length = 5134;
+
+// clang-format off
+const uint8_t font_aileron16[5134] = {
+    0x00, 0xFF, 0x14, 0x00, 0x00, 0x51, 0x46, 0x46, 0x01, 0x0E, 0x14, 0x00, 0x00, 0xF1, 0xEB, 0xFF,
+    0xFF, 0x11, 0x01, 0x00, 0x00, 0x02, 0x00, 0x01, 0xFF, 0x01, 0xFE, 0x1D, 0x01, 0x00, 0x03, 0x00,
+    0x00, 0x84, 0x00, 0x00, 0x45, 0x07, 0x00, 0x49, 0x0B, 0x00, 0x89, 0x19, 0x00, 0xCC, 0x2B, 0x00,
+    0x8B, 0x3D, 0x00, 0x43, 0x4E, 0x00, 0x06, 0x51, 0x00, 0x85, 0x5E, 0x00, 0x49, 0x68, 0x00, 0xCA,
+    0x71, 0x00, 0x84, 0x7B, 0x00, 0x84, 0x7E, 0x00, 0xC3, 0x80, 0x00, 0x05, 0x83, 0x00, 0xC9, 0x8B,
+    0x00, 0xC9, 0x99, 0x00, 0x49, 0xA7, 0x00, 0x89, 0xB6, 0x00, 0x89, 0xC4, 0x00, 0x89, 0xD2, 0x00,
+    0x89, 0xE0, 0x00, 0x49, 0xEE, 0x00, 0x89, 0xFC, 0x00, 0x49, 0x0A, 0x01, 0x03, 0x18, 0x01, 0x03,
+    0x1C, 0x01, 0x8A, 0x20, 0x01, 0x49, 0x2C, 0x01, 0xC9, 0x32, 0x01, 0xC9, 0x3D, 0x01, 0x8E, 0x4B,
+    0x01, 0x0B, 0x65, 0x01, 0xCB, 0x76, 0x01, 0xCB, 0x87, 0x01, 0x8C, 0x97, 0x01, 0x4A, 0xAB, 0x01,
+    0x4A, 0xB9, 0x01, 0x4C, 0xC6, 0x01, 0xCC, 0xD8, 0x01, 0x05, 0xED, 0x01, 0x09, 0xF5, 0x01, 0xCB,
+    0x01, 0x02, 0x0A, 0x13, 0x02, 0xCE, 0x1F, 0x02, 0x8C, 0x34, 0x02, 0x0C, 0x46, 0x02, 0x4B, 0x59,
+    0x02, 0xCC, 0x68, 0x02, 0xCB, 0x7D, 0x02, 0xC9, 0x8E, 0x02, 0xCA, 0x9C, 0x02, 0x8B, 0xAB, 0x02,
+    0x8B, 0xBD, 0x02, 0x10, 0xCF, 0x02, 0x8A, 0xE7, 0x02, 0x8A, 0xF7, 0x02, 0xCA, 0x05, 0x03, 0xC6,
+    0x15, 0x03, 0xC5, 0x24, 0x03, 0xC5, 0x2E, 0x03, 0x89, 0x39, 0x03, 0xC8, 0x42, 0x03, 0x85, 0x46,
+    0x03, 0xC9, 0x48, 0x03, 0x0A, 0x54, 0x03, 0x09, 0x64, 0x03, 0x4A, 0x6F, 0x03, 0xC9, 0x7E, 0x03,
+    0x86, 0x8A, 0x03, 0xCA, 0x96, 0x03, 0x49, 0xA6, 0x03, 0x04, 0xB5, 0x03, 0x84, 0xBC, 0x03, 0x09,
+    0xC5, 0x03, 0x84, 0xD4, 0x03, 0xCE, 0xDB, 0x03, 0xC9, 0xEC, 0x03, 0x0A, 0xF8, 0x03, 0x4A, 0x04,
+    0x04, 0xCA, 0x13, 0x04, 0x46, 0x23, 0x04, 0x08, 0x2B, 0x04, 0x46, 0x35, 0x04, 0x09, 0x40, 0x04,
+    0x49, 0x4B, 0x04, 0xCD, 0x56, 0x04, 0xC8, 0x66, 0x04, 0x49, 0x71, 0x04, 0xC8, 0x80, 0x04, 0x85,
+    0x8C, 0x04, 0x05, 0x97, 0x04, 0x06, 0xA2, 0x04, 0x09, 0xB0, 0x04, 0x04, 0xFB, 0xCE, 0x12, 0x00,
+    0x1A, 0x00, 0x06, 0x00, 0x95, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80,
+    0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x10, 0x01, 0xD0, 0x0D, 0xC0, 0x0C, 0x06, 0x00, 0x05, 0x00, 0x82,
+    0xF0, 0xF8, 0x08, 0x02, 0x8F, 0x82, 0xF0, 0xF8, 0x08, 0x02, 0x8F, 0x1C, 0x00, 0x0F, 0x00, 0x86,
+    0xE0, 0x90, 0x05, 0x00, 0x30, 0x0B, 0x1C, 0x02, 0x00, 0x8A, 0x77, 0xD1, 0x00, 0x60, 0xFE, 0xEE,
+    0xEF, 0x02, 0x00, 0x1D, 0x68, 0x02, 0x00, 0x84, 0xC2, 0xB0, 0x03, 0x00, 0xED, 0x02, 0xEF, 0x88,
+    0x0A, 0x20, 0x79, 0xC4, 0x12, 0x00, 0xB0, 0x53, 0x09, 0x02, 0x00, 0x81, 0x1D, 0x68, 0x02, 0x00,
+    0x82, 0xC1, 0xB0, 0x03, 0x0F, 0x00, 0x06, 0x00, 0x80, 0xF8, 0x03, 0x00, 0x93, 0xC5, 0x9F, 0x02,
+    0x00, 0xF7, 0xFC, 0xEA, 0x02, 0xD0, 0x89, 0x0F, 0xAD, 0x00, 0x8E, 0xF8, 0x50, 0x06, 0xC0, 0x8C,
+    0x0F, 0x02, 0x00, 0x82, 0xE4, 0xFF, 0x18, 0x02, 0x00, 0x82, 0xB2, 0xEF, 0x2D, 0x02, 0x00, 0x93,
+    0xF8, 0xD1, 0x0B, 0x83, 0x81, 0x0F, 0xE8, 0x50, 0x5F, 0xF8, 0x90, 0x0D, 0xE1, 0xAD, 0x5F, 0x7E,
+    0x00, 0xC3, 0xFF, 0x7D, 0x02, 0x00, 0x81, 0x80, 0x0F, 0x03, 0x00, 0x80, 0x84, 0x07, 0x00, 0x12,
+    0x00, 0x96, 0x40, 0xFC, 0x4C, 0x00, 0xE5, 0x02, 0xD0, 0x3B, 0xDB, 0x10, 0x7D, 0x00, 0xE0, 0x1A,
+    0xEA, 0x90, 0x0C, 0x00, 0x50, 0xFE, 0x5E, 0xF3, 0x03, 0x02, 0x00, 0x82, 0x20, 0x00, 0x9C, 0x04,
+    0x00, 0x81, 0x70, 0x1E, 0x04, 0x00, 0x83, 0xE2, 0x85, 0xEE, 0x08, 0x02, 0x00, 0x95, 0xBA, 0xF4,
+    0x44, 0x4F, 0x00, 0x50, 0x2E, 0xF7, 0x00, 0x7F, 0x00, 0xD1, 0x07, 0xF4, 0x66, 0x4F, 0x00, 0xC9,
+    0x00, 0x80, 0xEE, 0x08, 0x12, 0x00, 0x11, 0x00, 0x88, 0x30, 0xEA, 0xEF, 0x03, 0x00, 0x30, 0xAF,
+    0x23, 0x13, 0x02, 0x00, 0x96, 0xF7, 0x01, 0x00, 0x24, 0x00, 0x30, 0x6F, 0x00, 0xF0, 0x08, 0x00,
+    0x30, 0xFD, 0xEE, 0xFF, 0x0E, 0x20, 0xAD, 0x25, 0xF2, 0x29, 0x00, 0xCB, 0x02, 0x00, 0x88, 0x8F,
+    0x00, 0xE0, 0x08, 0x00, 0xF0, 0x08, 0x00, 0xAE, 0x02, 0x00, 0x8B, 0x8F, 0x00, 0x80, 0x8F, 0x23,
+    0xF3, 0x08, 0x00, 0x60, 0xEC, 0xEF, 0x5C, 0x12, 0x00, 0x03, 0x00, 0x85, 0xF0, 0x08, 0x8F, 0xF0,
+    0x08, 0x8F, 0x11, 0x00, 0x04, 0x00, 0x89, 0x10, 0x2D, 0x00, 0x80, 0x0A, 0x00, 0xE1, 0x04, 0x00,
+    0xE6, 0x02, 0x00, 0x80, 0xBA, 0x02, 0x00, 0x80, 0x9D, 0x02, 0x00, 0x80, 0x8E, 0x02, 0x00, 0x80,
+    0x8E, 0x02, 0x00, 0x80, 0x9D, 0x02, 0x00, 0x80, 0xBA, 0x02, 0x00, 0x80, 0xE6, 0x02, 0x00, 0x87,
+    0xE1, 0x04, 0x00, 0x80, 0x0A, 0x00, 0x10, 0x2D, 0x06, 0x00, 0x02, 0x00, 0xA1, 0x90, 0x06, 0x00,
+    0xE2, 0x01, 0x00, 0x8C, 0x00, 0x70, 0x0E, 0x00, 0xF4, 0x03, 0x10, 0x6F, 0x00, 0xF0, 0x07, 0x00,
+    0x7F, 0x00, 0xF1, 0x06, 0x40, 0x3F, 0x00, 0xE7, 0x00, 0xC0, 0x08, 0x20, 0x1E, 0x00, 0x69, 0x07,
+    0x00, 0x1D, 0x00, 0x80, 0x0D, 0x03, 0x00, 0x80, 0xD0, 0x02, 0x00, 0x87, 0x70, 0x4A, 0x4D, 0x7A,
+    0x00, 0x30, 0xF9, 0x49, 0x02, 0x00, 0x81, 0xB0, 0xB5, 0x02, 0x00, 0x82, 0x90, 0x08, 0x98, 0x02,
+    0x00, 0x82, 0x03, 0x00, 0x03, 0x13, 0x00, 0x1B, 0x00, 0x80, 0x8F, 0x04, 0x00, 0x80, 0x8F, 0x04,
+    0x00, 0x80, 0x8F, 0x04, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x89, 0xD0, 0xEE, 0xFF, 0xEE, 0x06, 0x20,
+    0x22, 0x9F, 0x22, 0x01, 0x02, 0x00, 0x80, 0x8F, 0x04, 0x00, 0x80, 0x8F, 0x16, 0x00, 0x18, 0x00,
+    0x86, 0xA0, 0x0D, 0xE0, 0x08, 0xF4, 0x02, 0xB9, 0x03, 0x00, 0x12, 0x00, 0x83, 0xE7, 0xDE, 0x21,
+    0x22, 0x0C, 0x00, 0x11, 0x00, 0x83, 0x01, 0xD0, 0x05, 0x5C, 0x05, 0x00, 0x07, 0x00, 0x82, 0x03,
+    0x00, 0x80, 0x02, 0x00, 0x97, 0x0D, 0x00, 0xC3, 0x00, 0x80, 0x07, 0x00, 0x2C, 0x00, 0xC2, 0x00,
+    0x70, 0x08, 0x00, 0x3C, 0x00, 0xD2, 0x00, 0x70, 0x08, 0x00, 0x3B, 0x00, 0x70, 0x07, 0x00, 0x0E,
+    0x00, 0x92, 0x30, 0xEB, 0xBE, 0x03, 0x20, 0xBE, 0x33, 0xEB, 0x02, 0xE8, 0x01, 0x10, 0x8E, 0xC0,
+    0x0A, 0x00, 0xA0, 0x0C, 0x8E, 0x02, 0x00, 0x86, 0xE8, 0xF0, 0x08, 0x00, 0x80, 0x0F, 0x8E, 0x02,
+    0x00, 0x92, 0xE8, 0xC0, 0x0A, 0x00, 0xA0, 0x0C, 0xE8, 0x01, 0x10, 0x8E, 0x20, 0xBE, 0x33, 0xEB,
+    0x02, 0x30, 0xEB, 0xBE, 0x03, 0x0E, 0x00, 0x0F, 0x00, 0x81, 0xA2, 0x8F, 0x02, 0x00, 0x86, 0xF8,
+    0xFB, 0x08, 0x00, 0xD0, 0x05, 0x8F, 0x02, 0x00, 0x82, 0x01, 0xF0, 0x08, 0x03, 0x00, 0x80, 0x8F,
+    0x03, 0x00, 0x81, 0xF0, 0x08, 0x03, 0x00, 0x80, 0x8F, 0x03, 0x00, 0x81, 0xF0, 0x08, 0x03, 0x00,
+    0x80, 0x8F, 0x03, 0x00, 0x81, 0xF0, 0x08, 0x03, 0x00, 0x80, 0x8F, 0x0F, 0x00, 0x0E, 0x00, 0x91,
+    0x20, 0xEA, 0xBE, 0x03, 0x10, 0xAE, 0x33, 0xEB, 0x02, 0xE7, 0x00, 0x20, 0x6F, 0x60, 0x07, 0x00,
+    0xF1, 0x06, 0x02, 0x00, 0x81, 0x70, 0x2F, 0x02, 0x00, 0x81, 0x40, 0x6F, 0x02, 0x00, 0x81, 0x40,
+    0x8E, 0x02, 0x00, 0x81, 0x40, 0x8E, 0x02, 0x00, 0x81, 0x40, 0x7E, 0x02, 0x00, 0x81, 0x40, 0x8F,
+    0x02, 0x11, 0x80, 0x01, 0x03, 0xFF, 0x80, 0x8F, 0x0E, 0x00, 0x0E, 0x00, 0x8C, 0x20, 0xEA, 0xCE,
+    0x04, 0x10, 0xAE, 0x23, 0xF8, 0x03, 0xC4, 0x01, 0x10, 0x7F, 0x02, 0x00, 0x86, 0x10, 0xF8, 0x05,
+    0x00, 0x70, 0xFF, 0x0A, 0x02, 0x00, 0x81, 0x31, 0x67, 0x04, 0x00, 0x86, 0x8B, 0xB0, 0x07, 0x00,
+    0x80, 0x0E, 0xC9, 0x02, 0x00, 0x89, 0xDB, 0x20, 0xAF, 0x33, 0xF9, 0x06, 0x30, 0xEB, 0xBE, 0x04,
+    0x0E, 0x00, 0x10, 0x00, 0x81, 0xC1, 0x0F, 0x02, 0x00, 0x81, 0x90, 0xFF, 0x02, 0x00, 0x86, 0x50,
+    0x9E, 0x0F, 0x00, 0x20, 0x6E, 0xF8, 0x02, 0x00, 0x90, 0xAC, 0x80, 0x0F, 0x00, 0xD8, 0x01, 0xF8,
+    0x00, 0xE4, 0x03, 0x80, 0x0F, 0xE0, 0xEF, 0xEE, 0xFF, 0x0E, 0x02, 0x22, 0x81, 0x92, 0x2F, 0x03,
+    0x00, 0x80, 0xF8, 0x03, 0x00, 0x81, 0x80, 0x0F, 0x0E, 0x00, 0x0E, 0x00, 0x80, 0xF4, 0x02, 0xFF,
+    0x82, 0x1F, 0x60, 0x1D, 0x02, 0x11, 0x81, 0x00, 0xA8, 0x03, 0x00, 0x8D, 0xA0, 0xA9, 0xDE, 0x19,
+    0x00, 0xEC, 0x37, 0xE5, 0x0B, 0xB0, 0x07, 0x00, 0xF5, 0x04, 0x02, 0x00, 0x92, 0x10, 0x6F, 0x81,
+    0x02, 0x00, 0xF1, 0x07, 0x8E, 0x00, 0x50, 0x3F, 0x80, 0x6F, 0x52, 0xAE, 0x00, 0x70, 0xFD, 0x7D,
+    0x0F, 0x00, 0x0F, 0x00, 0x9A, 0xD8, 0xDF, 0x07, 0x00, 0xBB, 0x23, 0xF6, 0x07, 0xE5, 0x01, 0x00,
+    0x76, 0xB0, 0x6A, 0xED, 0x4B, 0x00, 0xDD, 0x3A, 0xA4, 0x4F, 0xF0, 0x0D, 0x00, 0xD0, 0x0C, 0x9F,
+    0x02, 0x00, 0x86, 0xF9, 0xD0, 0x08, 0x00, 0x80, 0x0E, 0xDA, 0x02, 0x00, 0x89, 0xBD, 0x30, 0xAF,
+    0x33, 0xEA, 0x03, 0x30, 0xEB, 0xBE, 0x03, 0x0E, 0x00, 0x0E, 0x00, 0x03, 0xFF, 0x81, 0xEF, 0x10,
+    0x02, 0x11, 0x81, 0xE2, 0x08, 0x02, 0x00, 0x81, 0x70, 0x1E, 0x02, 0x00, 0x81, 0x10, 0x7E, 0x03,
+    0x00, 0x80, 0xD9, 0x03, 0x00, 0x81, 0xF2, 0x05, 0x02, 0x00, 0x81, 0xA0, 0x0C, 0x02, 0x00, 0x81,
+    0x30, 0x4F, 0x03, 0x00, 0x80, 0xBC, 0x03, 0x00, 0x81, 0xF5, 0x03, 0x02, 0x00, 0x81, 0xD0, 0x09,
+    0x10, 0x00, 0x0E, 0x00, 0x92, 0x40, 0xEC, 0xBE, 0x03, 0x30, 0x9F, 0x22, 0xE9, 0x02, 0xF7, 0x01,
+    0x10, 0x6F, 0x30, 0x7E, 0x00, 0xF7, 0x05, 0x50, 0x02, 0xFF, 0x9B, 0x0B, 0x40, 0x8E, 0x43, 0x5C,
+    0x00, 0xBC, 0x00, 0x30, 0x3F, 0xF0, 0x08, 0x00, 0xF1, 0x07, 0xBD, 0x00, 0x30, 0x6F, 0x70, 0x7F,
+    0x32, 0xEC, 0x01, 0x60, 0xEC, 0xAE, 0x02, 0x0E, 0x00, 0x0E, 0x00, 0x89, 0x40, 0xEB, 0xBE, 0x03,
+    0x40, 0x9F, 0x33, 0xF9, 0x03, 0xBC, 0x02, 0x00, 0x86, 0x9B, 0xF0, 0x08, 0x00, 0x80, 0x0D, 0xAD,
+    0x02, 0x00, 0x9A, 0xFB, 0x80, 0x6F, 0x11, 0xE7, 0x0F, 0x70, 0xFE, 0xAF, 0xD9, 0x20, 0x02, 0x11,
+    0xB0, 0x0A, 0xBB, 0x00, 0x10, 0x5E, 0x50, 0x8F, 0x32, 0xBC, 0x00, 0x50, 0xFC, 0x8D, 0x0F, 0x00,
+    0x08, 0x00, 0x83, 0x5C, 0xD0, 0x05, 0x01, 0x05, 0x00, 0x83, 0x01, 0xD0, 0x05, 0x5C, 0x05, 0x00,
+    0x08, 0x00, 0x83, 0xC0, 0x00, 0x0D, 0x10, 0x06, 0x00, 0x85, 0x10, 0x0F, 0xD5, 0xA0, 0x09, 0x5E,
+    0x02, 0x00, 0x1D, 0x00, 0x80, 0x01, 0x03, 0x00, 0x81, 0xB4, 0x07, 0x02, 0x00, 0x81, 0xB3, 0x5D,
+    0x02, 0x00, 0x81, 0xB3, 0x5C, 0x03, 0x00, 0x80, 0x7F, 0x04, 0x00, 0x81, 0xD6, 0x2A, 0x03, 0x00,
+    0x82, 0x10, 0xE7, 0x2A, 0x03, 0x00, 0x82, 0x10, 0xE7, 0x06, 0x03, 0x00, 0x81, 0x10, 0x03, 0x0F,
+    0x00, 0x20, 0x00, 0x80, 0xEA, 0x02, 0xEE, 0x81, 0x0E, 0x10, 0x03, 0x22, 0x05, 0x00, 0x80, 0xA0,
+    0x03, 0xEE, 0x81, 0x00, 0x21, 0x02, 0x22, 0x80, 0x02, 0x17, 0x00, 0x17, 0x00, 0x80, 0x01, 0x03,
+    0x00, 0x81, 0xE0, 0x18, 0x03, 0x00, 0x82, 0xA2, 0x7E, 0x01, 0x02, 0x00, 0x82, 0x20, 0xE9, 0x17,
+    0x03, 0x00, 0x81, 0xD2, 0x07, 0x02, 0x00, 0x88, 0xD5, 0x2A, 0x00, 0x50, 0xBD, 0x03, 0x00, 0xD0,
+    0x3B, 0x03, 0x00, 0x80, 0x04, 0x11, 0x00, 0x0E, 0x00, 0x90, 0x60, 0xEC, 0x8D, 0x01, 0x70, 0x6F,
+    0x52, 0x9E, 0x00, 0xAD, 0x00, 0x80, 0x0E, 0x30, 0x02, 0x00, 0xDA, 0x03, 0x00, 0x81, 0xF3, 0x05,
+    0x02, 0x00, 0x81, 0xD1, 0x07, 0x02, 0x00, 0x81, 0xB0, 0x07, 0x02, 0x00, 0x81, 0x20, 0x0B, 0x03,
+    0x00, 0x80, 0x10, 0x03, 0x00, 0x81, 0x60, 0x0D, 0x03, 0x00, 0x80, 0xC5, 0x10, 0x00, 0x17, 0x00,
+    0x83, 0x81, 0xEC, 0xAD, 0x03, 0x02, 0x00, 0x84, 0x50, 0xBE, 0x35, 0xA4, 0x6F, 0x02, 0x00, 0x81,
+    0xF5, 0x06, 0x02, 0x00, 0xB4, 0xF8, 0x03, 0x10, 0x8E, 0x80, 0xDD, 0x96, 0xE0, 0x0A, 0x80, 0x1E,
+    0xE9, 0x55, 0xBE, 0x90, 0x0D, 0xC0, 0x2B, 0x6F, 0x00, 0x8D, 0x80, 0x0F, 0xE0, 0x68, 0x1F, 0x00,
+    0x5F, 0x90, 0x0E, 0xF0, 0x78, 0x0F, 0x40, 0x1F, 0xC0, 0x0B, 0xD0, 0x49, 0x5F, 0xC2, 0x1F, 0xF7,
+    0x03, 0xA0, 0x0D, 0xE8, 0x4C, 0xEC, 0x4C, 0x00, 0x40, 0x7F, 0x03, 0x00, 0x80, 0x01, 0x02, 0x00,
+    0x84, 0xF7, 0x28, 0x10, 0xC5, 0x06, 0x02, 0x00, 0x83, 0x50, 0xFC, 0xFF, 0x4B, 0x04, 0x00, 0x81,
+    0x10, 0x02, 0x03, 0x00, 0x12, 0x00, 0x81, 0xB0, 0x7F, 0x03, 0x00, 0x82, 0x20, 0xBF, 0x0C, 0x03,
+    0x00, 0x82, 0xD7, 0xF3, 0x02, 0x02, 0x00, 0x82, 0xC0, 0x07, 0x7D, 0x02, 0x00, 0x83, 0x30, 0x2F,
+    0x90, 0x0D, 0x02, 0x00, 0x85, 0xC8, 0x00, 0xF4, 0x03, 0x00, 0xD0, 0x02, 0xFF, 0x88, 0x8F, 0x00,
+    0x40, 0x4F, 0x33, 0xA3, 0x0D, 0x00, 0xC9, 0x02, 0x00, 0x83, 0xF4, 0x03, 0xE1, 0x07, 0x02, 0x00,
+    0x82, 0x9D, 0x50, 0x2F, 0x02, 0x00, 0x81, 0x80, 0x0E, 0x11, 0x00, 0x11, 0x00, 0x83, 0xF0, 0xFF,
+    0xEF, 0x4B, 0x02, 0x00, 0x93, 0x8F, 0x11, 0x92, 0x3F, 0x00, 0xF0, 0x08, 0x00, 0xF1, 0x07, 0x00,
+    0x8F, 0x00, 0x71, 0x5F, 0x00, 0xF0, 0xEF, 0xFE, 0xAF, 0x02, 0x00, 0x8B, 0x9F, 0x22, 0x73, 0x08,
+    0x00, 0xF0, 0x08, 0x00, 0xB0, 0x0A, 0x00, 0x8F, 0x02, 0x00, 0x8D, 0xE8, 0x00, 0xF0, 0x08, 0x00,
+    0xA0, 0x0D, 0x00, 0x8F, 0x11, 0x72, 0x7F, 0x00, 0xF0, 0x02, 0xFF, 0x80, 0x6C, 0x12, 0x00, 0x12,
+    0x00, 0x90, 0xB4, 0xEE, 0x7C, 0x01, 0x00, 0xF7, 0x38, 0x52, 0xBD, 0x00, 0xF4, 0x06, 0x00, 0x30,
+    0x5F, 0xA0, 0x0D, 0x02, 0x00, 0x82, 0x90, 0x07, 0xAE, 0x04, 0x00, 0x81, 0xF0, 0x08, 0x04, 0x00,
+    0x80, 0xAE, 0x04, 0x00, 0x81, 0xB0, 0x0D, 0x02, 0x00, 0x8B, 0xA0, 0x06, 0xF5, 0x06, 0x00, 0x40,
+    0x4F, 0x00, 0xF9, 0x27, 0x62, 0xAE, 0x02, 0x00, 0x82, 0xC6, 0xFE, 0x7C, 0x12, 0x00, 0x13, 0x00,
+    0x02, 0xFF, 0x81, 0xBE, 0x05, 0x02, 0x00, 0x83, 0x8F, 0x21, 0x83, 0x9F, 0x02, 0x00, 0x80, 0x8F,
+    0x02, 0x00, 0x83, 0xF5, 0x05, 0x00, 0x8F, 0x02, 0x00, 0x83, 0xC0, 0x0B, 0x00, 0x8F, 0x02, 0x00,
+    0x83, 0x90, 0x0E, 0x00, 0x8F, 0x02, 0x00, 0x83, 0x80, 0x0F, 0x00, 0x8F, 0x02, 0x00, 0x83, 0x90,
+    0x0E, 0x00, 0x8F, 0x02, 0x00, 0x83, 0xD0, 0x0A, 0x00, 0x8F, 0x02, 0x00, 0x86, 0xF6, 0x04, 0x00,
+    0x8F, 0x11, 0x83, 0x7F, 0x02, 0x00, 0x02, 0xFF, 0x81, 0xBE, 0x04, 0x13, 0x00, 0x10, 0x00, 0x03,
+    0xFF, 0x82, 0x5F, 0x00, 0x8F, 0x02, 0x11, 0x82, 0x01, 0x00, 0x8F, 0x04, 0x00, 0x80, 0x8F, 0x04,
+    0x00, 0x80, 0x8F, 0x04, 0x00, 0x80, 0xFF, 0x02, 0xEE, 0x82, 0x0C, 0x00, 0x9F, 0x02, 0x22, 0x82,
+    0x02, 0x00, 0x8F, 0x04, 0x00, 0x80, 0x8F, 0x04, 0x00, 0x80, 0x8F, 0x03, 0x11, 0x80, 0x00, 0x03,
+    0xFF, 0x80, 0x7F, 0x0F, 0x00, 0x10, 0x00, 0x03, 0xFF, 0x82, 0x5F, 0x00, 0x8F, 0x02, 0x11, 0x82,
+    0x01, 0x00, 0x8F, 0x04, 0x00, 0x80, 0x8F, 0x04, 0x00, 0x80, 0x8F, 0x04, 0x00, 0x80, 0xFF, 0x02,
+    0xEE, 0x82, 0x0A, 0x00, 0x9F, 0x02, 0x22, 0x82, 0x01, 0x00, 0x8F, 0x04, 0x00, 0x80, 0x8F, 0x04,
+    0x00, 0x80, 0x8F, 0x04, 0x00, 0x80, 0x8F, 0x12, 0x00, 0x13, 0x00, 0x83, 0x40, 0xEB, 0xDE, 0x18,
+    0x02, 0x00, 0x86, 0xF7, 0x27, 0x62, 0xCE, 0x01, 0x40, 0x6F, 0x02, 0x00, 0x83, 0xF6, 0x06, 0xA0,
+    0x0D, 0x02, 0x00, 0x83, 0x60, 0x04, 0xE0, 0x09, 0x04, 0x00, 0x8D, 0xF0, 0x08, 0x00, 0xE9, 0xEE,
+    0x07, 0xE0, 0x0A, 0x00, 0x21, 0xF3, 0x08, 0xB0, 0x0D, 0x02, 0x00, 0x83, 0xF3, 0x08, 0x50, 0x6F,
+    0x02, 0x00, 0x8D, 0xFA, 0x08, 0x00, 0xFA, 0x27, 0x92, 0xFA, 0x08, 0x00, 0x70, 0xFC, 0x9E, 0xF1,
+    0x08, 0x12, 0x00, 0x13, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x83, 0x80, 0x0F, 0x00, 0x8F, 0x02, 0x00,
+    0x83, 0x80, 0x0F, 0x00, 0x8F, 0x02, 0x00, 0x83, 0x80, 0x0F, 0x00, 0x8F, 0x02, 0x00, 0x83, 0x80,
+    0x0F, 0x00, 0x8F, 0x02, 0x00, 0x83, 0x80, 0x0F, 0x00, 0xFF, 0x02, 0xEE, 0x83, 0xFE, 0x0F, 0x00,
+    0x9F, 0x02, 0x22, 0x83, 0x92, 0x0F, 0x00, 0x8F, 0x02, 0x00, 0x83, 0x80, 0x0F, 0x00, 0x8F, 0x02,
+    0x00, 0x83, 0x80, 0x0F, 0x00, 0x8F, 0x02, 0x00, 0x83, 0x80, 0x0F, 0x00, 0x8F, 0x02, 0x00, 0x81,
+    0x80, 0x0F, 0x12, 0x00, 0x08, 0x00, 0x9A, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0, 0x08, 0x00, 0x8F,
+    0x00, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0, 0x08, 0x00, 0x8F, 0x00,
+    0xF0, 0x08, 0x08, 0x00, 0x10, 0x00, 0x81, 0x80, 0x0F, 0x03, 0x00, 0x80, 0xF8, 0x03, 0x00, 0x81,
+    0x80, 0x0F, 0x03, 0x00, 0x80, 0xF8, 0x03, 0x00, 0x81, 0x80, 0x0F, 0x03, 0x00, 0x80, 0xF8, 0x03,
+    0x00, 0x92, 0x80, 0x0F, 0xE0, 0x07, 0x00, 0xF8, 0x00, 0x9D, 0x00, 0xA0, 0x0D, 0x80, 0x5E, 0x62,
+    0x8F, 0x00, 0x70, 0xED, 0x7D, 0x0F, 0x00, 0x11, 0x00, 0x8E, 0xF0, 0x08, 0x00, 0x80, 0x3E, 0x00,
+    0x8F, 0x00, 0x70, 0x3E, 0x00, 0xF0, 0x08, 0x60, 0x4F, 0x02, 0x00, 0x82, 0x8F, 0x50, 0x5F, 0x02,
+    0x00, 0x82, 0xF0, 0x48, 0x6F, 0x03, 0x00, 0x81, 0xBF, 0xCE, 0x03, 0x00, 0x82, 0xF0, 0x9F, 0x8F,
+    0x03, 0x00, 0x82, 0x9F, 0x70, 0x5F, 0x02, 0x00, 0x83, 0xF0, 0x08, 0xA0, 0x3F, 0x02, 0x00, 0x89,
+    0x8F, 0x00, 0xC1, 0x2E, 0x00, 0xF0, 0x08, 0x00, 0xE2, 0x1C, 0x11, 0x00, 0x10, 0x00, 0x80, 0x8F,
+    0x04, 0x00, 0x80, 0x8F, 0x04, 0x00, 0x80, 0x8F, 0x04, 0x00, 0x80, 0x8F, 0x04, 0x00, 0x80, 0x8F,
+    0x04, 0x00, 0x80, 0x8F, 0x04, 0x00, 0x80, 0x8F, 0x04, 0x00, 0x80, 0x8F, 0x04, 0x00, 0x80, 0x8F,
+    0x04, 0x00, 0x80, 0x9F, 0x02, 0x22, 0x81, 0x12, 0x00, 0x03, 0xFF, 0x80, 0x7F, 0x0F, 0x00, 0x16,
+    0x00, 0x81, 0xFF, 0x08, 0x02, 0x00, 0x84, 0xF7, 0x0F, 0x00, 0xEF, 0x0D, 0x02, 0x00, 0xC0, 0xEC,
+    0x0F, 0x00, 0xAF, 0x3F, 0x00, 0x20, 0x9F, 0x0F, 0x00, 0x8F, 0x7C, 0x00, 0x70, 0x8C, 0x0F, 0x00,
+    0x8F, 0xC7, 0x00, 0xC0, 0x87, 0x0F, 0x00, 0x8F, 0xF2, 0x02, 0xF1, 0x82, 0x0F, 0x00, 0x8F, 0xD0,
+    0x07, 0xC6, 0x80, 0x0F, 0x00, 0x8F, 0x80, 0x0C, 0x7B, 0x80, 0x0F, 0x00, 0x8F, 0x20, 0x3F, 0x2F,
+    0x80, 0x0F, 0x00, 0x8F, 0x00, 0xCD, 0x0C, 0x80, 0x0F, 0x00, 0x8F, 0x00, 0xF7, 0x07, 0x80, 0x0F,
+    0x15, 0x00, 0x13, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0xF0, 0x08, 0x00, 0xDF, 0x1E, 0x00, 0xF0, 0x08,
+    0x00, 0x8F, 0x7D, 0x00, 0xF0, 0x08, 0x00, 0x8F, 0xE6, 0x01, 0xF0, 0x08, 0x00, 0x8F, 0xE0, 0x07,
+    0xF0, 0x08, 0x00, 0x8F, 0x70, 0x1E, 0xF0, 0x08, 0x00, 0x8F, 0x10, 0x7E, 0xF0, 0x08, 0x00, 0x8F,
+    0x00, 0xE7, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xE1, 0xF6, 0x08, 0x00, 0x8F, 0x00, 0x70, 0xFD, 0x08,
+    0x00, 0x8F, 0x00, 0x10, 0xFE, 0x08, 0x12, 0x00, 0x13, 0x00, 0x83, 0x50, 0xEB, 0xDF, 0x19, 0x02,
+    0x00, 0x86, 0xF8, 0x38, 0x42, 0xDC, 0x02, 0x40, 0x6F, 0x02, 0x00, 0x83, 0xD0, 0x0C, 0xB0, 0x0D,
+    0x02, 0x00, 0x83, 0x50, 0x3F, 0xE0, 0x0A, 0x02, 0x00, 0x83, 0x20, 0x6F, 0xF0, 0x08, 0x02, 0x00,
+    0x83, 0x10, 0x7F, 0xE0, 0x0A, 0x02, 0x00, 0x83, 0x20, 0x6F, 0xB0, 0x0D, 0x02, 0x00, 0x83, 0x50,
+    0x3F, 0x40, 0x6F, 0x02, 0x00, 0x8C, 0xD0, 0x0C, 0x00, 0xF8, 0x37, 0x42, 0xEC, 0x02, 0x00, 0x50,
+    0xEB, 0xDF, 0x19, 0x13, 0x00, 0x11, 0x00, 0x80, 0xF0, 0x02, 0xFF, 0x80, 0x7C, 0x02, 0x00, 0x8B,
+    0x8F, 0x11, 0x62, 0x8E, 0x00, 0xF0, 0x08, 0x00, 0x90, 0x0E, 0x00, 0x8F, 0x02, 0x00, 0x8F, 0xE8,
+    0x00, 0xF0, 0x08, 0x00, 0xE3, 0x09, 0x00, 0xFF, 0xEE, 0xEF, 0x19, 0x00, 0xF0, 0x29, 0x22, 0x03,
+    0x00, 0x80, 0x8F, 0x04, 0x00, 0x81, 0xF0, 0x08, 0x04, 0x00, 0x80, 0x8F, 0x04, 0x00, 0x81, 0xF0,
+    0x08, 0x14, 0x00, 0x13, 0x00, 0x83, 0x50, 0xEB, 0xDF, 0x18, 0x02, 0x00, 0x86, 0xF8, 0x38, 0x42,
+    0xDC, 0x02, 0x40, 0x6F, 0x02, 0x00, 0x83, 0xD0, 0x0B, 0xB0, 0x0D, 0x02, 0x00, 0x83, 0x50, 0x3F,
+    0xE0, 0x0A, 0x02, 0x00, 0x83, 0x20, 0x6F, 0xF0, 0x08, 0x02, 0x00, 0x83, 0x10, 0x7F, 0xE0, 0x0A,
+    0x02, 0x00, 0x83, 0x20, 0x6F, 0xB0, 0x0D, 0x02, 0x00, 0x83, 0x50, 0x3F, 0x40, 0x6F, 0x02, 0x00,
+    0x8A, 0xD0, 0x0B, 0x00, 0xF8, 0x37, 0x42, 0xDC, 0x01, 0x00, 0x50, 0xEB, 0x02, 0xFF, 0x80, 0x2B,
+    0x04, 0x00, 0x81, 0x30, 0x17, 0x0C, 0x00, 0x11, 0x00, 0x80, 0xF0, 0x02, 0xFF, 0x8E, 0x8D, 0x01,
+    0x00, 0x8F, 0x11, 0x62, 0x9E, 0x00, 0xF0, 0x08, 0x00, 0x90, 0x0E, 0x00, 0x8F, 0x02, 0x00, 0x9E,
+    0xE9, 0x00, 0xF0, 0x08, 0x00, 0xE4, 0x06, 0x00, 0xFF, 0xEE, 0xFF, 0x07, 0x00, 0xF0, 0x29, 0x32,
+    0xEB, 0x01, 0x00, 0x8F, 0x00, 0x20, 0x5F, 0x00, 0xF0, 0x08, 0x00, 0xE0, 0x07, 0x00, 0x8F, 0x02,
+    0x00, 0x86, 0xAB, 0x00, 0xF0, 0x08, 0x00, 0x80, 0x0E, 0x11, 0x00, 0x0E, 0x00, 0x94, 0x60, 0xEC,
+    0x9D, 0x01, 0x80, 0x5E, 0x42, 0xBD, 0x00, 0x8E, 0x00, 0x40, 0x3F, 0xD0, 0x0B, 0x00, 0x30, 0x01,
+    0xF6, 0x6C, 0x02, 0x02, 0x00, 0x82, 0x93, 0xFE, 0x3B, 0x03, 0x00, 0x82, 0xC4, 0x2E, 0x42, 0x02,
+    0x00, 0x8E, 0xF2, 0x46, 0x5F, 0x00, 0x10, 0x6F, 0xB0, 0x6E, 0x32, 0xEB, 0x01, 0x81, 0xED, 0x9D,
+    0x02, 0x0E, 0x00, 0x0F, 0x00, 0x80, 0xF0, 0x04, 0xFF, 0x84, 0x10, 0x11, 0xF1, 0x18, 0x11, 0x02,
+    0x00, 0x81, 0xF0, 0x08, 0x03, 0x00, 0x81, 0xF0, 0x08, 0x03, 0x00, 0x81, 0xF0, 0x08, 0x03, 0x00,
+    0x81, 0xF0, 0x08, 0x03, 0x00, 0x81, 0xF0, 0x08, 0x03, 0x00, 0x81, 0xF0, 0x08, 0x03, 0x00, 0x81,
+    0xF0, 0x08, 0x03, 0x00, 0x81, 0xF0, 0x08, 0x03, 0x00, 0x81, 0xF0, 0x08, 0x10, 0x00, 0x11, 0x00,
+    0x80, 0x8F, 0x02, 0x00, 0x83, 0xF0, 0x08, 0xF0, 0x08, 0x02, 0x00, 0x82, 0x8F, 0x00, 0x8F, 0x02,
+    0x00, 0x83, 0xF0, 0x08, 0xF0, 0x08, 0x02, 0x00, 0x82, 0x8F, 0x00, 0x8F, 0x02, 0x00, 0x83, 0xF0,
+    0x08, 0xF0, 0x08, 0x02, 0x00, 0x82, 0x8F, 0x00, 0x8F, 0x02, 0x00, 0x88, 0xF0, 0x07, 0xF0, 0x08,
+    0x00, 0x10, 0x7F, 0x00, 0xCC, 0x02, 0x00, 0x8B, 0xF5, 0x04, 0x40, 0xAF, 0x23, 0xE6, 0x0B, 0x00,
+    0x40, 0xEB, 0xDE, 0x18, 0x12, 0x00, 0x10, 0x00, 0x81, 0x50, 0x2F, 0x02, 0x00, 0x83, 0x80, 0x0E,
+    0xE0, 0x07, 0x02, 0x00, 0x82, 0x9D, 0x00, 0xC9, 0x02, 0x00, 0x8B, 0xF3, 0x04, 0x40, 0x2F, 0x00,
+    0x80, 0x0D, 0x00, 0xE0, 0x07, 0x00, 0x8D, 0x02, 0x00, 0x88, 0xC9, 0x00, 0xF3, 0x02, 0x00, 0x40,
+    0x2F, 0x80, 0x0C, 0x02, 0x00, 0x82, 0xD0, 0x07, 0x7D, 0x03, 0x00, 0x82, 0xC8, 0xF3, 0x01, 0x02,
+    0x00, 0x82, 0x30, 0xAF, 0x0B, 0x03, 0x00, 0x81, 0xD0, 0x5F, 0x13, 0x00, 0x18, 0x00, 0xAE, 0xF7,
+    0x02, 0x00, 0xF4, 0x0D, 0x00, 0x70, 0x0E, 0xF3, 0x05, 0x00, 0xE8, 0x2F, 0x00, 0xB0, 0x0B, 0xE0,
+    0x09, 0x00, 0x8C, 0x5E, 0x00, 0xE0, 0x06, 0xA0, 0x0C, 0x10, 0x3F, 0x9B, 0x00, 0xF3, 0x02, 0x60,
+    0x1F, 0x50, 0x0E, 0xD7, 0x00, 0xD7, 0x00, 0x20, 0x4F, 0x90, 0x0A, 0xF3, 0x02, 0x9B, 0x02, 0x00,
+    0x85, 0x8D, 0xD0, 0x06, 0xE0, 0x06, 0x5E, 0x02, 0x00, 0x85, 0xB9, 0xF2, 0x02, 0xA0, 0x3A, 0x1F,
+    0x02, 0x00, 0x85, 0xF5, 0xD6, 0x00, 0x60, 0x7D, 0x0B, 0x02, 0x00, 0x85, 0xF1, 0x9D, 0x00, 0x20,
+    0xDF, 0x07, 0x02, 0x00, 0x81, 0xC0, 0x4F, 0x02, 0x00, 0x81, 0xFD, 0x03, 0x19, 0x00, 0x0F, 0x00,
+    0x92, 0xE1, 0x09, 0x00, 0x20, 0x7E, 0x50, 0x4F, 0x00, 0xC0, 0x0B, 0x00, 0xDA, 0x00, 0xE7, 0x02,
+    0x00, 0xE1, 0x28, 0x5F, 0x02, 0x00, 0x82, 0x40, 0xDF, 0x09, 0x03, 0x00, 0x81, 0xFC, 0x02, 0x02,
+    0x00, 0x82, 0x60, 0xCE, 0x0B, 0x02, 0x00, 0x82, 0xE2, 0x25, 0x7E, 0x02, 0x00, 0x8D, 0xAC, 0x00,
+    0xF6, 0x03, 0x80, 0x1E, 0x00, 0xA0, 0x1D, 0xF4, 0x05, 0x00, 0x10, 0x9E, 0x0F, 0x00, 0x0F, 0x00,
+    0x92, 0xE9, 0x01, 0x00, 0x60, 0x2F, 0xE1, 0x08, 0x00, 0xE1, 0x08, 0x70, 0x2F, 0x00, 0xD9, 0x01,
+    0x00, 0xBD, 0x20, 0x5F, 0x02, 0x00, 0x82, 0xF4, 0xB5, 0x0B, 0x02, 0x00, 0x82, 0xA0, 0xFE, 0x03,
+    0x02, 0x00, 0x81, 0x20, 0x9F, 0x04, 0x00, 0x80, 0x8F, 0x04, 0x00, 0x80, 0x8F, 0x04, 0x00, 0x80,
+    0x8F, 0x04, 0x00, 0x80, 0x8F, 0x11, 0x00, 0x0F, 0x00, 0x80, 0xF0, 0x03, 0xFF, 0x81, 0x0F, 0x10,
+    0x02, 0x11, 0x81, 0xE3, 0x0A, 0x03, 0x00, 0x81, 0xDB, 0x01, 0x02, 0x00, 0x81, 0x60, 0x3E, 0x03,
+    0x00, 0x81, 0xE2, 0x05, 0x03, 0x00, 0x80, 0x9C, 0x03, 0x00, 0x81, 0x80, 0x0C, 0x03, 0x00, 0x81,
+    0xE4, 0x02, 0x02, 0x00, 0x81, 0x10, 0x4D, 0x03, 0x00, 0x81, 0xA0, 0x19, 0x02, 0x11, 0x81, 0x01,
+    0xF0, 0x03, 0xFF, 0x80, 0x0F, 0x0F, 0x00, 0x04, 0x00, 0x86, 0xEE, 0x2E, 0x00, 0x9F, 0x02, 0x00,
+    0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x80,
+    0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x80,
+    0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x84, 0xFF, 0x2E, 0x00, 0x22,
+    0x02, 0x03, 0x00, 0x05, 0x00, 0x98, 0xD0, 0x01, 0x00, 0x69, 0x00, 0x40, 0x0B, 0x00, 0xE0, 0x01,
+    0x00, 0x5A, 0x00, 0x50, 0x0A, 0x00, 0xE1, 0x01, 0x00, 0x5A, 0x00, 0x50, 0x0A, 0x00, 0xE1, 0x02,
+    0x00, 0x82, 0x0B, 0x00, 0x60, 0x02, 0x00, 0x80, 0x01, 0x05, 0x00, 0x02, 0x00, 0xA5, 0xA0, 0xEE,
+    0x07, 0x21, 0x8F, 0x00, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0, 0x08,
+    0x00, 0x8F, 0x00, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0, 0x08, 0xEA,
+    0x8F, 0x10, 0x22, 0x01, 0x03, 0x00, 0x0F, 0x00, 0x81, 0x70, 0x02, 0x02, 0x00, 0x81, 0x50, 0x9D,
+    0x03, 0x00, 0x81, 0x3C, 0x1D, 0x02, 0x00, 0x90, 0xC3, 0x80, 0x07, 0x00, 0xA0, 0x06, 0xD2, 0x00,
+    0x10, 0x1E, 0x00, 0x5A, 0x00, 0x98, 0x00, 0x40, 0x0C, 0x20, 0x00, 0x38, 0x00, 0x80, 0xE3, 0x02,
+    0xEE, 0x81, 0x3E, 0x20, 0x02, 0x22, 0x80, 0x02, 0x04, 0x00, 0x05, 0x00, 0x83, 0xE1, 0x03, 0x00,
+    0xA5, 0x22, 0x00, 0x17, 0x00, 0xA7, 0x40, 0xEC, 0xAE, 0x01, 0x30, 0x8F, 0x42, 0xAD, 0x00, 0xC7,
+    0x00, 0x80, 0x0E, 0x00, 0x20, 0x54, 0xFA, 0x00, 0xC2, 0xBE, 0xCA, 0x0F, 0xC0, 0x1D, 0x00, 0xF8,
+    0x00, 0x8F, 0x00, 0xB0, 0x0F, 0xC0, 0x3D, 0x72, 0xFE, 0x01, 0xB2, 0xEE, 0x7A, 0x2F, 0x0E, 0x00,
+    0x0A, 0x00, 0x81, 0xF0, 0x08, 0x03, 0x00, 0x81, 0xF0, 0x08, 0x03, 0x00, 0x81, 0xF0, 0x08, 0x03,
+    0x00, 0xAB, 0xF0, 0x88, 0xFD, 0x4C, 0x00, 0xF0, 0xAD, 0x33, 0xFB, 0x03, 0xF0, 0x0D, 0x00, 0xE0,
+    0x0A, 0xF0, 0x09, 0x00, 0x90, 0x0D, 0xF0, 0x08, 0x00, 0x80, 0x0F, 0xF0, 0x09, 0x00, 0x90, 0x0D,
+    0xF0, 0x0D, 0x00, 0xE1, 0x09, 0xF0, 0xAE, 0x33, 0xEB, 0x02, 0xF0, 0xA8, 0xEE, 0x2A, 0x10, 0x00,
+    0x17, 0x00, 0x92, 0x20, 0xEA, 0xAE, 0x02, 0x20, 0xAE, 0x33, 0xDB, 0x01, 0xDA, 0x00, 0x20, 0x6F,
+    0xE0, 0x09, 0x00, 0x10, 0x01, 0x8F, 0x03, 0x00, 0x81, 0xE0, 0x09, 0x03, 0x00, 0x8C, 0xDB, 0x00,
+    0x20, 0x4F, 0x40, 0xAF, 0x33, 0xCC, 0x00, 0x40, 0xFC, 0x9E, 0x01, 0x0E, 0x00, 0x0D, 0x00, 0x81,
+    0x80, 0x0F, 0x03, 0x00, 0x81, 0x80, 0x0F, 0x03, 0x00, 0xAE, 0x80, 0x0F, 0x00, 0xA2, 0xEE, 0x8A,
+    0x0F, 0x20, 0xBE, 0x33, 0xEA, 0x0F, 0xA0, 0x1E, 0x00, 0xD0, 0x0F, 0xD0, 0x09, 0x00, 0x90, 0x0F,
+    0xF0, 0x08, 0x00, 0x80, 0x0F, 0xD0, 0x09, 0x00, 0x90, 0x0F, 0xA0, 0x0E, 0x00, 0xD0, 0x0F, 0x30,
+    0xAF, 0x33, 0xDA, 0x0F, 0x00, 0xC4, 0xDF, 0x88, 0x0F, 0x0F, 0x00, 0x17, 0x00, 0x92, 0x20, 0xEB,
+    0x9E, 0x01, 0x20, 0xAE, 0x33, 0xAC, 0x00, 0xD9, 0x00, 0x30, 0x3F, 0xE0, 0x09, 0x00, 0xE0, 0x06,
+    0xFF, 0x02, 0xEE, 0x82, 0x7F, 0xE0, 0x29, 0x02, 0x22, 0x8D, 0x01, 0xBB, 0x00, 0x20, 0x3D, 0x30,
+    0x8F, 0x32, 0xCC, 0x00, 0x40, 0xFC, 0x9E, 0x01, 0x0E, 0x00, 0x04, 0x00, 0x86, 0x61, 0x07, 0x00,
+    0xEA, 0x0A, 0x00, 0x8E, 0x02, 0x00, 0x89, 0x8F, 0x00, 0xF0, 0xFF, 0x0F, 0x10, 0x8F, 0x01, 0x00,
+    0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x80,
+    0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x80, 0x8F, 0x0A, 0x00, 0x1A, 0x00, 0xBA, 0xA2, 0xEE,
+    0x8A, 0x0F, 0x20, 0xBE, 0x33, 0xEA, 0x0F, 0xA0, 0x1E, 0x00, 0xD0, 0x0F, 0xD0, 0x09, 0x00, 0x90,
+    0x0F, 0xF0, 0x08, 0x00, 0x80, 0x0F, 0xD0, 0x09, 0x00, 0x90, 0x0F, 0xA0, 0x0E, 0x00, 0xD0, 0x0F,
+    0x30, 0xAF, 0x33, 0xDA, 0x0F, 0x00, 0xC4, 0xDF, 0x88, 0x0F, 0x80, 0x09, 0x00, 0xB0, 0x0C, 0x50,
+    0x7F, 0x32, 0xF8, 0x05, 0x00, 0xC5, 0xEE, 0x4B, 0x00, 0x09, 0x00, 0x81, 0xF0, 0x08, 0x03, 0x00,
+    0x80, 0x8F, 0x03, 0x00, 0x81, 0xF0, 0x08, 0x03, 0x00, 0xA7, 0x8F, 0xE8, 0xAE, 0x01, 0xF0, 0xAD,
+    0x43, 0xAE, 0x00, 0xDF, 0x00, 0x90, 0x0E, 0xF0, 0x09, 0x00, 0xF8, 0x00, 0x8F, 0x00, 0x80, 0x0F,
+    0xF0, 0x08, 0x00, 0xF8, 0x00, 0x8F, 0x00, 0x80, 0x0F, 0xF0, 0x08, 0x00, 0xF8, 0x00, 0x8F, 0x00,
+    0x80, 0x0F, 0x0E, 0x00, 0x04, 0x00, 0x83, 0xA0, 0x04, 0xC0, 0x05, 0x02, 0x00, 0x91, 0xF0, 0x08,
+    0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08,
+    0x06, 0x00, 0x04, 0x00, 0x83, 0xA0, 0x04, 0xC0, 0x05, 0x02, 0x00, 0x97, 0xF0, 0x08, 0xF0, 0x08,
+    0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x07,
+    0xF5, 0x06, 0xCF, 0x01, 0x09, 0x00, 0x81, 0xF0, 0x08, 0x03, 0x00, 0x80, 0x8F, 0x03, 0x00, 0x81,
+    0xF0, 0x08, 0x03, 0x00, 0x8F, 0x8F, 0x00, 0xD1, 0x0B, 0xF0, 0x08, 0xC1, 0x1C, 0x00, 0x8F, 0xB0,
+    0x1C, 0x00, 0xF0, 0x98, 0x1D, 0x02, 0x00, 0x81, 0xDF, 0x8F, 0x02, 0x00, 0x82, 0xF0, 0x8E, 0x5F,
+    0x02, 0x00, 0x8C, 0x8F, 0xA0, 0x3E, 0x00, 0xF0, 0x08, 0xC1, 0x1D, 0x00, 0x8F, 0x00, 0xE2, 0x1C,
+    0x0E, 0x00, 0x04, 0x00, 0x97, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0,
+    0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x19, 0xA0, 0x8F, 0x06, 0x00, 0x23,
+    0x00, 0xBE, 0xF0, 0xB8, 0xDE, 0x16, 0xEB, 0x6D, 0x00, 0xF0, 0x7E, 0x92, 0xCF, 0x27, 0xF9, 0x03,
+    0xF0, 0x0C, 0x10, 0xCF, 0x00, 0xF1, 0x07, 0xF0, 0x09, 0x00, 0x9F, 0x00, 0xF0, 0x07, 0xF0, 0x08,
+    0x00, 0x8F, 0x00, 0xF0, 0x08, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0, 0x08, 0xF0, 0x08, 0x00, 0x8F,
+    0x00, 0xF0, 0x08, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0, 0x08, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0,
+    0x08, 0x15, 0x00, 0x17, 0x00, 0xA7, 0x8F, 0xE8, 0xAE, 0x01, 0xF0, 0xAD, 0x43, 0xAE, 0x00, 0xDF,
+    0x00, 0x90, 0x0E, 0xF0, 0x09, 0x00, 0xF8, 0x00, 0x8F, 0x00, 0x80, 0x0F, 0xF0, 0x08, 0x00, 0xF8,
+    0x00, 0x8F, 0x00, 0x80, 0x0F, 0xF0, 0x08, 0x00, 0xF8, 0x00, 0x8F, 0x00, 0x80, 0x0F, 0x0E, 0x00,
+    0x1A, 0x00, 0x94, 0xA2, 0xFE, 0x6D, 0x00, 0x20, 0xCE, 0x24, 0xF7, 0x08, 0x90, 0x1E, 0x00, 0x70,
+    0x2F, 0xE0, 0x0A, 0x00, 0x20, 0x6F, 0xF0, 0x08, 0x02, 0x00, 0x93, 0x7F, 0xE0, 0x0A, 0x00, 0x20,
+    0x6F, 0x90, 0x1E, 0x00, 0x80, 0x2F, 0x20, 0xCE, 0x24, 0xF7, 0x08, 0x00, 0xA2, 0xFE, 0x7D, 0x10,
+    0x00, 0x19, 0x00, 0xAE, 0xF0, 0x88, 0xFD, 0x4C, 0x00, 0xF0, 0xAD, 0x33, 0xFB, 0x03, 0xF0, 0x0D,
+    0x00, 0xE0, 0x0A, 0xF0, 0x09, 0x00, 0x90, 0x0D, 0xF0, 0x08, 0x00, 0x80, 0x0F, 0xF0, 0x09, 0x00,
+    0x90, 0x0D, 0xF0, 0x0D, 0x00, 0xE1, 0x09, 0xF0, 0xAE, 0x33, 0xEB, 0x02, 0xF0, 0xA8, 0xEE, 0x2A,
+    0x00, 0xF0, 0x08, 0x03, 0x00, 0x81, 0xF0, 0x08, 0x03, 0x00, 0x81, 0xF0, 0x08, 0x03, 0x00, 0x1A,
+    0x00, 0xAB, 0xA2, 0xEE, 0x8A, 0x0F, 0x20, 0xBE, 0x33, 0xEA, 0x0F, 0xA0, 0x1E, 0x00, 0xD0, 0x0F,
+    0xD0, 0x09, 0x00, 0x90, 0x0F, 0xF0, 0x08, 0x00, 0x80, 0x0F, 0xD0, 0x09, 0x00, 0x90, 0x0F, 0xA0,
+    0x0E, 0x00, 0xD0, 0x0F, 0x30, 0xAF, 0x33, 0xDA, 0x0F, 0x00, 0xC4, 0xDF, 0x88, 0x0F, 0x03, 0x00,
+    0x81, 0x80, 0x0F, 0x03, 0x00, 0x81, 0x80, 0x0F, 0x03, 0x00, 0x81, 0x80, 0x0F, 0x0F, 0x00, 0x99,
+    0xF0, 0xA8, 0x0E, 0xF0, 0x9E, 0x03, 0xF0, 0x0C, 0x00, 0xF0, 0x08, 0x00, 0xF0, 0x08, 0x00, 0xF0,
+    0x08, 0x00, 0xF0, 0x08, 0x00, 0xF0, 0x08, 0x00, 0xF0, 0x08, 0x0A, 0x00, 0x14, 0x00, 0xA3, 0x20,
+    0xEB, 0x8E, 0x00, 0xB0, 0x2C, 0xF5, 0x07, 0xE0, 0x08, 0x70, 0x08, 0xB0, 0x6E, 0x01, 0x00, 0x10,
+    0xE9, 0xAF, 0x01, 0x00, 0x10, 0xE6, 0x0B, 0xB2, 0x03, 0x80, 0x0E, 0xD0, 0x3C, 0xC3, 0x0B, 0x20,
+    0xEB, 0xAE, 0x02, 0x0C, 0x00, 0x0A, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x89, 0x8F, 0x00, 0xF0, 0xFF,
+    0x0F, 0x10, 0x8F, 0x01, 0x00, 0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00,
+    0x80, 0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x84, 0xBE, 0x02, 0x00, 0xE8, 0x0E, 0x09, 0x00,
+    0x17, 0x00, 0xA7, 0x8F, 0x00, 0x80, 0x0F, 0xF0, 0x08, 0x00, 0xF8, 0x00, 0x8F, 0x00, 0x80, 0x0F,
+    0xF0, 0x08, 0x00, 0xF8, 0x00, 0x8F, 0x00, 0x80, 0x0F, 0xF0, 0x08, 0x00, 0xF9, 0x00, 0xAE, 0x00,
+    0xD0, 0x0F, 0xA0, 0x5F, 0x92, 0xFD, 0x00, 0xA1, 0xEE, 0x89, 0x0F, 0x0E, 0x00, 0x16, 0x00, 0x9E,
+    0xC0, 0x0A, 0x00, 0x70, 0x0E, 0xF7, 0x01, 0x00, 0x9C, 0x20, 0x5F, 0x00, 0xF2, 0x03, 0xB0, 0x0A,
+    0x70, 0x0D, 0x00, 0xE6, 0x01, 0x8C, 0x00, 0x10, 0x5E, 0xF1, 0x02, 0x00, 0xA0, 0x6A, 0x0C, 0x02,
+    0x00, 0x81, 0xE5, 0x7B, 0x03, 0x00, 0x81, 0xFE, 0x01, 0x0F, 0x00, 0x20, 0x00, 0xAC, 0xD0, 0x0B,
+    0x00, 0xFB, 0x04, 0x20, 0x5F, 0xE8, 0x00, 0xE0, 0x8E, 0x00, 0xF6, 0x41, 0x4F, 0x30, 0x8E, 0x0B,
+    0xA0, 0x0B, 0xE0, 0x07, 0xB7, 0xF4, 0x01, 0x6E, 0x00, 0xBA, 0xA0, 0x07, 0x4F, 0xF3, 0x02, 0x50,
+    0x1F, 0x3E, 0xB0, 0x78, 0x0C, 0x00, 0xF1, 0xE7, 0x00, 0xB8, 0x8A, 0x02, 0x00, 0x8A, 0xEB, 0x0B,
+    0x40, 0xEF, 0x03, 0x00, 0x60, 0x7F, 0x00, 0xF0, 0x0E, 0x15, 0x00, 0x14, 0x00, 0x92, 0xA0, 0x1D,
+    0x00, 0xF6, 0x10, 0x8E, 0x10, 0x7E, 0x00, 0xF5, 0x93, 0x0C, 0x00, 0xA0, 0xED, 0x02, 0x00, 0x30,
+    0xAF, 0x02, 0x00, 0x8E, 0xB0, 0xFC, 0x04, 0x00, 0xE6, 0x91, 0x0D, 0x20, 0x6E, 0x10, 0x8E, 0xB0,
+    0x0C, 0x00, 0xF6, 0x0C, 0x00, 0x16, 0x00, 0x95, 0xB0, 0x0C, 0x00, 0x70, 0x1E, 0xF5, 0x02, 0x00,
+    0x9C, 0x10, 0x7E, 0x00, 0xF2, 0x04, 0x90, 0x0C, 0x70, 0x0D, 0x00, 0xF4, 0x02, 0x7C, 0x02, 0x00,
+    0x86, 0x7D, 0xF2, 0x02, 0x00, 0x80, 0x7C, 0x0B, 0x02, 0x00, 0x81, 0xF2, 0x6D, 0x03, 0x00, 0x81,
+    0xEB, 0x01, 0x02, 0x00, 0x81, 0xB0, 0x09, 0x02, 0x00, 0x81, 0x72, 0x2E, 0x02, 0x00, 0x81, 0xF0,
+    0x4D, 0x03, 0x00, 0x14, 0x00, 0x80, 0xF0, 0x02, 0xFF, 0x84, 0x0F, 0x10, 0x11, 0xD2, 0x0B, 0x02,
+    0x00, 0x84, 0xE8, 0x01, 0x00, 0x30, 0x5F, 0x02, 0x00, 0x81, 0xC0, 0x09, 0x02, 0x00, 0x84, 0xD7,
+    0x01, 0x00, 0x20, 0x3E, 0x02, 0x00, 0x84, 0xB0, 0x19, 0x11, 0x01, 0xF0, 0x02, 0xFF, 0x80, 0x0F,
+    0x0C, 0x00, 0x03, 0x00, 0xA4, 0x60, 0x8D, 0x00, 0xBE, 0x01, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0,
+    0x08, 0x10, 0x7F, 0x00, 0xDA, 0x02, 0xB0, 0x1B, 0x00, 0xF1, 0x07, 0x00, 0x8F, 0x00, 0xF0, 0x08,
+    0x00, 0x8F, 0x00, 0xF0, 0x09, 0x00, 0xF8, 0x08, 0x00, 0x11, 0x03, 0x00, 0xAA, 0x00, 0x48, 0x00,
+    0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0,
+    0x08, 0x00, 0x8F, 0x00, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0xF0, 0x08,
+    0x00, 0x8F, 0x00, 0xF0, 0x08, 0x00, 0x8F, 0x00, 0x03, 0x00, 0x84, 0xE0, 0x1B, 0x00, 0x40, 0x7F,
+    0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00, 0x80, 0x8F,
+    0x02, 0x00, 0x86, 0xE9, 0x04, 0x00, 0xD6, 0x05, 0x00, 0x8E, 0x02, 0x00, 0x80, 0x8F, 0x02, 0x00,
+    0x80, 0x8F, 0x02, 0x00, 0x88, 0x8F, 0x00, 0x20, 0x7F, 0x00, 0xF0, 0x2D, 0x00, 0x20, 0x05, 0x00,
+    0x24, 0x00, 0x88, 0x70, 0xBE, 0x37, 0xDA, 0x00, 0x9E, 0x50, 0xEB, 0x07, 0x20, 0x00,
+};
+// clang-format on
@@ -0,0 +1,30 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f mono16 -r`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_mono16_lz_length = 257;
+
+// clang-format off
+const uint8_t gfx_test_card_mono16_lz[257] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x01, 0x01, 0x00, 0x00, 0xFE, 0xFE, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x02, 0x00, 0x02, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0xD1, 0x00, 0x00,
+    0x00, 0xFF, 0x94, 0x00, 0x01, 0x0F, 0x00, 0x92, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0xFF, 0xDD, 0xDD,
+    0xBB, 0xBB, 0x99, 0x99, 0x66, 0x66, 0x44, 0x44, 0x22, 0x22, 0x99, 0x17, 0x81, 0x44, 0x90, 0x17,
+    0x03, 0xF0, 0x99, 0x99, 0xF9, 0x91, 0x17, 0x04, 0x9F, 0x99, 0x99, 0x99, 0x0F, 0x8F, 0x17, 0x80,
+    0x2E, 0x80, 0x30, 0xEF, 0x17, 0x95, 0x8F, 0x96, 0xBF, 0x84, 0xEF, 0x00, 0x00, 0x92, 0x00, 0x80,
+    0x17, 0x0E, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE,
+    0xFE, 0xAD, 0x17, 0x01, 0x40, 0x44, 0x81, 0x00, 0x8F, 0x5F, 0x9E, 0x17, 0x0B, 0x60, 0xCC, 0x5C,
+    0x00, 0xAF, 0x00, 0xA0, 0x0F, 0xE0, 0x00, 0xC2, 0x01, 0x89, 0x17, 0x0A, 0xC4, 0x01, 0xC1, 0x04,
+    0xCE, 0x00, 0xC0, 0x0E, 0xE0, 0x00, 0x3C, 0x8A, 0x2F, 0x0A, 0x3B, 0x00, 0x30, 0x0B, 0x9E, 0x03,
+    0x93, 0x0E, 0xE0, 0x90, 0x06, 0x8A, 0x17, 0x0A, 0x0D, 0x00, 0x00, 0x0D, 0x5E, 0x07, 0x57, 0x0E,
+    0xE0, 0x96, 0x00, 0x8C, 0x17, 0x08, 0x10, 0x0E, 0x1E, 0x0B, 0x1B, 0x0E, 0xE0, 0xAD, 0x00, 0x8E,
+    0x47, 0x05, 0x0E, 0x2B, 0x0B, 0x0E, 0xE0, 0xB1, 0x8B, 0x47, 0x0A, 0xC4, 0x01, 0xB1, 0x04, 0x0E,
+    0xA7, 0x07, 0x0E, 0xE0, 0x20, 0x2D, 0x8C, 0xA7, 0x04, 0xEE, 0x06, 0x0E, 0xF3, 0x03, 0x80, 0x8F,
+    0x00, 0xC5, 0x8C, 0xD7, 0x01, 0x10, 0x04, 0xA0, 0xEF, 0x83, 0x00, 0x96, 0x17, 0x00, 0xFF, 0x94,
+    0x00,
+};
+// clang-format on
@@ -0,0 +1,23 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f mono2 -r`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_mono2_lz_length = 156;
+
+// clang-format off
+const uint8_t gfx_test_card_mono2_lz[156] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x9C, 0x00, 0x00, 0x00, 0x63, 0xFF, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0x6C, 0x00, 0x00,
+    0x00, 0xFF, 0x82, 0x00, 0x01, 0x01, 0x00, 0x80, 0x00, 0x03, 0x80, 0xFD, 0xFF, 0x03, 0x84, 0x05,
+    0x01, 0xC0, 0x87, 0x81, 0x05, 0x01, 0xE0, 0x8F, 0x81, 0x05, 0x01, 0xF0, 0x9F, 0x81, 0x05, 0x01,
+    0xF8, 0xBF, 0x99, 0x05, 0x83, 0x23, 0x83, 0x2F, 0x01, 0xC0, 0x87, 0x83, 0x4D, 0x04, 0x01, 0x00,
+    0xFC, 0xFF, 0x03, 0x8C, 0x05, 0x83, 0x17, 0x81, 0x05, 0x0E, 0xC1, 0x31, 0x26, 0x02, 0x00, 0x80,
+    0x21, 0x32, 0x26, 0x01, 0x00, 0x80, 0x11, 0x34, 0xA6, 0x80, 0x11, 0x02, 0x11, 0x14, 0xA4, 0x81,
+    0x05, 0x01, 0x54, 0xE5, 0x82, 0x05, 0x00, 0xA5, 0x80, 0x05, 0x02, 0x21, 0x92, 0x24, 0x80, 0x1D,
+    0x04, 0xC1, 0x93, 0x24, 0x02, 0x00, 0x8A, 0x3B, 0x83, 0x05, 0x83, 0xB9,
+};
+// clang-format on
@@ -0,0 +1,28 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f mono2 -r -z`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_mono2_raw_length = 240;
+
+// clang-format off
+const uint8_t gfx_test_card_mono2_raw[240] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0xC0, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFD, 0xFF, 0x03, 0x00,
+    0x00, 0x80, 0xFD, 0xFF, 0x03, 0x00, 0xC0, 0x87, 0xFD, 0xFF, 0x03, 0x00, 0xE0, 0x8F, 0xFD, 0xFF,
+    0x03, 0x00, 0xF0, 0x9F, 0xFD, 0xFF, 0x03, 0x00, 0xF8, 0xBF, 0xFD, 0xFF, 0x03, 0x00, 0xF8, 0xBF,
+    0xFD, 0xFF, 0x03, 0x00, 0xF8, 0xBF, 0xFD, 0xFF, 0x03, 0x00, 0xF8, 0xBF, 0xFD, 0xFF, 0x03, 0x00,
+    0xF8, 0xBF, 0xFD, 0xFF, 0x03, 0x00, 0xF0, 0x9F, 0xFD, 0xFF, 0x03, 0x00, 0xE0, 0x8F, 0xFD, 0xFF,
+    0x03, 0x00, 0xC0, 0x87, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0xFC, 0xFF, 0x03, 0x80,
+    0x01, 0x00, 0xFC, 0xFF, 0x03, 0x80, 0x01, 0x00, 0xFC, 0xFF, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC1, 0x31, 0x26, 0x02, 0x00, 0x80, 0x21, 0x32,
+    0x26, 0x01, 0x00, 0x80, 0x11, 0x34, 0xA6, 0x00, 0x00, 0x80, 0x11, 0x14, 0xA4, 0x00, 0x00, 0x80,
+    0x11, 0x54, 0xE5, 0x00, 0x00, 0x80, 0x11, 0x54, 0xA5, 0x00, 0x00, 0x80, 0x21, 0x92, 0x24, 0x01,
+    0x00, 0x80, 0xC1, 0x93, 0x24, 0x02, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+// clang-format on
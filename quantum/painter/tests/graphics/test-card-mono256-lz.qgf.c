@@ -0,0 +1,37 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f mono256 -r`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_mono256_lz_length = 378;
+
+// clang-format off
+const uint8_t gfx_test_card_mono256_lz[378] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x7A, 0x01, 0x00, 0x00, 0x85, 0xFE, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x03, 0x00, 0x02, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0x4A, 0x01, 0x00,
+    0x00, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x80, 0x2F, 0x81, 0x34, 0x00, 0xE2, 0x80, 0x00,
+    0x00, 0xB3, 0x80, 0x00, 0x00, 0x96, 0x80, 0x00, 0x00, 0x69, 0x80, 0x00, 0x00, 0x4C, 0x80, 0x00,
+    0x00, 0x1D, 0x80, 0x00, 0xB5, 0x2F, 0x86, 0x89, 0xA3, 0x2F, 0x01, 0xFF, 0x97, 0x81, 0x00, 0x00,
+    0xFF, 0xA5, 0x2F, 0x83, 0x2E, 0x82, 0x30, 0xA1, 0x2F, 0x85, 0x2E, 0x81, 0x30, 0xFF, 0x2F, 0xDF,
+    0x2F, 0x86, 0x30, 0x01, 0xFF, 0x00, 0xA3, 0x2F, 0x84, 0x30, 0x01, 0xFF, 0x00, 0xA5, 0x2F, 0x82,
+    0x23, 0x00, 0xFF, 0x83, 0x08, 0x00, 0x00, 0xAA, 0x00, 0x81, 0x2F, 0x1E, 0x08, 0x10, 0x18, 0x20,
+    0x29, 0x31, 0x39, 0x41, 0x4A, 0x52, 0x5A, 0x62, 0x6A, 0x73, 0x7B, 0x83, 0x8B, 0x94, 0x9C, 0xA4,
+    0xAC, 0xB4, 0xBD, 0xC5, 0xCD, 0xD5, 0xDE, 0xE6, 0xEE, 0xF6, 0xFF, 0xDE, 0x2F, 0x00, 0x40, 0x87,
+    0x00, 0xA2, 0xBF, 0xBF, 0x2F, 0x08, 0x61, 0xCD, 0xC7, 0xCC, 0x5B, 0x00, 0x00, 0xF7, 0xAA, 0x80,
+    0x0B, 0x09, 0xA4, 0xF7, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1D, 0xCF, 0x18, 0x96, 0x2F, 0x0E, 0x47,
+    0xC4, 0x10, 0x00, 0x10, 0xC4, 0x3E, 0x00, 0xF0, 0xD1, 0x03, 0x00, 0x01, 0xC7, 0xF0, 0x81, 0x2F,
+    0x02, 0x08, 0xC4, 0x38, 0x97, 0x5F, 0x01, 0xBC, 0x39, 0x80, 0x04, 0x08, 0x3A, 0xB6, 0x00, 0xF0,
+    0x9F, 0x38, 0x00, 0x31, 0x99, 0x82, 0x2F, 0x01, 0xA0, 0x64, 0x98, 0x8F, 0x01, 0xE5, 0x08, 0x80,
+    0x04, 0x08, 0x08, 0xE1, 0x00, 0xF0, 0x58, 0x7F, 0x00, 0x78, 0x52, 0x81, 0x2F, 0x02, 0x6E, 0x98,
+    0x00, 0x9D, 0x2F, 0x08, 0x09, 0xED, 0x00, 0xF0, 0x12, 0xC3, 0x00, 0xBA, 0x0E, 0x80, 0x2F, 0x02,
+    0xF6, 0xD9, 0xB0, 0x99, 0x2F, 0x01, 0xBA, 0x3A, 0x80, 0x04, 0x01, 0x3B, 0xC3, 0x80, 0x86, 0x02,
+    0xC1, 0x1D, 0xBA, 0x81, 0xEC, 0x03, 0xF3, 0x0E, 0xBB, 0x68, 0x98, 0x2F, 0x06, 0x43, 0xC4, 0x0F,
+    0x00, 0x10, 0xC3, 0x4B, 0x80, 0x29, 0x03, 0x79, 0xA2, 0x76, 0x00, 0x82, 0xBF, 0x02, 0x1C, 0xE5,
+    0x29, 0x97, 0x2F, 0x06, 0x00, 0x5F, 0xCC, 0xC9, 0xF2, 0xF2, 0x6D, 0x80, 0x26, 0x02, 0x2E, 0xFE,
+    0x2C, 0x83, 0x2F, 0x03, 0x00, 0x59, 0xD0, 0x07, 0x97, 0x2F, 0x81, 0x00, 0x02, 0x14, 0x40, 0x00,
+    0x94, 0x00, 0x93, 0x2F, 0xA3, 0x00, 0xAF, 0x2F, 0xAC, 0x00,
+};
+// clang-format on
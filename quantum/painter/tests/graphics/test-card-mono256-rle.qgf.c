@@ -0,0 +1,63 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f mono256 -z`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_mono256_rle_length = 797;
+
+// clang-format off
+const uint8_t gfx_test_card_mono256_rle[797] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x1D, 0x03, 0x00, 0x00, 0xE2, 0xFC, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x03, 0x00, 0x01, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0xED, 0x02, 0x00,
+    0x31, 0xFF, 0x2E, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0x04, 0xE2, 0x04, 0xB3, 0x04, 0x96,
+    0x04, 0x69, 0x04, 0x4C, 0x04, 0x1D, 0x11, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0x04, 0xE2,
+    0x04, 0xB3, 0x04, 0x96, 0x04, 0x69, 0x04, 0x4C, 0x04, 0x1D, 0x08, 0x00, 0x05, 0xFF, 0x04, 0x00,
+    0x02, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0x04, 0xE2, 0x04, 0xB3, 0x04, 0x96, 0x04, 0x69, 0x04, 0x4C,
+    0x04, 0x1D, 0x07, 0x00, 0x80, 0xFF, 0x05, 0x97, 0x80, 0xFF, 0x03, 0x00, 0x02, 0xFF, 0x80, 0x00,
+    0x04, 0xFF, 0x04, 0xE2, 0x04, 0xB3, 0x04, 0x96, 0x04, 0x69, 0x04, 0x4C, 0x04, 0x1D, 0x06, 0x00,
+    0x80, 0xFF, 0x07, 0x97, 0x80, 0xFF, 0x02, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0x04, 0xE2,
+    0x04, 0xB3, 0x04, 0x96, 0x04, 0x69, 0x04, 0x4C, 0x04, 0x1D, 0x05, 0x00, 0x80, 0xFF, 0x09, 0x97,
+    0x81, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0x04, 0xE2, 0x04, 0xB3, 0x04, 0x96, 0x04,
+    0x69, 0x04, 0x4C, 0x04, 0x1D, 0x05, 0x00, 0x80, 0xFF, 0x09, 0x97, 0x81, 0xFF, 0x00, 0x02, 0xFF,
+    0x80, 0x00, 0x04, 0xFF, 0x04, 0xE2, 0x04, 0xB3, 0x04, 0x96, 0x04, 0x69, 0x04, 0x4C, 0x04, 0x1D,
+    0x05, 0x00, 0x80, 0xFF, 0x09, 0x97, 0x81, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0x04,
+    0xE2, 0x04, 0xB3, 0x04, 0x96, 0x04, 0x69, 0x04, 0x4C, 0x04, 0x1D, 0x05, 0x00, 0x80, 0xFF, 0x09,
+    0x97, 0x81, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0x04, 0xE2, 0x04, 0xB3, 0x04, 0x96,
+    0x04, 0x69, 0x04, 0x4C, 0x04, 0x1D, 0x05, 0x00, 0x80, 0xFF, 0x09, 0x97, 0x81, 0xFF, 0x00, 0x02,
+    0xFF, 0x80, 0x00, 0x04, 0xFF, 0x04, 0xE2, 0x04, 0xB3, 0x04, 0x96, 0x04, 0x69, 0x04, 0x4C, 0x04,
+    0x1D, 0x06, 0x00, 0x80, 0xFF, 0x07, 0x97, 0x80, 0xFF, 0x02, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x04,
+    0xFF, 0x04, 0xE2, 0x04, 0xB3, 0x04, 0x96, 0x04, 0x69, 0x04, 0x4C, 0x04, 0x1D, 0x07, 0x00, 0x80,
+    0xFF, 0x05, 0x97, 0x80, 0xFF, 0x03, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0x04, 0xE2, 0x04,
+    0xB3, 0x04, 0x96, 0x04, 0x69, 0x04, 0x4C, 0x04, 0x1D, 0x08, 0x00, 0x05, 0xFF, 0x04, 0x00, 0x02,
+    0xFF, 0x2E, 0x00, 0x02, 0xFF, 0x02, 0x00, 0x9E, 0x08, 0x10, 0x18, 0x20, 0x29, 0x31, 0x39, 0x41,
+    0x4A, 0x52, 0x5A, 0x62, 0x6A, 0x73, 0x7B, 0x83, 0x8B, 0x94, 0x9C, 0xA4, 0xAC, 0xB4, 0xBD, 0xC5,
+    0xCD, 0xD5, 0xDE, 0xE6, 0xEE, 0xF6, 0xFF, 0x0D, 0x00, 0x02, 0xFF, 0x02, 0x00, 0x9E, 0x08, 0x10,
+    0x18, 0x20, 0x29, 0x31, 0x39, 0x41, 0x4A, 0x52, 0x5A, 0x62, 0x6A, 0x73, 0x7B, 0x83, 0x8B, 0x94,
+    0x9C, 0xA4, 0xAC, 0xB4, 0xBD, 0xC5, 0xCD, 0xD5, 0xDE, 0xE6, 0xEE, 0xF6, 0xFF, 0x0D, 0x00, 0x02,
+    0xFF, 0x02, 0x00, 0x9F, 0x08, 0x10, 0x18, 0x20, 0x29, 0x31, 0x39, 0x41, 0x4A, 0x52, 0x5A, 0x62,
+    0x6A, 0x73, 0x7B, 0x83, 0x8B, 0x94, 0x9C, 0xA4, 0xAC, 0xB4, 0xBD, 0xC5, 0xCD, 0xD5, 0xDE, 0xE6,
+    0xEE, 0xF6, 0xFF, 0x00, 0x0B, 0x40, 0x80, 0x00, 0x02, 0xFF, 0x22, 0x00, 0x0B, 0x40, 0x80, 0x00,
+    0x02, 0xFF, 0x22, 0x00, 0x0B, 0x40, 0x80, 0x00, 0x02, 0xFF, 0x04, 0x00, 0x84, 0x61, 0xCD, 0xC7,
+    0xCC, 0x5B, 0x02, 0x00, 0x81, 0xF7, 0xAA, 0x03, 0x00, 0x81, 0xA4, 0xF7, 0x02, 0x00, 0x80, 0xF0,
+    0x02, 0x00, 0x82, 0x1D, 0xCF, 0x18, 0x08, 0x00, 0x0B, 0x40, 0x80, 0x00, 0x02, 0xFF, 0x03, 0x00,
+    0x8E, 0x47, 0xC4, 0x10, 0x00, 0x10, 0xC4, 0x3E, 0x00, 0xF0, 0xD1, 0x03, 0x00, 0x01, 0xC7, 0xF0,
+    0x02, 0x00, 0x84, 0xF0, 0x00, 0x08, 0xC4, 0x38, 0x09, 0x00, 0x0B, 0x40, 0x80, 0x00, 0x02, 0xFF,
+    0x03, 0x00, 0x81, 0xBC, 0x39, 0x03, 0x00, 0x89, 0x3A, 0xB6, 0x00, 0xF0, 0x9F, 0x38, 0x00, 0x31,
+    0x99, 0xF0, 0x02, 0x00, 0x83, 0xF0, 0x00, 0xA0, 0x64, 0x0A, 0x00, 0x0B, 0x40, 0x80, 0x00, 0x02,
+    0xFF, 0x03, 0x00, 0x81, 0xE5, 0x08, 0x03, 0x00, 0x89, 0x08, 0xE1, 0x00, 0xF0, 0x58, 0x7F, 0x00,
+    0x78, 0x52, 0xF0, 0x02, 0x00, 0x82, 0xF0, 0x6E, 0x98, 0x0B, 0x00, 0x0B, 0x40, 0x80, 0x00, 0x02,
+    0xFF, 0x03, 0x00, 0x81, 0xE5, 0x08, 0x03, 0x00, 0x89, 0x09, 0xED, 0x00, 0xF0, 0x12, 0xC3, 0x00,
+    0xBA, 0x0E, 0xF0, 0x02, 0x00, 0x82, 0xF6, 0xD9, 0xB0, 0x0B, 0x00, 0x0B, 0x40, 0x80, 0x00, 0x02,
+    0xFF, 0x03, 0x00, 0x81, 0xBA, 0x3A, 0x03, 0x00, 0x89, 0x3B, 0xC3, 0x00, 0xF0, 0x00, 0xC1, 0x1D,
+    0xBA, 0x00, 0xF0, 0x02, 0x00, 0x83, 0xF3, 0x0E, 0xBB, 0x68, 0x0A, 0x00, 0x0B, 0x40, 0x80, 0x00,
+    0x02, 0xFF, 0x03, 0x00, 0x8E, 0x43, 0xC4, 0x0F, 0x00, 0x10, 0xC3, 0x4B, 0x00, 0xF0, 0x00, 0x79,
+    0xA2, 0x76, 0x00, 0xF0, 0x02, 0x00, 0x84, 0xF0, 0x00, 0x1C, 0xE5, 0x29, 0x09, 0x00, 0x0B, 0x40,
+    0x80, 0x00, 0x02, 0xFF, 0x04, 0x00, 0x82, 0x5F, 0xCC, 0xC9, 0x02, 0xF2, 0x88, 0x6D, 0x00, 0xF0,
+    0x00, 0x2E, 0xFE, 0x2C, 0x00, 0xF0, 0x02, 0x00, 0x80, 0xF0, 0x02, 0x00, 0x82, 0x59, 0xD0, 0x07,
+    0x08, 0x00, 0x0B, 0x40, 0x80, 0x00, 0x02, 0xFF, 0x08, 0x00, 0x81, 0x14, 0x40, 0x18, 0x00, 0x0B,
+    0x40, 0x80, 0x00, 0x02, 0xFF, 0x2E, 0x00, 0x02, 0xFF, 0x2E, 0x00, 0x31, 0xFF,
+};
+// clang-format on
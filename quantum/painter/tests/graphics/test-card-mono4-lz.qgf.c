@@ -0,0 +1,26 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f mono4 -r`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_mono4_lz_length = 199;
+
+// clang-format off
+const uint8_t gfx_test_card_mono4_lz[199] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0xC7, 0x00, 0x00, 0x00, 0x38, 0xFF, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x01, 0x00, 0x02, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0x97, 0x00, 0x00,
+    0x00, 0xFF, 0x88, 0x00, 0x01, 0x03, 0x00, 0x86, 0x00, 0x07, 0xC0, 0xF3, 0xFF, 0xAF, 0xAA, 0x5A,
+    0x55, 0x05, 0x8B, 0x0B, 0x01, 0xF0, 0x3F, 0x87, 0x0B, 0x01, 0xAC, 0xEA, 0x87, 0x0B, 0x02, 0xAB,
+    0xAA, 0xC3, 0x85, 0x0B, 0x03, 0xC0, 0xAA, 0xAA, 0xCE, 0xB5, 0x0B, 0x89, 0x47, 0x8A, 0x5F, 0x80,
+    0x77, 0x89, 0x9B, 0x08, 0x03, 0x00, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xFF, 0x0F, 0x94, 0x0B, 0x03,
+    0x4F, 0x55, 0x55, 0xC5, 0x85, 0x2F, 0x00, 0x40, 0x8D, 0x0B, 0x05, 0xA4, 0x06, 0x0B, 0x38, 0x0C,
+    0x08, 0x83, 0x0B, 0x01, 0x09, 0x18, 0x80, 0x0B, 0x00, 0x06, 0x83, 0x0B, 0x05, 0x06, 0x24, 0x1B,
+    0x39, 0x8C, 0x01, 0x83, 0x0B, 0x05, 0x03, 0x30, 0x17, 0x35, 0x9C, 0x00, 0x85, 0x0B, 0x03, 0x23,
+    0x32, 0xBC, 0x00, 0x85, 0x23, 0x01, 0x23, 0x32, 0x85, 0x23, 0x05, 0x09, 0x18, 0x93, 0x31, 0x0C,
+    0x03, 0x84, 0x53, 0x04, 0x1F, 0xD3, 0x31, 0x0C, 0x09, 0x84, 0x6B, 0x00, 0x10, 0x8E, 0x77, 0x83,
+    0xB3, 0x87, 0x0B, 0x00, 0xFF, 0x88, 0x00,
+};
+// clang-format on
@@ -0,0 +1,40 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f mono4 -r -z`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_mono4_raw_length = 432;
+
+// clang-format off
+const uint8_t gfx_test_card_mono4_raw[432] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0xB0, 0x01, 0x00, 0x00, 0x4F, 0xFE, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0x80, 0x01, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF3, 0xFF, 0xAF, 0xAA, 0x5A, 0x55, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xF3, 0xFF, 0xAF, 0xAA, 0x5A, 0x55, 0x05, 0x00, 0x00, 0xF0, 0x3F, 0xC0,
+    0xF3, 0xFF, 0xAF, 0xAA, 0x5A, 0x55, 0x05, 0x00, 0x00, 0xAC, 0xEA, 0xC0, 0xF3, 0xFF, 0xAF, 0xAA,
+    0x5A, 0x55, 0x05, 0x00, 0x00, 0xAB, 0xAA, 0xC3, 0xF3, 0xFF, 0xAF, 0xAA, 0x5A, 0x55, 0x05, 0x00,
+    0xC0, 0xAA, 0xAA, 0xCE, 0xF3, 0xFF, 0xAF, 0xAA, 0x5A, 0x55, 0x05, 0x00, 0xC0, 0xAA, 0xAA, 0xCE,
+    0xF3, 0xFF, 0xAF, 0xAA, 0x5A, 0x55, 0x05, 0x00, 0xC0, 0xAA, 0xAA, 0xCE, 0xF3, 0xFF, 0xAF, 0xAA,
+    0x5A, 0x55, 0x05, 0x00, 0xC0, 0xAA, 0xAA, 0xCE, 0xF3, 0xFF, 0xAF, 0xAA, 0x5A, 0x55, 0x05, 0x00,
+    0xC0, 0xAA, 0xAA, 0xCE, 0xF3, 0xFF, 0xAF, 0xAA, 0x5A, 0x55, 0x05, 0x00, 0x00, 0xAB, 0xAA, 0xC3,
+    0xF3, 0xFF, 0xAF, 0xAA, 0x5A, 0x55, 0x05, 0x00, 0x00, 0xAC, 0xEA, 0xC0, 0xF3, 0xFF, 0xAF, 0xAA,
+    0x5A, 0x55, 0x05, 0x00, 0x00, 0xF0, 0x3F, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xFF, 0x0F, 0x00, 0x00, 0xC0,
+    0x03, 0x00, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xFF, 0x0F, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x55, 0x55,
+    0xA5, 0xAA, 0xAA, 0xFF, 0x4F, 0x55, 0x55, 0xC5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x55, 0x55, 0xC5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0xC5,
+    0x03, 0xA4, 0x06, 0x0B, 0x38, 0x0C, 0x08, 0x00, 0x40, 0x55, 0x55, 0xC5, 0x03, 0x09, 0x18, 0x0B,
+    0x38, 0x0C, 0x06, 0x00, 0x40, 0x55, 0x55, 0xC5, 0x03, 0x06, 0x24, 0x1B, 0x39, 0x8C, 0x01, 0x00,
+    0x40, 0x55, 0x55, 0xC5, 0x03, 0x03, 0x30, 0x17, 0x35, 0x9C, 0x00, 0x00, 0x40, 0x55, 0x55, 0xC5,
+    0x03, 0x03, 0x30, 0x23, 0x32, 0xBC, 0x00, 0x00, 0x40, 0x55, 0x55, 0xC5, 0x03, 0x06, 0x24, 0x23,
+    0x32, 0x8C, 0x01, 0x00, 0x40, 0x55, 0x55, 0xC5, 0x03, 0x09, 0x18, 0x93, 0x31, 0x0C, 0x03, 0x00,
+    0x40, 0x55, 0x55, 0xC5, 0x03, 0xA4, 0x1F, 0xD3, 0x31, 0x0C, 0x09, 0x00, 0x40, 0x55, 0x55, 0xC5,
+    0x03, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0xC5, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+// clang-format on
@@ -0,0 +1,33 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f pal16 -r`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_pal16_lz_length = 308;
+
+// clang-format off
+const uint8_t gfx_test_card_pal16_lz[308] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x34, 0x01, 0x00, 0x00, 0xCB, 0xFE, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x00, 0x02, 0xFF, 0xE8, 0x03, 0x03, 0xFC, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x2A, 0xFF, 0xFF, 0x00, 0x00, 0xF7, 0x7F, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0x00,
+    0x00, 0xE5, 0x00, 0x00, 0xB0, 0x15, 0xDD, 0xDA, 0x00, 0x00, 0x50, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x26, 0xD4, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x09, 0xAA, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x05, 0xFA, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00, 0x01, 0xF0, 0xFF, 0x92, 0x00, 0x0F, 0x0F,
+    0xF0, 0x00, 0x00, 0x11, 0x11, 0x33, 0x33, 0x44, 0x44, 0xBB, 0xBB, 0xCC, 0xCC, 0xEE, 0xEE, 0x99,
+    0x17, 0x81, 0x44, 0x90, 0x17, 0x03, 0x0F, 0x77, 0x77, 0x07, 0x91, 0x17, 0x04, 0x70, 0x77, 0x77,
+    0x77, 0xF0, 0x8F, 0x17, 0x80, 0x2E, 0x80, 0x30, 0xEF, 0x17, 0x95, 0x8F, 0x96, 0xBF, 0x84, 0xEF,
+    0x00, 0xFF, 0x92, 0x00, 0x0A, 0x0F, 0xF0, 0xDF, 0xAD, 0xAA, 0x9A, 0x89, 0x88, 0x88, 0x88, 0x66,
+    0x80, 0x00, 0x03, 0x56, 0x55, 0x55, 0x02, 0xAD, 0x17, 0x01, 0x9F, 0x99, 0x81, 0x00, 0x8F, 0x5F,
+    0x9E, 0x17, 0x0B, 0x8F, 0x65, 0x85, 0xFF, 0x62, 0xFF, 0x6F, 0xF2, 0x2F, 0xFF, 0x5A, 0xFA, 0x89,
+    0x17, 0x04, 0x69, 0xFD, 0x6D, 0xF9, 0x52, 0x81, 0x17, 0x01, 0xDF, 0x96, 0x8A, 0x2F, 0x0A, 0x96,
+    0xFF, 0x9F, 0xF6, 0x62, 0xF9, 0x6A, 0xF2, 0x2F, 0x6F, 0xF8, 0x8A, 0x17, 0x0A, 0xD5, 0xFF, 0xDF,
+    0xF5, 0x82, 0xF8, 0x88, 0xF2, 0x2F, 0x68, 0xFF, 0x8E, 0x17, 0x06, 0xD2, 0xF6, 0xD6, 0xF2, 0x2F,
+    0x65, 0xFF, 0x8E, 0x47, 0x05, 0xF2, 0xA6, 0xF6, 0xF2, 0x2F, 0x6D, 0x8B, 0x47, 0x80, 0x77, 0x07,
+    0xF8, 0xF2, 0x68, 0xF8, 0xF2, 0x2F, 0xAF, 0xA5, 0x8C, 0xA7, 0x04, 0x22, 0xF8, 0xF2, 0x0A, 0xFA,
+    0x80, 0xA7, 0x01, 0x58, 0xFD, 0x8B, 0xD7, 0x01, 0xDF, 0xF9, 0xA0, 0xEF, 0x83, 0x00, 0x96, 0x17,
+    0x00, 0x00, 0x94, 0x00,
+};
+// clang-format on
@@ -0,0 +1,55 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f pal16 -z`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_pal16_rle_length = 670;
+
+// clang-format off
+const uint8_t gfx_test_card_pal16_rle[670] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x9E, 0x02, 0x00, 0x00, 0x61, 0xFD, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x00, 0x01, 0xFF, 0xE8, 0x03, 0x03, 0xFC, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x2A, 0xFF, 0xFF, 0x00, 0x00, 0xF7, 0x7F, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0x00,
+    0x00, 0xE5, 0x00, 0x00, 0xB0, 0x15, 0xDD, 0xDA, 0x00, 0x00, 0x50, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x26, 0xD4, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x09, 0xAA, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x05, 0xFA, 0x39, 0x02, 0x00, 0x18, 0x00, 0x80, 0xF0, 0x16, 0xFF, 0x81, 0x0F, 0xF0, 0x02, 0x00,
+    0x02, 0x11, 0x02, 0x33, 0x02, 0x44, 0x02, 0xBB, 0x02, 0xCC, 0x02, 0xEE, 0x08, 0xFF, 0x81, 0x0F,
+    0xF0, 0x02, 0x00, 0x02, 0x11, 0x02, 0x33, 0x02, 0x44, 0x02, 0xBB, 0x02, 0xCC, 0x02, 0xEE, 0x04,
+    0xFF, 0x02, 0x00, 0x83, 0xF0, 0xFF, 0x0F, 0xF0, 0x02, 0x00, 0x02, 0x11, 0x02, 0x33, 0x02, 0x44,
+    0x02, 0xBB, 0x02, 0xCC, 0x02, 0xEE, 0x03, 0xFF, 0x80, 0x0F, 0x02, 0x77, 0x83, 0x07, 0xFF, 0x0F,
+    0xF0, 0x02, 0x00, 0x02, 0x11, 0x02, 0x33, 0x02, 0x44, 0x02, 0xBB, 0x02, 0xCC, 0x02, 0xEE, 0x03,
+    0xFF, 0x80, 0x70, 0x03, 0x77, 0x82, 0xF0, 0x0F, 0xF0, 0x02, 0x00, 0x02, 0x11, 0x02, 0x33, 0x02,
+    0x44, 0x02, 0xBB, 0x02, 0xCC, 0x02, 0xEE, 0x02, 0xFF, 0x80, 0x0F, 0x04, 0x77, 0x82, 0x07, 0x0F,
+    0xF0, 0x02, 0x00, 0x02, 0x11, 0x02, 0x33, 0x02, 0x44, 0x02, 0xBB, 0x02, 0xCC, 0x02, 0xEE, 0x02,
+    0xFF, 0x80, 0x0F, 0x04, 0x77, 0x82, 0x07, 0x0F, 0xF0, 0x02, 0x00, 0x02, 0x11, 0x02, 0x33, 0x02,
+    0x44, 0x02, 0xBB, 0x02, 0xCC, 0x02, 0xEE, 0x02, 0xFF, 0x80, 0x0F, 0x04, 0x77, 0x82, 0x07, 0x0F,
+    0xF0, 0x02, 0x00, 0x02, 0x11, 0x02, 0x33, 0x02, 0x44, 0x02, 0xBB, 0x02, 0xCC, 0x02, 0xEE, 0x02,
+    0xFF, 0x80, 0x0F, 0x04, 0x77, 0x82, 0x07, 0x0F, 0xF0, 0x02, 0x00, 0x02, 0x11, 0x02, 0x33, 0x02,
+    0x44, 0x02, 0xBB, 0x02, 0xCC, 0x02, 0xEE, 0x02, 0xFF, 0x80, 0x0F, 0x04, 0x77, 0x82, 0x07, 0x0F,
+    0xF0, 0x02, 0x00, 0x02, 0x11, 0x02, 0x33, 0x02, 0x44, 0x02, 0xBB, 0x02, 0xCC, 0x02, 0xEE, 0x03,
+    0xFF, 0x80, 0x70, 0x03, 0x77, 0x82, 0xF0, 0x0F, 0xF0, 0x02, 0x00, 0x02, 0x11, 0x02, 0x33, 0x02,
+    0x44, 0x02, 0xBB, 0x02, 0xCC, 0x02, 0xEE, 0x03, 0xFF, 0x80, 0x0F, 0x02, 0x77, 0x83, 0x07, 0xFF,
+    0x0F, 0xF0, 0x02, 0x00, 0x02, 0x11, 0x02, 0x33, 0x02, 0x44, 0x02, 0xBB, 0x02, 0xCC, 0x02, 0xEE,
+    0x04, 0xFF, 0x02, 0x00, 0x83, 0xF0, 0xFF, 0x0F, 0xF0, 0x16, 0xFF, 0x86, 0x0F, 0xF0, 0xDF, 0xAD,
+    0xAA, 0x9A, 0x89, 0x03, 0x88, 0x04, 0x66, 0x80, 0x56, 0x02, 0x55, 0x80, 0x02, 0x06, 0xFF, 0x86,
+    0x0F, 0xF0, 0xDF, 0xAD, 0xAA, 0x9A, 0x89, 0x03, 0x88, 0x04, 0x66, 0x80, 0x56, 0x02, 0x55, 0x80,
+    0x02, 0x06, 0xFF, 0x86, 0x0F, 0xF0, 0xDF, 0xAD, 0xAA, 0x9A, 0x89, 0x03, 0x88, 0x04, 0x66, 0x80,
+    0x56, 0x02, 0x55, 0x81, 0x02, 0x9F, 0x05, 0x99, 0x81, 0x0F, 0xF0, 0x10, 0xFF, 0x80, 0x9F, 0x05,
+    0x99, 0x81, 0x0F, 0xF0, 0x10, 0xFF, 0x80, 0x9F, 0x05, 0x99, 0x8E, 0x0F, 0xF0, 0xFF, 0x8F, 0x65,
+    0x85, 0xFF, 0x62, 0xFF, 0x6F, 0xF2, 0x2F, 0xFF, 0x5A, 0xFA, 0x03, 0xFF, 0x80, 0x9F, 0x05, 0x99,
+    0x8D, 0x0F, 0xF0, 0xFF, 0x69, 0xFD, 0x6D, 0xF9, 0x52, 0xFF, 0x6F, 0xF2, 0x2F, 0xDF, 0x96, 0x04,
+    0xFF, 0x80, 0x9F, 0x05, 0x99, 0x8D, 0x0F, 0xF0, 0xFF, 0x96, 0xFF, 0x9F, 0xF6, 0x62, 0xF9, 0x6A,
+    0xF2, 0x2F, 0x6F, 0xF8, 0x04, 0xFF, 0x80, 0x9F, 0x05, 0x99, 0x8C, 0x0F, 0xF0, 0xFF, 0xD5, 0xFF,
+    0xDF, 0xF5, 0x82, 0xF8, 0x88, 0xF2, 0x2F, 0x68, 0x05, 0xFF, 0x80, 0x9F, 0x05, 0x99, 0x8C, 0x0F,
+    0xF0, 0xFF, 0xD5, 0xFF, 0xDF, 0xF5, 0xD2, 0xF6, 0xD6, 0xF2, 0x2F, 0x65, 0x05, 0xFF, 0x80, 0x9F,
+    0x05, 0x99, 0x8D, 0x0F, 0xF0, 0xFF, 0x96, 0xFF, 0x9F, 0xF6, 0xF2, 0xA6, 0xF6, 0xF2, 0x2F, 0x6D,
+    0xF8, 0x04, 0xFF, 0x80, 0x9F, 0x05, 0x99, 0x8D, 0x0F, 0xF0, 0xFF, 0x69, 0xFD, 0x6D, 0xF8, 0xF2,
+    0x68, 0xF8, 0xF2, 0x2F, 0xAF, 0xA5, 0x04, 0xFF, 0x80, 0x9F, 0x05, 0x99, 0x8E, 0x0F, 0xF0, 0xFF,
+    0x8F, 0x65, 0x22, 0xF8, 0xF2, 0x0A, 0xFA, 0xF2, 0x2F, 0xFF, 0x58, 0xFD, 0x03, 0xFF, 0x80, 0x9F,
+    0x05, 0x99, 0x81, 0x0F, 0xF0, 0x03, 0xFF, 0x81, 0xDF, 0xF9, 0x0B, 0xFF, 0x80, 0x9F, 0x05, 0x99,
+    0x81, 0x0F, 0xF0, 0x16, 0xFF, 0x81, 0x0F, 0xF0, 0x16, 0xFF, 0x80, 0x0F, 0x18, 0x00,
+};
+// clang-format on
@@ -0,0 +1,29 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f pal2 -z`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_pal2_rle_length = 243;
+
+// clang-format off
+const uint8_t gfx_test_card_pal2_rle[243] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0xF3, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x04, 0x00, 0x01, 0xFF, 0xE8, 0x03, 0x03, 0xFC, 0x06, 0x00, 0x00,
+    0x3E, 0x3B, 0xB8, 0xD4, 0xFF, 0x20, 0x05, 0xFA, 0xB8, 0x00, 0x00, 0x06, 0x00, 0x80, 0xFE, 0x04,
+    0xFF, 0x83, 0x7F, 0x02, 0x00, 0xC0, 0x02, 0xFF, 0xC3, 0x7F, 0x02, 0x00, 0xC0, 0xFF, 0x3F, 0x78,
+    0x02, 0x00, 0xC0, 0xFF, 0x1F, 0x70, 0x02, 0x00, 0xC0, 0xFF, 0x0F, 0x60, 0x02, 0x00, 0xC0, 0xFF,
+    0x07, 0x40, 0x02, 0x00, 0xC0, 0xFF, 0x07, 0x40, 0x02, 0x00, 0xC0, 0xFF, 0x07, 0x40, 0x02, 0x00,
+    0xC0, 0xFF, 0x07, 0x40, 0x02, 0x00, 0xC0, 0xFF, 0x07, 0x40, 0x02, 0x00, 0xC0, 0xFF, 0x0F, 0x60,
+    0x02, 0x00, 0xC0, 0xFF, 0x1F, 0x70, 0x02, 0x00, 0xC0, 0xFF, 0x3F, 0x78, 0xFE, 0x04, 0xFF, 0x82,
+    0x7F, 0xFE, 0x3F, 0x02, 0x00, 0x83, 0xFC, 0x7F, 0xFE, 0x3F, 0x02, 0x00, 0x83, 0xFC, 0x7F, 0xFE,
+    0x3F, 0x02, 0x00, 0x82, 0xFC, 0x7F, 0xFE, 0x04, 0xFF, 0x81, 0x7F, 0xFE, 0x04, 0xFF, 0x95, 0x7F,
+    0x1E, 0xCE, 0xD9, 0xFD, 0xFF, 0x7F, 0xDE, 0xCD, 0xD9, 0xFE, 0xFF, 0x7F, 0xEE, 0xCB, 0x59, 0xFE,
+    0xFF, 0x7F, 0xEE, 0xAB, 0x1A, 0x02, 0xFF, 0x83, 0x7F, 0xEE, 0xAB, 0x1A, 0x02, 0xFF, 0x93, 0x7F,
+    0xEE, 0xAB, 0x5A, 0xFE, 0xFF, 0x7F, 0xDE, 0x2D, 0xDA, 0xFE, 0xFF, 0x7F, 0x1E, 0x68, 0xDB, 0xFD,
+    0xFF, 0x7F, 0xFE, 0x04, 0xFF, 0x81, 0x7F, 0xFE, 0x04, 0xFF, 0x81, 0x7F, 0xFE, 0x04, 0xFF, 0x80,
+    0x7F, 0x06, 0x00,
+};
+// clang-format on
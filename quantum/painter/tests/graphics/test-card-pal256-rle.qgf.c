@@ -0,0 +1,112 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f pal256 -z`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_pal256_rle_length = 1570;
+
+// clang-format off
+const uint8_t gfx_test_card_pal256_rle[1570] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x22, 0x06, 0x00, 0x00, 0xDD, 0xF9, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x07, 0x00, 0x01, 0xFF, 0xE8, 0x03, 0x03, 0xFC, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0xFF, 0x2A, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xF7, 0x00, 0x00, 0xF6, 0x7F,
+    0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0xF3, 0x00, 0x00, 0xF2, 0x00, 0x00, 0xF0, 0x00, 0x00,
+    0xEE, 0x00, 0x00, 0xED, 0x00, 0x00, 0xE6, 0x00, 0x00, 0xE5, 0x00, 0x00, 0xE1, 0x00, 0x00, 0xDE,
+    0x00, 0x00, 0xD9, 0x00, 0x00, 0xD5, 0x00, 0x00, 0xD1, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xCF, 0x00,
+    0x00, 0xCD, 0x00, 0x00, 0xCC, 0x00, 0x00, 0xC9, 0x00, 0x00, 0xC7, 0x00, 0x00, 0xC5, 0x00, 0x00,
+    0xC4, 0x00, 0x00, 0xC3, 0x00, 0x00, 0xC1, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBB,
+    0x00, 0x00, 0xBA, 0x00, 0x00, 0xB6, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xAC, 0x00,
+    0x00, 0xAA, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xA2, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x9C, 0x00, 0x00, 0x99, 0x00, 0x00, 0x98, 0x00, 0x00, 0x94, 0x00, 0x00, 0x8B, 0x15, 0xFF, 0xFF,
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x79, 0x00, 0x00, 0x78, 0x00,
+    0x00, 0x76, 0x00, 0x00, 0x73, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x6A, 0x00, 0x00,
+    0x68, 0x00, 0x00, 0x64, 0x00, 0x00, 0x62, 0x00, 0x00, 0x61, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x5B,
+    0x00, 0x00, 0x5A, 0x00, 0x00, 0x59, 0x00, 0x00, 0x58, 0x00, 0x00, 0x52, 0x00, 0x00, 0x4B, 0x00,
+    0x00, 0x4A, 0x00, 0x00, 0x47, 0x00, 0x00, 0x43, 0x00, 0x00, 0x41, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x3E, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x39, 0x00, 0x00, 0x38, 0x00, 0x00, 0x31,
+    0x00, 0x00, 0x2E, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x29, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1D, 0x00,
+    0x00, 0x1C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x14, 0x00, 0x00, 0x12, 0x00, 0x00, 0x10, 0xD4, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x09, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0xAA, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xFA, 0xED, 0x02, 0x00, 0x31, 0x00, 0x2E, 0x64, 0x02, 0x00, 0x80, 0x64, 0x04, 0x00, 0x04,
+    0x01, 0x04, 0x05, 0x04, 0x06, 0x04, 0x5A, 0x04, 0x5B, 0x04, 0x63, 0x11, 0x64, 0x02, 0x00, 0x80,
+    0x64, 0x04, 0x00, 0x04, 0x01, 0x04, 0x05, 0x04, 0x06, 0x04, 0x5A, 0x04, 0x5B, 0x04, 0x63, 0x08,
+    0x64, 0x05, 0x00, 0x04, 0x64, 0x02, 0x00, 0x80, 0x64, 0x04, 0x00, 0x04, 0x01, 0x04, 0x05, 0x04,
+    0x06, 0x04, 0x5A, 0x04, 0x5B, 0x04, 0x63, 0x07, 0x64, 0x80, 0x00, 0x05, 0x2F, 0x80, 0x00, 0x03,
+    0x64, 0x02, 0x00, 0x80, 0x64, 0x04, 0x00, 0x04, 0x01, 0x04, 0x05, 0x04, 0x06, 0x04, 0x5A, 0x04,
+    0x5B, 0x04, 0x63, 0x06, 0x64, 0x80, 0x00, 0x07, 0x2F, 0x80, 0x00, 0x02, 0x64, 0x02, 0x00, 0x80,
+    0x64, 0x04, 0x00, 0x04, 0x01, 0x04, 0x05, 0x04, 0x06, 0x04, 0x5A, 0x04, 0x5B, 0x04, 0x63, 0x05,
+    0x64, 0x80, 0x00, 0x09, 0x2F, 0x81, 0x00, 0x64, 0x02, 0x00, 0x80, 0x64, 0x04, 0x00, 0x04, 0x01,
+    0x04, 0x05, 0x04, 0x06, 0x04, 0x5A, 0x04, 0x5B, 0x04, 0x63, 0x05, 0x64, 0x80, 0x00, 0x09, 0x2F,
+    0x81, 0x00, 0x64, 0x02, 0x00, 0x80, 0x64, 0x04, 0x00, 0x04, 0x01, 0x04, 0x05, 0x04, 0x06, 0x04,
+    0x5A, 0x04, 0x5B, 0x04, 0x63, 0x05, 0x64, 0x80, 0x00, 0x09, 0x2F, 0x81, 0x00, 0x64, 0x02, 0x00,
+    0x80, 0x64, 0x04, 0x00, 0x04, 0x01, 0x04, 0x05, 0x04, 0x06, 0x04, 0x5A, 0x04, 0x5B, 0x04, 0x63,
+    0x05, 0x64, 0x80, 0x00, 0x09, 0x2F, 0x81, 0x00, 0x64, 0x02, 0x00, 0x80, 0x64, 0x04, 0x00, 0x04,
+    0x01, 0x04, 0x05, 0x04, 0x06, 0x04, 0x5A, 0x04, 0x5B, 0x04, 0x63, 0x05, 0x64, 0x80, 0x00, 0x09,
+    0x2F, 0x81, 0x00, 0x64, 0x02, 0x00, 0x80, 0x64, 0x04, 0x00, 0x04, 0x01, 0x04, 0x05, 0x04, 0x06,
+    0x04, 0x5A, 0x04, 0x5B, 0x04, 0x63, 0x06, 0x64, 0x80, 0x00, 0x07, 0x2F, 0x80, 0x00, 0x02, 0x64,
+    0x02, 0x00, 0x80, 0x64, 0x04, 0x00, 0x04, 0x01, 0x04, 0x05, 0x04, 0x06, 0x04, 0x5A, 0x04, 0x5B,
+    0x04, 0x63, 0x07, 0x64, 0x80, 0x00, 0x05, 0x2F, 0x80, 0x00, 0x03, 0x64, 0x02, 0x00, 0x80, 0x64,
+    0x04, 0x00, 0x04, 0x01, 0x04, 0x05, 0x04, 0x06, 0x04, 0x5A, 0x04, 0x5B, 0x04, 0x63, 0x08, 0x64,
+    0x05, 0x00, 0x04, 0x64, 0x02, 0x00, 0x2E, 0x64, 0x02, 0x00, 0x02, 0x64, 0x9E, 0x5F, 0x59, 0x56,
+    0x53, 0x52, 0x4F, 0x4D, 0x48, 0x45, 0x43, 0x40, 0x3C, 0x39, 0x36, 0x32, 0x30, 0x2E, 0x2D, 0x2A,
+    0x26, 0x24, 0x22, 0x1D, 0x19, 0x15, 0x11, 0x0F, 0x0C, 0x0A, 0x04, 0x00, 0x0D, 0x64, 0x02, 0x00,
+    0x02, 0x64, 0x9E, 0x5F, 0x59, 0x56, 0x53, 0x52, 0x4F, 0x4D, 0x48, 0x45, 0x43, 0x40, 0x3C, 0x39,
+    0x36, 0x32, 0x30, 0x2E, 0x2D, 0x2A, 0x26, 0x24, 0x22, 0x1D, 0x19, 0x15, 0x11, 0x0F, 0x0C, 0x0A,
+    0x04, 0x00, 0x0D, 0x64, 0x02, 0x00, 0x02, 0x64, 0x9F, 0x5F, 0x59, 0x56, 0x53, 0x52, 0x4F, 0x4D,
+    0x48, 0x45, 0x43, 0x40, 0x3C, 0x39, 0x36, 0x32, 0x30, 0x2E, 0x2D, 0x2A, 0x26, 0x24, 0x22, 0x1D,
+    0x19, 0x15, 0x11, 0x0F, 0x0C, 0x0A, 0x04, 0x00, 0x64, 0x0B, 0x49, 0x80, 0x64, 0x02, 0x00, 0x22,
+    0x64, 0x0B, 0x49, 0x80, 0x64, 0x02, 0x00, 0x22, 0x64, 0x0B, 0x49, 0x80, 0x64, 0x02, 0x00, 0x04,
+    0x64, 0x84, 0x3D, 0x15, 0x18, 0x16, 0x3F, 0x02, 0x64, 0x81, 0x03, 0x25, 0x03, 0x64, 0x81, 0x26,
+    0x03, 0x02, 0x64, 0x80, 0x09, 0x02, 0x64, 0x82, 0x54, 0x14, 0x56, 0x08, 0x64, 0x0B, 0x49, 0x80,
+    0x64, 0x02, 0x00, 0x03, 0x64, 0x8E, 0x46, 0x1A, 0x59, 0x64, 0x59, 0x1A, 0x4A, 0x64, 0x09, 0x12,
+    0x61, 0x64, 0x62, 0x18, 0x09, 0x02, 0x64, 0x84, 0x09, 0x64, 0x5F, 0x1A, 0x4E, 0x09, 0x64, 0x0B,
+    0x49, 0x80, 0x64, 0x02, 0x00, 0x03, 0x64, 0x81, 0x1E, 0x4D, 0x03, 0x64, 0x89, 0x4C, 0x21, 0x64,
+    0x09, 0x29, 0x4E, 0x64, 0x4F, 0x2B, 0x09, 0x02, 0x64, 0x83, 0x09, 0x64, 0x28, 0x3B, 0x0A, 0x64,
+    0x0B, 0x49, 0x80, 0x64, 0x02, 0x00, 0x03, 0x64, 0x81, 0x0D, 0x5F, 0x03, 0x64, 0x89, 0x5F, 0x0E,
+    0x64, 0x09, 0x42, 0x31, 0x64, 0x34, 0x43, 0x09, 0x02, 0x64, 0x82, 0x09, 0x37, 0x2C, 0x0B, 0x64,
+    0x0B, 0x49, 0x80, 0x64, 0x02, 0x00, 0x03, 0x64, 0x81, 0x0D, 0x5F, 0x03, 0x64, 0x89, 0x5E, 0x0B,
+    0x64, 0x09, 0x58, 0x1B, 0x64, 0x20, 0x5D, 0x09, 0x02, 0x64, 0x82, 0x04, 0x10, 0x23, 0x0B, 0x64,
+    0x0B, 0x49, 0x80, 0x64, 0x02, 0x00, 0x03, 0x64, 0x81, 0x20, 0x4C, 0x03, 0x64, 0x89, 0x4B, 0x1B,
+    0x64, 0x09, 0x64, 0x1C, 0x54, 0x20, 0x64, 0x09, 0x02, 0x64, 0x83, 0x07, 0x5D, 0x1F, 0x3A, 0x0A,
+    0x64, 0x0B, 0x49, 0x80, 0x64, 0x02, 0x00, 0x03, 0x64, 0x8E, 0x47, 0x1A, 0x5C, 0x64, 0x59, 0x1B,
+    0x44, 0x64, 0x09, 0x64, 0x33, 0x27, 0x35, 0x64, 0x09, 0x02, 0x64, 0x84, 0x09, 0x64, 0x55, 0x0D,
+    0x52, 0x09, 0x64, 0x0B, 0x49, 0x80, 0x64, 0x02, 0x00, 0x04, 0x64, 0x82, 0x3E, 0x16, 0x17, 0x02,
+    0x08, 0x88, 0x38, 0x64, 0x09, 0x64, 0x50, 0x02, 0x51, 0x64, 0x09, 0x02, 0x64, 0x80, 0x09, 0x02,
+    0x64, 0x82, 0x41, 0x13, 0x60, 0x08, 0x64, 0x0B, 0x49, 0x80, 0x64, 0x02, 0x00, 0x08, 0x64, 0x81,
+    0x57, 0x49, 0x18, 0x64, 0x0B, 0x49, 0x80, 0x64, 0x02, 0x00, 0x2E, 0x64, 0x02, 0x00, 0x2E, 0x64,
+    0x31, 0x00,
+};
+// clang-format on
@@ -0,0 +1,27 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f pal4 -r`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_pal4_lz_length = 210;
+
+// clang-format off
+const uint8_t gfx_test_card_pal4_lz[210] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0xD2, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x05, 0x00, 0x02, 0xFF, 0xE8, 0x03, 0x03, 0xFC, 0x0C, 0x00, 0x00,
+    0x55, 0x40, 0xFF, 0x15, 0x56, 0x88, 0xE9, 0xFD, 0xE0, 0xAA, 0xFF, 0x13, 0x05, 0xFA, 0x91, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x00, 0x01, 0xFC, 0xFF, 0x86, 0x00, 0x07, 0x3F, 0x0C, 0x00, 0x00, 0x50,
+    0xA5, 0xAA, 0xFA, 0x8B, 0x0B, 0x01, 0x0F, 0xC0, 0x87, 0x0B, 0x01, 0x53, 0x15, 0x87, 0x0B, 0x02,
+    0x54, 0x55, 0x3C, 0x85, 0x0B, 0x03, 0x3F, 0x55, 0x55, 0x31, 0xB5, 0x0B, 0x89, 0x47, 0x8A, 0x5F,
+    0x80, 0x77, 0x89, 0x9B, 0x08, 0xFC, 0xFF, 0x5F, 0x55, 0x55, 0x15, 0x00, 0x00, 0xF0, 0x94, 0x0B,
+    0x03, 0x70, 0x55, 0x55, 0x35, 0x85, 0x2F, 0x00, 0x7F, 0x8D, 0x0B, 0x05, 0x07, 0xF4, 0xF0, 0xC7,
+    0xF3, 0xF3, 0x83, 0x0B, 0x05, 0xF1, 0xD3, 0xF0, 0xC3, 0xF3, 0xFC, 0x83, 0x0B, 0x05, 0xFC, 0xCF,
+    0xF4, 0xC7, 0x73, 0xFD, 0x85, 0x0B, 0x03, 0xD4, 0xC5, 0x53, 0xFF, 0x85, 0x0B, 0x02, 0xCC, 0xCC,
+    0x03, 0x88, 0x0B, 0x01, 0x33, 0xFD, 0x85, 0x3B, 0x01, 0x5C, 0xCD, 0x85, 0x3B, 0x05, 0x07, 0xD0,
+    0x3C, 0xCF, 0xF3, 0xF1, 0x84, 0x6B, 0x00, 0xDF, 0x8E, 0x77, 0x83, 0xB3, 0x87, 0x0B, 0x00, 0x00,
+    0x88, 0x00,
+};
+// clang-format on
@@ -0,0 +1,42 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f pal4 -r -z`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_pal4_raw_length = 449;
+
+// clang-format off
+const uint8_t gfx_test_card_pal4_raw[449] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0xC1, 0x01, 0x00, 0x00, 0x3E, 0xFE, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0xFF, 0xE8, 0x03, 0x03, 0xFC, 0x0C, 0x00, 0x00,
+    0x55, 0x40, 0xFF, 0x15, 0x56, 0x88, 0xE9, 0xFD, 0xE0, 0xAA, 0xFF, 0x13, 0x05, 0xFA, 0x80, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x00, 0x00, 0x50, 0xA5, 0xAA, 0xFA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x00, 0x00, 0x50, 0xA5, 0xAA, 0xFA, 0xFF, 0xFF, 0x0F, 0xC0,
+    0x3F, 0x0C, 0x00, 0x00, 0x50, 0xA5, 0xAA, 0xFA, 0xFF, 0xFF, 0x53, 0x15, 0x3F, 0x0C, 0x00, 0x00,
+    0x50, 0xA5, 0xAA, 0xFA, 0xFF, 0xFF, 0x54, 0x55, 0x3C, 0x0C, 0x00, 0x00, 0x50, 0xA5, 0xAA, 0xFA,
+    0xFF, 0x3F, 0x55, 0x55, 0x31, 0x0C, 0x00, 0x00, 0x50, 0xA5, 0xAA, 0xFA, 0xFF, 0x3F, 0x55, 0x55,
+    0x31, 0x0C, 0x00, 0x00, 0x50, 0xA5, 0xAA, 0xFA, 0xFF, 0x3F, 0x55, 0x55, 0x31, 0x0C, 0x00, 0x00,
+    0x50, 0xA5, 0xAA, 0xFA, 0xFF, 0x3F, 0x55, 0x55, 0x31, 0x0C, 0x00, 0x00, 0x50, 0xA5, 0xAA, 0xFA,
+    0xFF, 0x3F, 0x55, 0x55, 0x31, 0x0C, 0x00, 0x00, 0x50, 0xA5, 0xAA, 0xFA, 0xFF, 0xFF, 0x54, 0x55,
+    0x3C, 0x0C, 0x00, 0x00, 0x50, 0xA5, 0xAA, 0xFA, 0xFF, 0xFF, 0x53, 0x15, 0x3F, 0x0C, 0x00, 0x00,
+    0x50, 0xA5, 0xAA, 0xFA, 0xFF, 0xFF, 0x0F, 0xC0, 0x3F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFC, 0xFF, 0x5F, 0x55, 0x55, 0x15, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
+    0x3F, 0xFC, 0xFF, 0x5F, 0x55, 0x55, 0x15, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x3F, 0xFC, 0xFF, 0x5F,
+    0x55, 0x55, 0x15, 0x00, 0x00, 0x70, 0x55, 0x55, 0x35, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x7F, 0x55, 0x55, 0x35, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0x55,
+    0x35, 0xFC, 0x07, 0xF4, 0xF0, 0xC7, 0xF3, 0xF3, 0xFF, 0x7F, 0x55, 0x55, 0x35, 0xFC, 0xF1, 0xD3,
+    0xF0, 0xC3, 0xF3, 0xFC, 0xFF, 0x7F, 0x55, 0x55, 0x35, 0xFC, 0xFC, 0xCF, 0xF4, 0xC7, 0x73, 0xFD,
+    0xFF, 0x7F, 0x55, 0x55, 0x35, 0xFC, 0xFC, 0xCF, 0xD4, 0xC5, 0x53, 0xFF, 0xFF, 0x7F, 0x55, 0x55,
+    0x35, 0xFC, 0xFC, 0xCF, 0xCC, 0xCC, 0x03, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0x35, 0xFC, 0xFC, 0xCF,
+    0xCC, 0xCC, 0x33, 0xFD, 0xFF, 0x7F, 0x55, 0x55, 0x35, 0xFC, 0xF1, 0xD3, 0x5C, 0xCD, 0xF3, 0xFC,
+    0xFF, 0x7F, 0x55, 0x55, 0x35, 0xFC, 0x07, 0xD0, 0x3C, 0xCF, 0xF3, 0xF1, 0xFF, 0x7F, 0x55, 0x55,
+    0x35, 0xFC, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0x35, 0xFC, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00,
+};
+// clang-format on
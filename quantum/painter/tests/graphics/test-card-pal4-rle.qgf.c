@@ -0,0 +1,41 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f pal4 -z`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_pal4_rle_length = 443;
+
+// clang-format off
+const uint8_t gfx_test_card_pal4_rle[443] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0xBB, 0x01, 0x00, 0x00, 0x44, 0xFE, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x05, 0x00, 0x01, 0xFF, 0xE8, 0x03, 0x03, 0xFC, 0x0C, 0x00, 0x00,
+    0x55, 0x40, 0xFF, 0x15, 0x56, 0x88, 0xE9, 0xFD, 0xE0, 0xAA, 0xFF, 0x13, 0x05, 0xFA, 0x7A, 0x01,
+    0x00, 0x0C, 0x00, 0x80, 0xFC, 0x0A, 0xFF, 0x81, 0x3F, 0x0C, 0x02, 0x00, 0x83, 0x50, 0xA5, 0xAA,
+    0xFA, 0x04, 0xFF, 0x81, 0x3F, 0x0C, 0x02, 0x00, 0x83, 0x50, 0xA5, 0xAA, 0xFA, 0x02, 0xFF, 0x83,
+    0x0F, 0xC0, 0x3F, 0x0C, 0x02, 0x00, 0x83, 0x50, 0xA5, 0xAA, 0xFA, 0x02, 0xFF, 0x83, 0x53, 0x15,
+    0x3F, 0x0C, 0x02, 0x00, 0x83, 0x50, 0xA5, 0xAA, 0xFA, 0x02, 0xFF, 0x83, 0x54, 0x55, 0x3C, 0x0C,
+    0x02, 0x00, 0x85, 0x50, 0xA5, 0xAA, 0xFA, 0xFF, 0x3F, 0x02, 0x55, 0x81, 0x31, 0x0C, 0x02, 0x00,
+    0x85, 0x50, 0xA5, 0xAA, 0xFA, 0xFF, 0x3F, 0x02, 0x55, 0x81, 0x31, 0x0C, 0x02, 0x00, 0x85, 0x50,
+    0xA5, 0xAA, 0xFA, 0xFF, 0x3F, 0x02, 0x55, 0x81, 0x31, 0x0C, 0x02, 0x00, 0x85, 0x50, 0xA5, 0xAA,
+    0xFA, 0xFF, 0x3F, 0x02, 0x55, 0x81, 0x31, 0x0C, 0x02, 0x00, 0x85, 0x50, 0xA5, 0xAA, 0xFA, 0xFF,
+    0x3F, 0x02, 0x55, 0x81, 0x31, 0x0C, 0x02, 0x00, 0x83, 0x50, 0xA5, 0xAA, 0xFA, 0x02, 0xFF, 0x83,
+    0x54, 0x55, 0x3C, 0x0C, 0x02, 0x00, 0x83, 0x50, 0xA5, 0xAA, 0xFA, 0x02, 0xFF, 0x83, 0x53, 0x15,
+    0x3F, 0x0C, 0x02, 0x00, 0x83, 0x50, 0xA5, 0xAA, 0xFA, 0x02, 0xFF, 0x83, 0x0F, 0xC0, 0x3F, 0xFC,
+    0x0A, 0xFF, 0x83, 0x3F, 0xFC, 0xFF, 0x5F, 0x02, 0x55, 0x80, 0x15, 0x02, 0x00, 0x80, 0xF0, 0x02,
+    0xFF, 0x83, 0x3F, 0xFC, 0xFF, 0x5F, 0x02, 0x55, 0x80, 0x15, 0x02, 0x00, 0x80, 0xF0, 0x02, 0xFF,
+    0x83, 0x3F, 0xFC, 0xFF, 0x5F, 0x02, 0x55, 0x80, 0x15, 0x02, 0x00, 0x80, 0x70, 0x02, 0x55, 0x81,
+    0x35, 0xFC, 0x07, 0xFF, 0x80, 0x7F, 0x02, 0x55, 0x81, 0x35, 0xFC, 0x07, 0xFF, 0x80, 0x7F, 0x02,
+    0x55, 0x85, 0x35, 0xFC, 0x07, 0xF4, 0xF0, 0xC7, 0x02, 0xF3, 0x81, 0xFF, 0x7F, 0x02, 0x55, 0x89,
+    0x35, 0xFC, 0xF1, 0xD3, 0xF0, 0xC3, 0xF3, 0xFC, 0xFF, 0x7F, 0x02, 0x55, 0x80, 0x35, 0x02, 0xFC,
+    0x86, 0xCF, 0xF4, 0xC7, 0x73, 0xFD, 0xFF, 0x7F, 0x02, 0x55, 0x80, 0x35, 0x02, 0xFC, 0x83, 0xCF,
+    0xD4, 0xC5, 0x53, 0x02, 0xFF, 0x80, 0x7F, 0x02, 0x55, 0x80, 0x35, 0x02, 0xFC, 0x80, 0xCF, 0x02,
+    0xCC, 0x80, 0x03, 0x02, 0xFF, 0x80, 0x7F, 0x02, 0x55, 0x80, 0x35, 0x02, 0xFC, 0x80, 0xCF, 0x02,
+    0xCC, 0x83, 0x33, 0xFD, 0xFF, 0x7F, 0x02, 0x55, 0x89, 0x35, 0xFC, 0xF1, 0xD3, 0x5C, 0xCD, 0xF3,
+    0xFC, 0xFF, 0x7F, 0x02, 0x55, 0x89, 0x35, 0xFC, 0x07, 0xD0, 0x3C, 0xCF, 0xF3, 0xF1, 0xFF, 0x7F,
+    0x02, 0x55, 0x83, 0x35, 0xFC, 0xFF, 0xDF, 0x05, 0xFF, 0x80, 0x7F, 0x02, 0x55, 0x81, 0x35, 0xFC,
+    0x0A, 0xFF, 0x81, 0x3F, 0xFC, 0x0A, 0xFF, 0x80, 0x3F, 0x0C, 0x00,
+};
+// clang-format on
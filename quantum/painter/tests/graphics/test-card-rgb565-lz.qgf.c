@@ -0,0 +1,46 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f rgb565 -r`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_rgb565_lz_length = 523;
+
+// clang-format off
+const uint8_t gfx_test_card_rgb565_lz[523] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x0B, 0x02, 0x00, 0x00, 0xF4, 0xFD, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x08, 0x00, 0x02, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0xDB, 0x01, 0x00,
+    0x00, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0xD8, 0x00, 0x83, 0x5F, 0x86, 0x6A, 0x00, 0xE0, 0x83, 0x01,
+    0x01, 0x07, 0xFF, 0x84, 0x01, 0x00, 0xE0, 0x83, 0x01, 0x01, 0xF8, 0x1F, 0x84, 0x01, 0x00, 0x00,
+    0x83, 0x01, 0x01, 0x00, 0x1F, 0x84, 0x01, 0xEC, 0x5F, 0x86, 0x47, 0x00, 0xFF, 0xD1, 0x5F, 0x03,
+    0xFF, 0xFF, 0xFC, 0x00, 0x85, 0x01, 0x85, 0x61, 0xC7, 0x5F, 0x89, 0x5D, 0x87, 0x61, 0xC5, 0x5F,
+    0x8D, 0x5D, 0x85, 0x61, 0xFF, 0x5F, 0xFF, 0x5F, 0xFF, 0x5F, 0xBF, 0x5F, 0x8F, 0x61, 0x81, 0x57,
+    0xC9, 0x5F, 0x8B, 0x61, 0x83, 0x5D, 0xCB, 0x5F, 0x88, 0x47, 0x00, 0xFF, 0x89, 0x11, 0x00, 0x00,
+    0xD8, 0x00, 0x85, 0x5F, 0x3B, 0x08, 0x41, 0x10, 0x82, 0x18, 0xC3, 0x21, 0x04, 0x29, 0x45, 0x31,
+    0x86, 0x39, 0xC7, 0x42, 0x08, 0x4A, 0x49, 0x52, 0x8A, 0x5A, 0xCB, 0x63, 0x0C, 0x6B, 0x4D, 0x73,
+    0x8E, 0x7B, 0xCF, 0x84, 0x10, 0x8C, 0x51, 0x94, 0xB2, 0x9C, 0xF3, 0xA5, 0x34, 0xAD, 0x75, 0xB5,
+    0xB6, 0xBD, 0xF7, 0xC6, 0x38, 0xCE, 0x79, 0xD6, 0xBA, 0xDE, 0xFB, 0xE7, 0x3C, 0xEF, 0x7D, 0xF7,
+    0xBE, 0x99, 0xA1, 0xFF, 0x5F, 0xA3, 0x5F, 0x01, 0x42, 0x08, 0x91, 0x01, 0x87, 0x5F, 0xBD, 0x00,
+    0xFF, 0x5F, 0x05, 0x00, 0x00, 0x63, 0x0C, 0xCE, 0x79, 0x81, 0xF9, 0x01, 0x5A, 0xCB, 0x81, 0x0D,
+    0x03, 0xF7, 0xBE, 0xAD, 0x55, 0x83, 0x17, 0x03, 0xA5, 0x34, 0xF7, 0xBE, 0x82, 0x11, 0x00, 0x9E,
+    0x81, 0x05, 0x05, 0x18, 0xE3, 0xCE, 0x79, 0x18, 0xC3, 0xAF, 0x5F, 0x0D, 0x42, 0x28, 0xC6, 0x38,
+    0x10, 0x82, 0x00, 0x00, 0x10, 0x82, 0xC6, 0x38, 0x39, 0xE7, 0x81, 0x4D, 0x01, 0xD6, 0x9A, 0x83,
+    0x19, 0x01, 0xC6, 0x38, 0x83, 0x59, 0x81, 0x05, 0x01, 0x08, 0x41, 0x80, 0x1D, 0x00, 0xC7, 0xB1,
+    0xBF, 0x01, 0xBD, 0xF7, 0x85, 0x37, 0x03, 0x39, 0xC7, 0xB5, 0xB6, 0x81, 0x4D, 0x01, 0x9C, 0xF3,
+    0x81, 0x11, 0x03, 0x31, 0x86, 0x9C, 0xD3, 0x87, 0x5F, 0x05, 0xA5, 0x14, 0x63, 0x2C, 0x00, 0x00,
+    0xB1, 0x5F, 0x03, 0xE7, 0x3C, 0x08, 0x41, 0x83, 0x09, 0x03, 0x08, 0x41, 0xE7, 0x1C, 0x81, 0x4D,
+    0x09, 0x5A, 0xCB, 0x7B, 0xEF, 0x00, 0x00, 0x7B, 0xCF, 0x52, 0x8A, 0x85, 0x5F, 0x05, 0x6B, 0x6D,
+    0x9C, 0xD3, 0x00, 0x00, 0xBF, 0x5F, 0x01, 0xEF, 0x7D, 0x81, 0x4D, 0x03, 0x10, 0x82, 0xC6, 0x18,
+    0x80, 0xD7, 0x02, 0xD7, 0x08, 0x61, 0x84, 0x5F, 0x04, 0xBE, 0xDE, 0xDB, 0xB5, 0x96, 0xB5, 0x5F,
+    0x03, 0xBD, 0xD7, 0x39, 0xC7, 0x83, 0x09, 0x01, 0x39, 0xC7, 0x81, 0x57, 0x81, 0x53, 0x05, 0xC6,
+    0x18, 0x18, 0xE3, 0xBD, 0xD7, 0x83, 0x0B, 0x81, 0x05, 0x05, 0x08, 0x61, 0xBD, 0xD7, 0x6B, 0x4D,
+    0xB3, 0x5F, 0x07, 0x42, 0x08, 0xC6, 0x38, 0x08, 0x61, 0x00, 0x00, 0x81, 0xB5, 0x01, 0x4A, 0x49,
+    0x83, 0x53, 0x05, 0x7B, 0xCF, 0xA5, 0x14, 0x73, 0xAE, 0x87, 0x5F, 0x07, 0x00, 0x00, 0x18, 0xE3,
+    0xE7, 0x3C, 0x29, 0x45, 0xB1, 0x5F, 0x0D, 0x00, 0x00, 0x5A, 0xEB, 0xCE, 0x79, 0xCE, 0x59, 0xF7,
+    0x9E, 0xF7, 0x9E, 0x6B, 0x6D, 0x83, 0x4D, 0x05, 0x29, 0x65, 0xFF, 0xFF, 0x29, 0x65, 0x89, 0x5F,
+    0x80, 0x25, 0x04, 0xCB, 0xD6, 0x9A, 0x00, 0x20, 0xB1, 0x5F, 0x85, 0x00, 0x01, 0x10, 0xA2, 0x81,
+    0x19, 0xAB, 0x00, 0xA9, 0x5F, 0xC9, 0x00, 0xE1, 0x5F, 0xDB, 0x00,
+};
+// clang-format on
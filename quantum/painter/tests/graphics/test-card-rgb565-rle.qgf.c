@@ -0,0 +1,131 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i test-card.png -f rgb565 -z`
+
+#include <qp.h>
+
+const uint32_t gfx_test_card_rgb565_rle_length = 1875;
+
+// clang-format off
+const uint8_t gfx_test_card_rgb565_rle[1875] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x53, 0x07, 0x00, 0x00, 0xAC, 0xF8, 0xFF,
+    0xFF, 0x30, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x08, 0x00, 0x01, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0x23, 0x07, 0x00,
+    0x62, 0xFF, 0x5C, 0x00, 0x04, 0xFF, 0x02, 0x00, 0x09, 0xFF, 0xA5, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0,
+    0xFF, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+    0x07, 0xE0, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+    0xF8, 0x02, 0x00, 0x86, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x22, 0x00, 0x04, 0xFF, 0x02,
+    0x00, 0x09, 0xFF, 0xA5, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x07,
+    0xFF, 0x07, 0xFF, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+    0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x02, 0x00, 0x86, 0x1F, 0x00, 0x1F,
+    0x00, 0x1F, 0x00, 0x1F, 0x10, 0x00, 0x0A, 0xFF, 0x08, 0x00, 0x04, 0xFF, 0x02, 0x00, 0x09, 0xFF,
+    0xA5, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF,
+    0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+    0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x02, 0x00, 0x86, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00,
+    0x1F, 0x0E, 0x00, 0x02, 0xFF, 0x89, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00,
+    0x02, 0xFF, 0x06, 0x00, 0x04, 0xFF, 0x02, 0x00, 0x09, 0xFF, 0xA5, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0,
+    0xFF, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+    0x07, 0xE0, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+    0xF8, 0x02, 0x00, 0x86, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x0C, 0x00, 0x02, 0xFF, 0x8D,
+    0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x02, 0xFF,
+    0x04, 0x00, 0x04, 0xFF, 0x02, 0x00, 0x09, 0xFF, 0xA5, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0,
+    0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+    0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x02,
+    0x00, 0x86, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x0A, 0x00, 0x02, 0xFF, 0x91, 0xFC, 0x00,
+    0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00,
+    0x02, 0xFF, 0x02, 0x00, 0x04, 0xFF, 0x02, 0x00, 0x09, 0xFF, 0xA5, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0,
+    0xFF, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+    0x07, 0xE0, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+    0xF8, 0x02, 0x00, 0x86, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x0A, 0x00, 0x02, 0xFF, 0x91,
+    0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00,
+    0xFC, 0x00, 0x02, 0xFF, 0x02, 0x00, 0x04, 0xFF, 0x02, 0x00, 0x09, 0xFF, 0xA5, 0xE0, 0xFF, 0xE0,
+    0xFF, 0xE0, 0xFF, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xE0, 0x07, 0xE0,
+    0x07, 0xE0, 0x07, 0xE0, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0xF8, 0x00,
+    0xF8, 0x00, 0xF8, 0x02, 0x00, 0x86, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x0A, 0x00, 0x02,
+    0xFF, 0x91, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00,
+    0xFC, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0x02, 0x00, 0x04, 0xFF, 0x02, 0x00, 0x09, 0xFF, 0xA5, 0xE0,
+    0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xE0,
+    0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x00,
+    0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x02, 0x00, 0x86, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x0A,
+    0x00, 0x02, 0xFF, 0x91, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00,
+    0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0x02, 0x00, 0x04, 0xFF, 0x02, 0x00, 0x09, 0xFF,
+    0xA5, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF,
+    0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+    0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x02, 0x00, 0x86, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00,
+    0x1F, 0x0A, 0x00, 0x02, 0xFF, 0x91, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00,
+    0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0x02, 0x00, 0x04, 0xFF, 0x02, 0x00,
+    0x09, 0xFF, 0xA5, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF,
+    0x07, 0xFF, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+    0xF8, 0x1F, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x02, 0x00, 0x86, 0x1F, 0x00, 0x1F, 0x00,
+    0x1F, 0x00, 0x1F, 0x0C, 0x00, 0x02, 0xFF, 0x8D, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00,
+    0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0x04, 0x00, 0x04, 0xFF, 0x02, 0x00, 0x09, 0xFF,
+    0xA5, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF,
+    0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+    0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x02, 0x00, 0x86, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00,
+    0x1F, 0x0E, 0x00, 0x02, 0xFF, 0x89, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00,
+    0x02, 0xFF, 0x06, 0x00, 0x04, 0xFF, 0x02, 0x00, 0x09, 0xFF, 0xA5, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0,
+    0xFF, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+    0x07, 0xE0, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+    0xF8, 0x02, 0x00, 0x86, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x10, 0x00, 0x0A, 0xFF, 0x08,
+    0x00, 0x04, 0xFF, 0x5C, 0x00, 0x04, 0xFF, 0x04, 0x00, 0xBB, 0x08, 0x41, 0x10, 0x82, 0x18, 0xC3,
+    0x21, 0x04, 0x29, 0x45, 0x31, 0x86, 0x39, 0xC7, 0x42, 0x08, 0x4A, 0x49, 0x52, 0x8A, 0x5A, 0xCB,
+    0x63, 0x0C, 0x6B, 0x4D, 0x73, 0x8E, 0x7B, 0xCF, 0x84, 0x10, 0x8C, 0x51, 0x94, 0xB2, 0x9C, 0xF3,
+    0xA5, 0x34, 0xAD, 0x75, 0xB5, 0xB6, 0xBD, 0xF7, 0xC6, 0x38, 0xCE, 0x79, 0xD6, 0xBA, 0xDE, 0xFB,
+    0xE7, 0x3C, 0xEF, 0x7D, 0xF7, 0xBE, 0x02, 0xFF, 0x1A, 0x00, 0x04, 0xFF, 0x04, 0x00, 0xBB, 0x08,
+    0x41, 0x10, 0x82, 0x18, 0xC3, 0x21, 0x04, 0x29, 0x45, 0x31, 0x86, 0x39, 0xC7, 0x42, 0x08, 0x4A,
+    0x49, 0x52, 0x8A, 0x5A, 0xCB, 0x63, 0x0C, 0x6B, 0x4D, 0x73, 0x8E, 0x7B, 0xCF, 0x84, 0x10, 0x8C,
+    0x51, 0x94, 0xB2, 0x9C, 0xF3, 0xA5, 0x34, 0xAD, 0x75, 0xB5, 0xB6, 0xBD, 0xF7, 0xC6, 0x38, 0xCE,
+    0x79, 0xD6, 0xBA, 0xDE, 0xFB, 0xE7, 0x3C, 0xEF, 0x7D, 0xF7, 0xBE, 0x02, 0xFF, 0x1A, 0x00, 0x04,
+    0xFF, 0x04, 0x00, 0xBB, 0x08, 0x41, 0x10, 0x82, 0x18, 0xC3, 0x21, 0x04, 0x29, 0x45, 0x31, 0x86,
+    0x39, 0xC7, 0x42, 0x08, 0x4A, 0x49, 0x52, 0x8A, 0x5A, 0xCB, 0x63, 0x0C, 0x6B, 0x4D, 0x73, 0x8E,
+    0x7B, 0xCF, 0x84, 0x10, 0x8C, 0x51, 0x94, 0xB2, 0x9C, 0xF3, 0xA5, 0x34, 0xAD, 0x75, 0xB5, 0xB6,
+    0xBD, 0xF7, 0xC6, 0x38, 0xCE, 0x79, 0xD6, 0xBA, 0xDE, 0xFB, 0xE7, 0x3C, 0xEF, 0x7D, 0xF7, 0xBE,
+    0x02, 0xFF, 0x02, 0x00, 0x95, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42,
+    0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x02, 0x00, 0x04, 0xFF, 0x44,
+    0x00, 0x95, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x02, 0x00, 0x04, 0xFF, 0x44, 0x00, 0x95, 0x42,
+    0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42,
+    0x08, 0x42, 0x08, 0x42, 0x08, 0x02, 0x00, 0x04, 0xFF, 0x08, 0x00, 0x89, 0x63, 0x0C, 0xCE, 0x79,
+    0xC6, 0x38, 0xCE, 0x79, 0x5A, 0xCB, 0x04, 0x00, 0x83, 0xF7, 0xBE, 0xAD, 0x55, 0x06, 0x00, 0x83,
+    0xA5, 0x34, 0xF7, 0xBE, 0x04, 0x00, 0x81, 0xF7, 0x9E, 0x04, 0x00, 0x85, 0x18, 0xE3, 0xCE, 0x79,
+    0x18, 0xC3, 0x10, 0x00, 0x95, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42,
+    0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x02, 0x00, 0x04, 0xFF, 0x06,
+    0x00, 0x85, 0x42, 0x28, 0xC6, 0x38, 0x10, 0x82, 0x02, 0x00, 0x85, 0x10, 0x82, 0xC6, 0x38, 0x39,
+    0xE7, 0x02, 0x00, 0x83, 0xF7, 0x9E, 0xD6, 0x9A, 0x06, 0x00, 0x83, 0xC6, 0x38, 0xF7, 0x9E, 0x04,
+    0x00, 0x81, 0xF7, 0x9E, 0x02, 0x00, 0x85, 0x08, 0x41, 0xC6, 0x38, 0x39, 0xC7, 0x12, 0x00, 0x95,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+    0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x02, 0x00, 0x04, 0xFF, 0x06, 0x00, 0x83, 0xBD, 0xF7, 0x39,
+    0xC7, 0x06, 0x00, 0x83, 0x39, 0xC7, 0xB5, 0xB6, 0x02, 0x00, 0x85, 0xF7, 0x9E, 0x9C, 0xF3, 0x39,
+    0xC7, 0x02, 0x00, 0x85, 0x31, 0x86, 0x9C, 0xD3, 0xF7, 0x9E, 0x04, 0x00, 0x81, 0xF7, 0x9E, 0x02,
+    0x00, 0x83, 0xA5, 0x14, 0x63, 0x2C, 0x14, 0x00, 0x95, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42,
+    0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x02,
+    0x00, 0x04, 0xFF, 0x06, 0x00, 0x83, 0xE7, 0x3C, 0x08, 0x41, 0x06, 0x00, 0x83, 0x08, 0x41, 0xE7,
+    0x1C, 0x02, 0x00, 0x85, 0xF7, 0x9E, 0x5A, 0xCB, 0x7B, 0xEF, 0x02, 0x00, 0x85, 0x7B, 0xCF, 0x52,
+    0x8A, 0xF7, 0x9E, 0x04, 0x00, 0x85, 0xF7, 0x9E, 0x6B, 0x6D, 0x9C, 0xD3, 0x16, 0x00, 0x95, 0x42,
+    0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42,
+    0x08, 0x42, 0x08, 0x42, 0x08, 0x02, 0x00, 0x04, 0xFF, 0x06, 0x00, 0x83, 0xE7, 0x3C, 0x08, 0x41,
+    0x06, 0x00, 0x83, 0x08, 0x41, 0xEF, 0x7D, 0x02, 0x00, 0x85, 0xF7, 0x9E, 0x10, 0x82, 0xC6, 0x18,
+    0x02, 0x00, 0x85, 0xBD, 0xD7, 0x08, 0x61, 0xF7, 0x9E, 0x04, 0x00, 0x85, 0xF7, 0xBE, 0xDE, 0xDB,
+    0xB5, 0x96, 0x16, 0x00, 0x95, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42,
+    0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x02, 0x00, 0x04, 0xFF, 0x06,
+    0x00, 0x83, 0xBD, 0xD7, 0x39, 0xC7, 0x06, 0x00, 0x83, 0x39, 0xC7, 0xC6, 0x18, 0x02, 0x00, 0x81,
+    0xF7, 0x9E, 0x02, 0x00, 0x80, 0xC6, 0x02, 0x18, 0x82, 0xE3, 0xBD, 0xD7, 0x02, 0x00, 0x81, 0xF7,
+    0x9E, 0x04, 0x00, 0x87, 0xF7, 0x9E, 0x08, 0x61, 0xBD, 0xD7, 0x6B, 0x4D, 0x14, 0x00, 0x95, 0x42,
+    0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42,
+    0x08, 0x42, 0x08, 0x42, 0x08, 0x02, 0x00, 0x04, 0xFF, 0x06, 0x00, 0x85, 0x42, 0x08, 0xC6, 0x38,
+    0x08, 0x61, 0x02, 0x00, 0x85, 0x10, 0x82, 0xC6, 0x18, 0x4A, 0x49, 0x02, 0x00, 0x81, 0xF7, 0x9E,
+    0x02, 0x00, 0x85, 0x7B, 0xCF, 0xA5, 0x14, 0x73, 0xAE, 0x02, 0x00, 0x81, 0xF7, 0x9E, 0x04, 0x00,
+    0x81, 0xF7, 0x9E, 0x02, 0x00, 0x85, 0x18, 0xE3, 0xE7, 0x3C, 0x29, 0x45, 0x12, 0x00, 0x95, 0x42,
+    0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42,
+    0x08, 0x42, 0x08, 0x42, 0x08, 0x02, 0x00, 0x04, 0xFF, 0x08, 0x00, 0x8B, 0x5A, 0xEB, 0xCE, 0x79,
+    0xCE, 0x59, 0xF7, 0x9E, 0xF7, 0x9E, 0x6B, 0x6D, 0x02, 0x00, 0x81, 0xF7, 0x9E, 0x02, 0x00, 0x81,
+    0x29, 0x65, 0x02, 0xFF, 0x81, 0x29, 0x65, 0x02, 0x00, 0x81, 0xF7, 0x9E, 0x04, 0x00, 0x81, 0xF7,
+    0x9E, 0x04, 0x00, 0x85, 0x5A, 0xCB, 0xD6, 0x9A, 0x00, 0x20, 0x10, 0x00, 0x95, 0x42, 0x08, 0x42,
+    0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42,
+    0x08, 0x42, 0x08, 0x02, 0x00, 0x04, 0xFF, 0x10, 0x00, 0x83, 0x10, 0xA2, 0x42, 0x08, 0x30, 0x00,
+    0x95, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42,
+    0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x02, 0x00, 0x04, 0xFF, 0x5C, 0x00, 0x04, 0xFF, 0x5C,
+    0x00, 0x62, 0xFF,
+};
+// clang-format on
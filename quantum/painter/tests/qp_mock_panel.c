@@ -0,0 +1,246 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <stdlib.h>
+#include <string.h>
+#include "qp_internal.h"
+#include "qp_comms.h"
+#include "qp_tft_panel.h"
+#include "qp_mock_panel.h"
+
+#define MOCK_PANEL_CMD_SLEEP_OFF 0x11
+#define MOCK_PANEL_CMD_DISPLAY_OFF 0x28
+#define MOCK_PANEL_CMD_DISPLAY_ON 0x29
+#define MOCK_PANEL_CMD_SET_COL_ADDR 0x2A
+#define MOCK_PANEL_CMD_SET_ROW_ADDR 0x2B
+#define MOCK_PANEL_CMD_SET_MEM 0x2C
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Common
+
+// Device definition
+typedef struct mock_panel_painter_device_t {
+    painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
+
+    // Emulated panel memory
+    uint16_t *gram;
+
+    // Controller state, updated as commands and data are received
+    uint8_t  command;
+    uint8_t  param_count;
+    uint8_t  params[4];
+    uint16_t col_start;
+    uint16_t col_end;
+    uint16_t row_start;
+    uint16_t row_end;
+    uint16_t write_x;
+    uint16_t write_y;
+    uint8_t  pixel_msb;
+    bool     pixel_msb_valid;
+
+    qp_mock_panel_stats_t stats;
+} mock_panel_painter_device_t;
+
+static mock_panel_painter_device_t mock_panel_device = {0};
+
+static inline void mock_panel_write_pixel(mock_panel_painter_device_t *panel, uint16_t rgb565) {
+    if (panel->write_x < panel->base.panel_width && panel->write_y < panel->base.panel_height) {
+        panel->gram[panel->write_y * panel->base.panel_width + panel->write_x] = rgb565;
+    }
+
+    // Advance through the window, wrapping back to the start like the real controllers do
+    if (++panel->write_x > panel->col_end) {
+        panel->write_x = panel->col_start;
+        if (++panel->write_y > panel->row_end) {
+            panel->write_y = panel->row_start;
+        }
+    }
+}
+
+static void mock_panel_receive_data(mock_panel_painter_device_t *panel, const uint8_t *data, uint32_t byte_count) {
+    switch (panel->command) {
+        case MOCK_PANEL_CMD_SET_COL_ADDR:
+        case MOCK_PANEL_CMD_SET_ROW_ADDR:
+            for (uint32_t i = 0; i < byte_count && panel->param_count < sizeof(panel->params); ++i) {
+                panel->params[panel->param_count++] = data[i];
+            }
+            if (panel->param_count == sizeof(panel->params)) {
+                uint16_t start = ((uint16_t)panel->params[0]) << 8 | panel->params[1];
+                uint16_t end   = ((uint16_t)panel->params[2]) << 8 | panel->params[3];
+                if (panel->command == MOCK_PANEL_CMD_SET_COL_ADDR) {
+                    panel->col_start = start;
+                    panel->col_end   = end;
+                } else {
+                    panel->row_start = start;
+                    panel->row_end   = end;
+                }
+            }
+            break;
+
+        case MOCK_PANEL_CMD_SET_MEM:
+            // Pixels are received MSB first
+            panel->stats.pixel_bytes += byte_count;
+            for (uint32_t i = 0; i < byte_count; ++i) {
+                if (panel->pixel_msb_valid) {
+                    mock_panel_write_pixel(panel, ((uint16_t)panel->pixel_msb) << 8 | data[i]);
+                    panel->pixel_msb_valid = false;
+                } else {
+                    panel->pixel_msb       = data[i];
+                    panel->pixel_msb_valid = true;
+                }
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Comms vtable
+
+static bool qp_mock_panel_comms_init(painter_device_t device) {
+    // No-op.
+    return true;
+}
+
+static bool qp_mock_panel_comms_start(painter_device_t device) {
+    mock_panel_painter_device_t *panel = (mock_panel_painter_device_t *)device;
+    panel->stats.start_calls++;
+    return true;
+}
+
+static void qp_mock_panel_comms_stop(painter_device_t device) {
+    // No-op.
+}
+
+static uint32_t qp_mock_panel_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    mock_panel_painter_device_t *panel = (mock_panel_painter_device_t *)device;
+    panel->stats.send_calls++;
+    panel->stats.bytes_sent += byte_count;
+    mock_panel_receive_data(panel, (const uint8_t *)data, byte_count);
+    return byte_count;
+}
+
+static void qp_mock_panel_comms_send_command(painter_device_t device, uint8_t cmd) {
+    mock_panel_painter_device_t *panel = (mock_panel_painter_device_t *)device;
+    panel->stats.command_calls++;
+    panel->stats.bytes_sent++;
+
+    panel->command         = cmd;
+    panel->param_count     = 0;
+    panel->pixel_msb_valid = false;
+    if (cmd == MOCK_PANEL_CMD_SET_MEM) {
+        panel->write_x = panel->col_start;
+        panel->write_y = panel->row_start;
+    }
+}
+
+static void qp_mock_panel_comms_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
+    // Same layout as the other drivers' init sequences, delays are skipped
+    for (size_t i = 0; i < sequence_len;) {
+        uint8_t command   = sequence[i];
+        uint8_t num_bytes = sequence[i + 2];
+        qp_mock_panel_comms_send_command(device, command);
+        if (num_bytes > 0) {
+            qp_mock_panel_comms_send(device, &sequence[i + 3], num_bytes);
+        }
+        i += (3 + num_bytes);
+    }
+}
+
+static const painter_comms_with_command_vtable_t mock_panel_comms_vtable = {
+    .base =
+        {
+            .comms_init  = qp_mock_panel_comms_init,
+            .comms_start = qp_mock_panel_comms_start,
+            .comms_send  = qp_mock_panel_comms_send,
+            .comms_stop  = qp_mock_panel_comms_stop,
+        },
+    .send_command          = qp_mock_panel_comms_send_command,
+    .bulk_command_sequence = qp_mock_panel_comms_bulk_command_sequence,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Driver vtable
+
+static bool qp_mock_panel_init(painter_device_t device, painter_rotation_t rotation) {
+    mock_panel_painter_device_t *panel = (mock_panel_painter_device_t *)device;
+    memset(panel->gram, 0, sizeof(uint16_t) * panel->base.panel_width * panel->base.panel_height);
+
+    // clang-format off
+    const uint8_t mock_panel_init_sequence[] = {
+        // Command,                 Delay, N, Data[N]
+        MOCK_PANEL_CMD_SLEEP_OFF,   5,     0,
+        MOCK_PANEL_CMD_DISPLAY_ON,  0,     0,
+    };
+    // clang-format on
+    qp_comms_bulk_command_sequence(device, mock_panel_init_sequence, sizeof(mock_panel_init_sequence));
+    return true;
+}
+
+static const tft_panel_dc_reset_painter_driver_vtable_t mock_panel_driver_vtable = {
+    .base =
+        {
+            .init            = qp_mock_panel_init,
+            .power           = qp_tft_panel_power,
+            .clear           = qp_tft_panel_clear,
+            .flush           = qp_tft_panel_flush,
+            .pixdata         = qp_tft_panel_pixdata,
+            .viewport        = qp_tft_panel_viewport,
+            .palette_convert = qp_tft_panel_palette_convert_rgb565_swapped,
+            .append_pixels   = qp_tft_panel_append_pixels_rgb565,
+            .append_pixdata  = qp_tft_panel_append_pixdata,
+        },
+    .num_window_bytes   = 2,
+    .swap_window_coords = false,
+    .opcodes =
+        {
+            .display_on         = MOCK_PANEL_CMD_DISPLAY_ON,
+            .display_off        = MOCK_PANEL_CMD_DISPLAY_OFF,
+            .set_column_address = MOCK_PANEL_CMD_SET_COL_ADDR,
+            .set_row_address    = MOCK_PANEL_CMD_SET_ROW_ADDR,
+            .enable_writes      = MOCK_PANEL_CMD_SET_MEM,
+        },
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Factory function and accessors
+
+painter_device_t qp_mock_panel_make_device(uint16_t panel_width, uint16_t panel_height) {
+    mock_panel_painter_device_t *panel = &mock_panel_device;
+    if (panel->base.driver_vtable) {
+        return NULL;
+    }
+
+    panel->gram = (uint16_t *)calloc((size_t)panel_width * panel_height, sizeof(uint16_t));
+    if (!panel->gram) {
+        return NULL;
+    }
+
+    panel->base.driver_vtable         = (const painter_driver_vtable_t *)&mock_panel_driver_vtable;
+    panel->base.comms_vtable          = (const painter_comms_vtable_t *)&mock_panel_comms_vtable;
+    panel->base.panel_width           = panel_width;
+    panel->base.panel_height          = panel_height;
+    panel->base.rotation              = QP_ROTATION_0;
+    panel->base.offset_x              = 0;
+    panel->base.offset_y              = 0;
+    panel->base.native_bits_per_pixel = 16; // RGB565
+    panel->col_end                    = panel_width - 1;
+    panel->row_end                    = panel_height - 1;
+    return (painter_device_t)panel;
+}
+
+const uint16_t *qp_mock_panel_gram(painter_device_t device) {
+    mock_panel_painter_device_t *panel = (mock_panel_painter_device_t *)device;
+    return panel->gram;
+}
+
+qp_mock_panel_stats_t qp_mock_panel_get_stats(painter_device_t device) {
+    mock_panel_painter_device_t *panel = (mock_panel_painter_device_t *)device;
+    return panel->stats;
+}
+
+void qp_mock_panel_reset_stats(painter_device_t device) {
+    mock_panel_painter_device_t *panel = (mock_panel_painter_device_t *)device;
+    memset(&panel->stats, 0, sizeof(panel->stats));
+}
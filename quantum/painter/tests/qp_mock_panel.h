@@ -0,0 +1,43 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include "qp.h"
+
+/**
+ * Transfer statistics for the mock panel's comms layer.
+ */
+typedef struct qp_mock_panel_stats_t {
+    uint32_t start_calls;   ///< Number of comms_start invocations
+    uint32_t command_calls; ///< Number of commands sent, each one byte
+    uint32_t send_calls;    ///< Number of data transfers
+    uint32_t bytes_sent;    ///< Total bytes transferred, including commands
+    uint32_t pixel_bytes;   ///< Bytes written into the panel's memory
+} qp_mock_panel_stats_t;
+
+/**
+ * Factory method for a mock RGB565 panel, behaving like a MIPI DCS-compatible TFT controller (CASET/RASET/RAMWR).
+ *
+ * The panel uses the common TFT panel driver implementation, with a comms layer that counts every call and byte and
+ * decodes the transferred pixel data into an in-memory copy of the panel's GRAM.
+ *
+ * @param panel_width[in] the width of the display panel
+ * @param panel_height[in] the height of the display panel
+ * @return the device handle used with all drawing routines in Quantum Painter
+ */
+painter_device_t qp_mock_panel_make_device(uint16_t panel_width, uint16_t panel_height);
+
+/**
+ * Retrieves the panel's GRAM contents, as RGB565 values in row-major order.
+ */
+const uint16_t *qp_mock_panel_gram(painter_device_t device);
+
+/**
+ * Retrieves the transfer statistics accumulated since the last call to qp_mock_panel_reset_stats().
+ */
+qp_mock_panel_stats_t qp_mock_panel_get_stats(painter_device_t device);
+
+/**
+ * Resets the transfer statistics.
+ */
+void qp_mock_panel_reset_stats(painter_device_t device);
@@ -0,0 +1,350 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "fnv.h"
+#include "qp.h"
+#include "qp_mock_panel.h"
+}
+
+/* Renders fixed scenes through Quantum Painter, comparing the result against golden hashes and reporting for each:
+ *  - the number of pixels written to the panel and the rate at which they were generated,
+ *  - the bytes and transfers needed to draw the scene directly to the panel,
+ *  - the bytes and transfers needed to composite the scene from an RGB565 surface.
+ *
+ * Every scene is written to $(BUILD_DIR)/test/qp_render_<scene>.ppm for inspection. If a change to Quantum Painter
+ * intentionally alters the output, check the new images and update the hashes below.
+ */
+
+#ifndef QP_RENDER_OUTPUT_DIR
+#    define QP_RENDER_OUTPUT_DIR "."
+#endif
+
+// clang-format off
+#define TEST_CARD_IMAGES(X) \
+    X(mono2, raw)   X(mono2, rle)   X(mono2, lz)   \
+    X(mono4, raw)   X(mono4, rle)   X(mono4, lz)   \
+    X(mono16, raw)  X(mono16, rle)  X(mono16, lz)  \
+    X(mono256, raw) X(mono256, rle) X(mono256, lz) \
+    X(pal2, raw)    X(pal2, rle)    X(pal2, lz)    \
+    X(pal4, raw)    X(pal4, rle)    X(pal4, lz)    \
+    X(pal16, raw)   X(pal16, rle)   X(pal16, lz)   \
+    X(pal256, raw)  X(pal256, rle)  X(pal256, lz)  \
+    X(rgb565, raw)  X(rgb565, rle)  X(rgb565, lz)
+// clang-format on
+
+extern "C" {
+#define DECLARE_TEST_CARD(format, scheme) extern const uint8_t gfx_test_card_##format##_##scheme[];
+TEST_CARD_IMAGES(DECLARE_TEST_CARD)
+#undef DECLARE_TEST_CARD
+
+extern const uint8_t font_thintel15[];
+extern const uint8_t font_aileron12[];
+extern const uint8_t font_aileron16[];
+}
+
+static constexpr uint16_t PANEL_WIDTH  = 240;
+static constexpr uint16_t PANEL_HEIGHT = 96;
+
+// Hash of the RGB888 pixel data of each scene, as written to its PPM
+static const std::map<std::string, Fnv32_t> golden_hashes = {
+    {"primitives", 0xa1e072ef},
+    {"dashboard", 0xb6f6f492},
+    {"image_mono2_raw", 0x069ad6c7},
+    {"image_mono2_rle", 0x069ad6c7},
+    {"image_mono2_lz", 0x069ad6c7},
+    {"image_mono4_raw", 0x2a24df9b},
+    {"image_mono4_rle", 0x2a24df9b},
+    {"image_mono4_lz", 0x2a24df9b},
+    {"image_mono16_raw", 0xa12dadf6},
+    {"image_mono16_rle", 0xa12dadf6},
+    {"image_mono16_lz", 0xa12dadf6},
+    {"image_mono256_raw", 0xad888b05},
+    {"image_mono256_rle", 0xad888b05},
+    {"image_mono256_lz", 0xad888b05},
+    {"image_pal2_raw", 0x9be1d273},
+    {"image_pal2_rle", 0x9be1d273},
+    {"image_pal2_lz", 0x9be1d273},
+    {"image_pal4_raw", 0x438497e9},
+    {"image_pal4_rle", 0x438497e9},
+    {"image_pal4_lz", 0x438497e9},
+    {"image_pal16_raw", 0x5a6c266c},
+    {"image_pal16_rle", 0x5a6c266c},
+    {"image_pal16_lz", 0x5a6c266c},
+    {"image_pal256_raw", 0x8ccd8677},
+    {"image_pal256_rle", 0x8ccd8677},
+    {"image_pal256_lz", 0x8ccd8677},
+    {"image_rgb565_raw", 0x3d22f0a2},
+    {"image_rgb565_rle", 0x3d22f0a2},
+    {"image_rgb565_lz", 0x3d22f0a2},
+    {"text_thintel15", 0x47c7217b},
+    {"text_aileron12", 0x30fbaaa6},
+    {"text_aileron16", 0x2b23a3cd},
+};
+
+class QuantumPainterRender : public ::testing::Test {
+   protected:
+    static painter_device_t      panel;
+    static painter_device_t      surface;
+    static std::vector<uint16_t> framebuffer;
+
+    void SetUp() override {
+        // Devices can't be released, so they're shared between all tests
+        if (!panel) {
+            framebuffer.resize(PANEL_WIDTH * PANEL_HEIGHT);
+            panel   = qp_mock_panel_make_device(PANEL_WIDTH, PANEL_HEIGHT);
+            surface = qp_rgb565_make_surface(PANEL_WIDTH, PANEL_HEIGHT, framebuffer.data());
+            ASSERT_TRUE(qp_init(panel, QP_ROTATION_0));
+            ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+            ASSERT_TRUE(qp_rgb565_surface_set_target(surface, panel, 0, 0));
+        }
+    }
+
+    /**
+     * Converts the panel's GRAM to RGB888.
+     */
+    std::vector<uint8_t> panel_rgb888(void) {
+        const uint16_t*      gram = qp_mock_panel_gram(panel);
+        std::vector<uint8_t> rgb;
+        rgb.reserve(PANEL_WIDTH * PANEL_HEIGHT * 3);
+        for (std::size_t i = 0; i < PANEL_WIDTH * PANEL_HEIGHT; ++i) {
+            uint8_t r = (gram[i] >> 11) & 0x1F;
+            uint8_t g = (gram[i] >> 5) & 0x3F;
+            uint8_t b = gram[i] & 0x1F;
+            rgb.push_back((r << 3) | (r >> 2));
+            rgb.push_back((g << 2) | (g >> 4));
+            rgb.push_back((b << 3) | (b >> 2));
+        }
+        return rgb;
+    }
+
+    std::string write_ppm(const std::string& name, const std::vector<uint8_t>& rgb) {
+        std::string filename = std::string(QP_RENDER_OUTPUT_DIR) + "/qp_render_" + name + ".ppm";
+        FILE*       fp       = fopen(filename.c_str(), "wb");
+        if (fp) {
+            fprintf(fp, "P6\n%d %d\n255\n", PANEL_WIDTH, PANEL_HEIGHT);
+            fwrite(rgb.data(), 1, rgb.size(), fp);
+            fclose(fp);
+        }
+        return filename;
+    }
+
+    /**
+     * Draws a scene directly to the panel and via the surface, checking both against the golden hash and printing the
+     * throughput and transfer statistics.
+     */
+    void render(const std::string& name, const std::function<void(painter_device_t)>& draw) {
+        using clock = std::chrono::steady_clock;
+
+        // Direct to the panel
+        ASSERT_TRUE(qp_clear(panel));
+        qp_mock_panel_reset_stats(panel);
+        draw(panel);
+        ASSERT_TRUE(qp_flush(panel));
+        qp_mock_panel_stats_t direct      = qp_mock_panel_get_stats(panel);
+        std::vector<uint8_t>  direct_rgb  = panel_rgb888();
+        Fnv32_t               direct_hash = fnv_32a_buf(direct_rgb.data(), direct_rgb.size(), FNV1_32A_INIT);
+        std::string           filename    = write_ppm(name, direct_rgb);
+
+        // Repeat the direct draw for a stable timing measurement
+        std::size_t              iterations = 0;
+        clock::duration          elapsed    = clock::duration::zero();
+        static constexpr auto    min_time   = std::chrono::milliseconds(20);
+        static const std::size_t max_iters  = 1000;
+        while (iterations < max_iters && elapsed < min_time) {
+            auto start = clock::now();
+            draw(panel);
+            elapsed += clock::now() - start;
+            ++iterations;
+        }
+
+        // Via the surface, starting with both it and the panel cleared
+        ASSERT_TRUE(qp_clear(surface));
+        ASSERT_TRUE(qp_flush(surface));
+        ASSERT_TRUE(qp_clear(panel));
+        qp_mock_panel_reset_stats(panel);
+        auto start = clock::now();
+        draw(surface);
+        auto surface_elapsed = clock::now() - start;
+        ASSERT_TRUE(qp_flush(surface));
+        qp_mock_panel_stats_t composited   = qp_mock_panel_get_stats(panel);
+        std::vector<uint8_t>  surface_rgb  = panel_rgb888();
+        Fnv32_t               surface_hash = fnv_32a_buf(surface_rgb.data(), surface_rgb.size(), FNV1_32A_INIT);
+
+        auto golden = golden_hashes.find(name);
+        if (golden == golden_hashes.end()) {
+            ADD_FAILURE() << "No golden hash for " << name << ", rendered 0x" << std::hex << std::setw(8) << std::setfill('0') << direct_hash << " -- see " << filename;
+        } else {
+            EXPECT_EQ(direct_hash, golden->second) << "Rendering of " << name << " changed -- see " << filename;
+        }
+        EXPECT_EQ(surface_hash, direct_hash) << "Compositing " << name << " from a surface differs from drawing it directly";
+
+        double pixels  = direct.pixel_bytes / 2.0;
+        double seconds = std::chrono::duration<double>(elapsed).count() / iterations;
+        RecordProperty(name + "_pixels", std::to_string(direct.pixel_bytes / 2));
+        RecordProperty(name + "_direct_bytes", std::to_string(direct.bytes_sent));
+        RecordProperty(name + "_surface_bytes", std::to_string(composited.bytes_sent));
+        std::cout << std::fixed << std::setprecision(3) << "[ QP RENDER] " << name << ": " << (direct.pixel_bytes / 2) << " px, " << (seconds * 1e6) << "us (" << (pixels / seconds / 1e6) << " Mpx/s); direct " << direct.bytes_sent << " bytes in " << (direct.command_calls + direct.send_calls) << " transfers; surface " << (std::chrono::duration<double>(surface_elapsed).count() * 1e6) << "us, flush " << composited.bytes_sent << " bytes in " << (composited.command_calls + composited.send_calls) << " transfers" << std::endl;
+    }
+};
+
+painter_device_t      QuantumPainterRender::panel   = nullptr;
+painter_device_t      QuantumPainterRender::surface = nullptr;
+std::vector<uint16_t> QuantumPainterRender::framebuffer;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Images, one per format and compression scheme
+
+struct QuantumPainterImageParams {
+    std::string    name;
+    const uint8_t* data;
+
+    static const std::string& GetName(const ::testing::TestParamInfo<QuantumPainterImageParams>& info) {
+        return info.param.name;
+    }
+
+    friend void PrintTo(const QuantumPainterImageParams& params, std::ostream* os) {
+        *os << params.name;
+    }
+};
+
+class QuantumPainterImage : public ::testing::WithParamInterface<QuantumPainterImageParams>, public QuantumPainterRender {};
+
+TEST_P(QuantumPainterImage, Render) {
+    painter_image_handle_t image = qp_load_image_mem(GetParam().data);
+    ASSERT_NE(image, nullptr);
+
+    render("image_" + GetParam().name, [&](painter_device_t device) {
+        EXPECT_TRUE(qp_drawimage(device, 8, 8, image));
+        EXPECT_TRUE(qp_drawimage_recolor(device, 64, 8, image, 43, 255, 255, 0, 0, 0));
+        EXPECT_TRUE(qp_drawimage(device, 120, 40, image));
+    });
+
+    qp_close_image(image);
+}
+
+#define TEST_CARD_PARAMS(format, scheme) QuantumPainterImageParams{#format "_" #scheme, gfx_test_card_##format##_##scheme},
+static const QuantumPainterImageParams test_card_images[] = {TEST_CARD_IMAGES(TEST_CARD_PARAMS)};
+#undef TEST_CARD_PARAMS
+
+INSTANTIATE_TEST_CASE_P(TestCard, QuantumPainterImage, ::testing::ValuesIn(test_card_images), QuantumPainterImageParams::GetName);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Text, one per font
+
+struct QuantumPainterTextParams {
+    std::string    name;
+    const uint8_t* data;
+
+    static const std::string& GetName(const ::testing::TestParamInfo<QuantumPainterTextParams>& info) {
+        return info.param.name;
+    }
+
+    friend void PrintTo(const QuantumPainterTextParams& params, std::ostream* os) {
+        *os << params.name;
+    }
+};
+
+class QuantumPainterText : public ::testing::WithParamInterface<QuantumPainterTextParams>, public QuantumPainterRender {};
+
+TEST_P(QuantumPainterText, Render) {
+    painter_font_handle_t font = qp_load_font_mem(GetParam().data);
+    ASSERT_NE(font, nullptr);
+
+    static const char* lines[] = {"The quick brown fox", "jumps over the lazy dog.", "0123456789 +-*/=%&#@!?"};
+    for (const char* line : lines) {
+        ASSERT_LT(qp_textwidth(font, line), PANEL_WIDTH) << "Text doesn't fit on the panel";
+    }
+    ASSERT_LE(4 * (font->line_height + 1), PANEL_HEIGHT) << "Text doesn't fit on the panel";
+
+    render("text_" + GetParam().name, [&](painter_device_t device) {
+        uint16_t y = 1;
+        for (const char* line : lines) {
+            EXPECT_GT(qp_drawtext(device, 2, y, font, line), 0);
+            y += font->line_height + 1;
+        }
+        EXPECT_GT(qp_drawtext_recolor(device, 2, y, font, "Layer: Base  WPM: 42", 85, 255, 255, 0, 0, 0), 0);
+    });
+
+    qp_close_font(font);
+}
+
+// clang-format off
+INSTANTIATE_TEST_CASE_P(
+    Fonts,
+    QuantumPainterText,
+    ::testing::Values(
+        QuantumPainterTextParams{"thintel15", font_thintel15},
+        QuantumPainterTextParams{"aileron12", font_aileron12},
+        QuantumPainterTextParams{"aileron16", font_aileron16}
+        ),
+    QuantumPainterTextParams::GetName
+    );
+// clang-format on
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Primitives
+
+TEST_F(QuantumPainterRender, Primitives) {
+    render("primitives", [](painter_device_t device) {
+        // Fan of lines at varying slopes
+        for (uint16_t i = 0; i <= 8; ++i) {
+            EXPECT_TRUE(qp_line(device, 40, 48, i * 10, 4, i * 28, 255, 255));
+            EXPECT_TRUE(qp_line(device, 40, 48, i * 10, 92, i * 28, 128, 255));
+        }
+        EXPECT_TRUE(qp_line(device, 0, 48, 80, 48, 0, 0, 255));
+
+        // Outlined and filled rectangles
+        EXPECT_TRUE(qp_rect(device, 88, 4, 130, 44, 0, 255, 255, false));
+        EXPECT_TRUE(qp_rect(device, 92, 8, 126, 40, 85, 255, 255, true));
+        EXPECT_TRUE(qp_rect(device, 88, 52, 130, 92, 21, 255, 255, true));
+
+        // Outlined and filled circles and ellipses
+        EXPECT_TRUE(qp_circle(device, 160, 24, 20, 128, 255, 255, false));
+        EXPECT_TRUE(qp_circle(device, 160, 24, 14, 191, 255, 255, true));
+        EXPECT_TRUE(qp_ellipse(device, 160, 72, 28, 18, 43, 255, 255, false));
+        EXPECT_TRUE(qp_ellipse(device, 160, 72, 20, 10, 234, 255, 255, true));
+
+        // Individual pixels
+        for (uint16_t y = 4; y < 92; y += 2) {
+            for (uint16_t x = 196 + (y % 4); x < 236; x += 4) {
+                EXPECT_TRUE(qp_setpixel(device, x, y, x * 4, 255, 255));
+            }
+        }
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// A typical status display, mixing all of the above
+
+TEST_F(QuantumPainterRender, Dashboard) {
+    painter_image_handle_t logo = qp_load_image_mem(gfx_test_card_pal16_lz);
+    painter_font_handle_t  font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(logo, nullptr);
+    ASSERT_NE(font, nullptr);
+
+    render("dashboard", [&](painter_device_t device) {
+        EXPECT_TRUE(qp_rect(device, 0, 0, PANEL_WIDTH - 1, PANEL_HEIGHT - 1, 170, 255, 64, true));
+        EXPECT_TRUE(qp_drawimage(device, 4, 4, logo));
+        EXPECT_GT(qp_drawtext(device, 60, 4, font, "Layer: Base"), 0);
+        EXPECT_GT(qp_drawtext(device, 60, 4 + font->line_height, font, "WPM: 42"), 0);
+        EXPECT_TRUE(qp_rect(device, 4, 44, 235, 91, 0, 0, 32, true));
+        EXPECT_TRUE(qp_rect(device, 4, 44, 235, 91, 0, 0, 255, false));
+        EXPECT_TRUE(qp_rect(device, 8, 76, 8 + 42 * 2, 86, 85, 255, 255, true));
+        EXPECT_TRUE(qp_circle(device, 220, 60, 8, 0, 255, 255, true));
+        EXPECT_GT(qp_drawtext_recolor(device, 8, 50, font, "CAPS  NUM  SCRL", 0, 0, 255, 0, 0, 32), 0);
+    });
+
+    qp_close_font(font);
+    qp_close_image(logo);
+}
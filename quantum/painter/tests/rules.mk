@@ -0,0 +1,47 @@
+# The test images are test-card.png converted by `qmk painter-convert-graphics` to each format, using -r and/or -z to
+# select the compression scheme, then renamed to test-card-<format>-<raw|rle|lz>. The fonts are converted from their
+# PNGs by `qmk painter-convert-font-image`.
+
+qp_render_DEFS := \
+	-DMATRIX_ROWS=1 \
+	-DMATRIX_COLS=1 \
+	-DNO_DEBUG \
+	-DQUANTUM_PAINTER_ENABLE \
+	-DQUANTUM_PAINTER_RGB565_SURFACE_ENABLE \
+	-DQUANTUM_PAINTER_DISPLAY_TIMEOUT=0 \
+	-DQUANTUM_PAINTER_SUPPORTS_256_PALETTE=1 \
+	-DQUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS=1 \
+	-DQUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION=1 \
+	-DQP_RENDER_OUTPUT_DIR=\"$(BUILD_DIR)/test\"
+
+qp_render_SRC := \
+	$(LIB_PATH)/fnv/qmk_fnv_type_validation.c \
+	$(LIB_PATH)/fnv/hash_32a.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/deferred_exec.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/unicode/utf8.c \
+	$(QUANTUM_PATH)/painter/qp.c \
+	$(QUANTUM_PATH)/painter/qp_comms.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c \
+	$(QUANTUM_PATH)/painter/qgf.c \
+	$(QUANTUM_PATH)/painter/qff.c \
+	$(QUANTUM_PATH)/painter/qp_draw_core.c \
+	$(QUANTUM_PATH)/painter/qp_draw_codec.c \
+	$(QUANTUM_PATH)/painter/qp_draw_circle.c \
+	$(QUANTUM_PATH)/painter/qp_draw_ellipse.c \
+	$(QUANTUM_PATH)/painter/qp_draw_image.c \
+	$(QUANTUM_PATH)/painter/qp_draw_text.c \
+	$(DRIVER_PATH)/painter/generic/qp_rgb565_surface.c \
+	$(DRIVER_PATH)/painter/tft_panel/qp_tft_panel.c \
+	$(QUANTUM_PATH)/painter/tests/qp_mock_panel.c \
+	$(QUANTUM_PATH)/painter/tests/qp_render_tests.cpp \
+	$(wildcard $(QUANTUM_PATH)/painter/tests/graphics/*.c)
+
+qp_render_INC := \
+	$(LIB_PATH)/fnv \
+	$(QUANTUM_PATH)/painter \
+	$(QUANTUM_PATH)/painter/tests \
+	$(QUANTUM_PATH)/unicode \
+	$(DRIVER_PATH)/painter/generic \
+	$(DRIVER_PATH)/painter/tft_panel
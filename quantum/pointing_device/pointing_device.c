@@ -81,6 +81,55 @@ static bool           pointing_device_force_send = false;
 
 extern const pointing_device_driver_t pointing_device_driver;
 
+/**
+ * @brief clamps int32_t to int8_t
+ *
+ * @param[in] int32_t value
+ * @return int8_t clamped value
+ */
+static inline int8_t pointing_device_hv_clamp(int32_t value) {
+    if (value < INT8_MIN) {
+        return INT8_MIN;
+    } else if (value > INT8_MAX) {
+        return INT8_MAX;
+    } else {
+        return value;
+    }
+}
+
+/**
+ * @brief clamps int32_t to mouse_xy_report_t
+ *
+ * @param[in] int32_t value
+ * @return mouse_xy_report_t clamped value
+ */
+static inline mouse_xy_report_t pointing_device_xy_clamp(int32_t value) {
+    if (value < XY_REPORT_MIN) {
+        return XY_REPORT_MIN;
+    } else if (value > XY_REPORT_MAX) {
+        return XY_REPORT_MAX;
+    } else {
+        return value;
+    }
+}
+
+/**
+ * @brief adds movement to an accumulated total, saturating instead of overflowing
+ *
+ * @param[in] total int32_t accumulated movement
+ * @param[in] delta int32_t movement to add
+ * @return int32_t new total
+ */
+static inline int32_t pointing_device_accumulate(int32_t total, int32_t delta) {
+    if (delta > 0 && total > INT32_MAX - delta) {
+        return INT32_MAX;
+    } else if (delta < 0 && total < INT32_MIN - delta) {
+        return INT32_MIN;
+    } else {
+        return total + delta;
+    }
+}
+
 /**
  * @brief Keyboard level code pointing device initialisation
  *
@@ -165,13 +214,38 @@ __attribute__((weak)) void pointing_device_init(void) {
  *
  * This sends the mouse report generated by pointing_device_task if changed since the last report. Once send zeros mouse report except buttons.
  *
+ * While the host hasn't collected the previous report yet, movement is added up and sent as one report once it has, so
+ * the task never has to wait for the endpoint. Button changes are sent straight away. Movement beyond what fits in a
+ * single report is carried over to the next one.
+ *
  */
 __attribute__((weak)) bool pointing_device_send(void) {
     static report_mouse_t old_report         = {};
-    bool                  should_send_report = has_mouse_report_changed(&local_mouse_report, &old_report);
-
-    if (should_send_report) {
-        host_mouse_send(&local_mouse_report);
+    static int32_t        pending_x          = 0;
+    static int32_t        pending_y          = 0;
+    static int32_t        pending_v          = 0;
+    static int32_t        pending_h          = 0;
+    bool                  should_send_report = false;
+
+    pending_x = pointing_device_accumulate(pending_x, local_mouse_report.x);
+    pending_y = pointing_device_accumulate(pending_y, local_mouse_report.y);
+    pending_v = pointing_device_accumulate(pending_v, local_mouse_report.v);
+    pending_h = pointing_device_accumulate(pending_h, local_mouse_report.h);
+
+    if (local_mouse_report.buttons != old_report.buttons || host_mouse_ready()) {
+        local_mouse_report.x = pointing_device_xy_clamp(pending_x);
+        local_mouse_report.y = pointing_device_xy_clamp(pending_y);
+        local_mouse_report.v = pointing_device_hv_clamp(pending_v);
+        local_mouse_report.h = pointing_device_hv_clamp(pending_h);
+        pending_x -= local_mouse_report.x;
+        pending_y -= local_mouse_report.y;
+        pending_v -= local_mouse_report.v;
+        pending_h -= local_mouse_report.h;
+
+        should_send_report = has_mouse_report_changed(&local_mouse_report, &old_report);
+        if (should_send_report) {
+            host_mouse_send(&local_mouse_report);
+        }
     }
     // send it and 0 it out except for buttons, so those stay until they are explicity over-ridden using update_pointing_device
     uint8_t buttons = local_mouse_report.buttons;
@@ -371,37 +445,6 @@ void pointing_device_set_cpi_on_side(bool left, uint16_t cpi) {
     }
 }
 
-/**
- * @brief clamps int16_t to int8_t
- *
- * @param[in] int16_t value
- * @return int8_t clamped value
- */
-static inline int8_t pointing_device_hv_clamp(int16_t value) {
-    if (value < INT8_MIN) {
-        return INT8_MIN;
-    } else if (value > INT8_MAX) {
-        return INT8_MAX;
-    } else {
-        return value;
-    }
-}
-
-/**
- * @brief clamps int16_t to int8_t
- *
- * @param[in] clamp_range_t value
- * @return mouse_xy_report_t clamped value
- */
-static inline mouse_xy_report_t pointing_device_xy_clamp(clamp_range_t value) {
-    if (value < XY_REPORT_MIN) {
-        return XY_REPORT_MIN;
-    } else if (value > XY_REPORT_MAX) {
-        return XY_REPORT_MAX;
-    } else {
-        return value;
-    }
-}
 /**
  * @brief combines 2 mouse reports and returns 2
  *
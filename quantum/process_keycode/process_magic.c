@@ -46,8 +46,6 @@ bool process_magic(uint16_t keycode, keyrecord_t *record) {
     // skip anything that isn't a keyup
     if (record->event.pressed) {
         if (IS_MAGIC_KEYCODE(keycode)) {
-            /* keymap config */
-            keymap_config.raw = eeconfig_read_keymap();
             switch (keycode) {
                 case QK_MAGIC_SWAP_CONTROL_CAPS_LOCK:
                     keymap_config.swap_control_capslock = true;
@@ -187,7 +185,7 @@ bool process_magic(uint16_t keycode, keyrecord_t *record) {
                     break;
             }
 
-            eeconfig_update_keymap(keymap_config.raw);
+            eeconfig_flag_keymap(true);
             clear_keyboard(); // clear to prevent stuck keys
 
             return false;
@@ -147,6 +147,9 @@ extern layer_state_t layer_state;
 
 #ifdef SEND_STRING_ENABLE
 #    include "send_string.h"
+#    ifdef SEND_STRING_ASYNC_ENABLE
+#        include "send_string_async.h"
+#    endif
 #endif
 
 #ifdef HAPTIC_ENABLE
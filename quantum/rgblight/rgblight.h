@@ -375,6 +375,8 @@ void     eeconfig_update_rgblight(uint64_t val);
 void     eeconfig_update_rgblight_current(void);
 void     eeconfig_update_rgblight_default(void);
 void     eeconfig_debug_rgblight(void);
+void     eeconfig_flag_rgblight(bool v);
+void     eeconfig_flush_rgblight(bool force);
 
 void rgb_matrix_increase(void);
 void rgb_matrix_decrease(void);
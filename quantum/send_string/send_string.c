@@ -22,8 +22,20 @@
 #include "quantum_keycodes.h"
 #include "keycode.h"
 #include "action.h"
+#include "host.h"
 #include "wait.h"
 
+#ifdef SENDSTRING_COALESCE
+#    include "action_util.h"
+#    include "keycodes.h"
+#    ifdef NKRO_ENABLE
+#        include "keycode_config.h"
+#    endif
+#    ifndef SENDSTRING_COALESCE_MAX_KEYS
+#        define SENDSTRING_COALESCE_MAX_KEYS KEYBOARD_REPORT_KEYS
+#    endif
+#endif
+
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
 #    ifndef BELL_SOUND
@@ -146,6 +158,116 @@ __attribute__((weak)) const uint8_t ascii_to_keycode_lut[128] PROGMEM = {
 // Note: we bit-pack in "reverse" order to optimize loading
 #define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
 
+// Reports are generated faster than the host collects them, so each one waits for room rather than being collapsed
+// into a report still waiting to go out
+static void send_string_register(uint8_t keycode) {
+    host_keyboard_wait_ready();
+    register_code(keycode);
+}
+
+static void send_string_unregister(uint8_t keycode) {
+    host_keyboard_wait_ready();
+    unregister_code(keycode);
+}
+
+#ifdef SENDSTRING_COALESCE
+static uint8_t read_ram_byte(const char *string) {
+    return *string;
+}
+
+static bool send_string_report_is_nkro(void) {
+#    ifdef NKRO_ENABLE
+    return keyboard_protocol && keymap_config.nkro;
+#    else
+    return false;
+#    endif
+}
+
+static bool can_coalesce_keycode(uint8_t keycode) {
+    // Anything register_code() treats specially has to go through send_char()
+    return IS_BASIC_KEYCODE(keycode) && keycode != KC_CAPS_LOCK && !(keycode >= KC_LOCKING_CAPS_LOCK && keycode <= KC_LOCKING_SCROLL_LOCK);
+}
+
+/** \brief Type out a run of plain characters, pressing as many of them as possible in the same report.
+ *
+ * Characters are grouped as long as they need the same modifiers, are not dead keys, and do not repeat a key
+ * already in the group. Hosts process an NKRO bitmap in usage order, so there keycodes must also be ascending;
+ * the 6KRO key array is filled in order so it preserves the typing order by itself.
+ *
+ * \return Pointer to the first character that has not been typed.
+ */
+static const char *send_char_run(const char *string, uint8_t (*read)(const char *)) {
+    uint8_t keys[SENDSTRING_COALESCE_MAX_KEYS];
+    uint8_t count = 0;
+    uint8_t mods  = 0;
+    bool    nkro  = send_string_report_is_nkro();
+    uint8_t limit = SENDSTRING_COALESCE_MAX_KEYS;
+
+    if (!nkro) {
+        uint8_t free_slots = KEYBOARD_REPORT_KEYS - has_anykey(keyboard_report);
+        if (free_slots < limit) {
+            limit = free_slots;
+        }
+    }
+
+    while (count < limit) {
+        uint8_t ascii_code = read(string);
+        if (!ascii_code || ascii_code == SS_QMK_PREFIX || ascii_code > 0x7F) break;
+
+        uint8_t keycode   = pgm_read_byte(&ascii_to_keycode_lut[ascii_code]);
+        uint8_t char_mods = (PGM_LOADBIT(ascii_to_shift_lut, ascii_code) ? MOD_BIT(KC_LEFT_SHIFT) : 0) | (PGM_LOADBIT(ascii_to_altgr_lut, ascii_code) ? MOD_BIT(KC_RIGHT_ALT) : 0);
+        if (!can_coalesce_keycode(keycode) || PGM_LOADBIT(ascii_to_dead_lut, ascii_code) || is_key_pressed(keyboard_report, keycode)) break;
+
+        if (count > 0) {
+            if (char_mods != mods) break;
+            if (nkro && keycode <= keys[count - 1]) break;
+
+            bool repeated = false;
+            for (uint8_t i = 0; i < count; i++) {
+                if (keys[i] == keycode) {
+                    repeated = true;
+                    break;
+                }
+            }
+            if (repeated) break;
+        }
+
+        mods          = char_mods;
+        keys[count++] = keycode;
+        ++string;
+    }
+
+    if (!count) {
+        send_char(read(string));
+        return string + 1;
+    }
+
+    if (mods) {
+        host_keyboard_wait_ready();
+        register_mods(mods);
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        add_key(keys[i]);
+    }
+    host_keyboard_wait_ready();
+    send_keyboard_report();
+    for (uint16_t i = TAP_CODE_DELAY; i > 0; i--) {
+        wait_ms(1);
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        del_key(keys[i]);
+    }
+    host_keyboard_wait_ready();
+    send_keyboard_report();
+    if (mods) {
+        host_keyboard_wait_ready();
+        unregister_mods(mods);
+    }
+
+    return string;
+}
+#endif
+
 void send_string(const char *string) {
     send_string_with_delay(string, 0);
 }
@@ -163,11 +285,11 @@ void send_string_with_delay(const char *string, uint8_t interval) {
             } else if (ascii_code == SS_DOWN_CODE) {
                 // down
                 uint8_t keycode = *(++string);
-                register_code(keycode);
+                send_string_register(keycode);
             } else if (ascii_code == SS_UP_CODE) {
                 // up
                 uint8_t keycode = *(++string);
-                unregister_code(keycode);
+                send_string_unregister(keycode);
             } else if (ascii_code == SS_DELAY_CODE) {
                 // delay
                 int     ms      = 0;
@@ -181,6 +303,12 @@ void send_string_with_delay(const char *string, uint8_t interval) {
                     wait_ms(1);
             }
         } else {
+#ifdef SENDSTRING_COALESCE
+            if (!interval) {
+                string = send_char_run(string, read_ram_byte);
+                continue;
+            }
+#endif
             send_char(ascii_code);
         }
         ++string;
@@ -207,17 +335,17 @@ void send_char(char ascii_code) {
     bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
 
     if (is_shifted) {
-        register_code(KC_LEFT_SHIFT);
+        send_string_register(KC_LEFT_SHIFT);
     }
     if (is_altgred) {
-        register_code(KC_RIGHT_ALT);
+        send_string_register(KC_RIGHT_ALT);
     }
     tap_code(keycode);
     if (is_altgred) {
-        unregister_code(KC_RIGHT_ALT);
+        send_string_unregister(KC_RIGHT_ALT);
     }
     if (is_shifted) {
-        unregister_code(KC_LEFT_SHIFT);
+        send_string_unregister(KC_LEFT_SHIFT);
     }
     if (is_dead) {
         tap_code(KC_SPACE);
@@ -279,6 +407,12 @@ void tap_random_base64(void) {
 }
 
 #if defined(__AVR__)
+#    ifdef SENDSTRING_COALESCE
+static uint8_t read_progmem_byte(const char *string) {
+    return pgm_read_byte(string);
+}
+#    endif
+
 void send_string_P(const char *string) {
     send_string_with_delay_P(string, 0);
 }
@@ -296,11 +430,11 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
             } else if (ascii_code == SS_DOWN_CODE) {
                 // down
                 uint8_t keycode = pgm_read_byte(++string);
-                register_code(keycode);
+                send_string_register(keycode);
             } else if (ascii_code == SS_UP_CODE) {
                 // up
                 uint8_t keycode = pgm_read_byte(++string);
-                unregister_code(keycode);
+                send_string_unregister(keycode);
             } else if (ascii_code == SS_DELAY_CODE) {
                 // delay
                 int     ms      = 0;
@@ -314,6 +448,12 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
                     wait_ms(1);
             }
         } else {
+#    ifdef SENDSTRING_COALESCE
+            if (!interval) {
+                string = send_char_run(string, read_progmem_byte);
+                continue;
+            }
+#    endif
             send_char(ascii_code);
         }
         ++string;
@@ -0,0 +1,411 @@
+/* Copyright 2023
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "send_string_async.h"
+
+#include <ctype.h>
+
+#include "send_string.h"
+#include "keycode.h"
+#include "action.h"
+#include "host.h"
+#include "timer.h"
+#include "wait.h"
+
+#ifdef UNICODE_COMMON_ENABLE
+#    include "unicode.h"
+#    include "utf8.h"
+#endif
+
+#if SEND_STRING_ASYNC_QUEUE_SIZE > 255
+#    error SEND_STRING_ASYNC_QUEUE_SIZE must be less than 256
+#endif
+
+// Note: we bit-pack in "reverse" order to optimize loading
+#define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
+
+// Queued events, as parsed from the string
+enum {
+    SS_ASYNC_CHAR,           // arg: ASCII character
+    SS_ASYNC_TAP,            // arg: keycode
+    SS_ASYNC_DOWN,           // arg: keycode
+    SS_ASYNC_UP,             // arg: keycode
+    SS_ASYNC_DELAY,          // arg: milliseconds
+    SS_ASYNC_DELAY_X256,     // arg: milliseconds / 256, always followed by SS_ASYNC_DELAY
+    SS_ASYNC_INTERVAL,       // arg: new interval between characters
+#ifdef UNICODE_COMMON_ENABLE
+    SS_ASYNC_UNICODE_X65536, // arg: code point / 65536, always followed by SS_ASYNC_UNICODE_X256
+    SS_ASYNC_UNICODE_X256,   // arg: (code point / 256) % 256, always followed by SS_ASYNC_UNICODE
+    SS_ASYNC_UNICODE,        // arg: code point % 256
+#endif
+};
+
+// Steps a queued event is expanded into when it is played back
+enum {
+    SS_STEP_REGISTER,
+    SS_STEP_UNREGISTER,
+    SS_STEP_WAIT,
+#if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    SS_STEP_BELL,
+#endif
+#ifdef UNICODE_COMMON_ENABLE
+    SS_STEP_UNICODE,
+#endif
+};
+
+typedef struct {
+    uint8_t op;
+    uint8_t arg;
+} ss_async_event_t;
+
+typedef struct {
+    uint8_t  type;
+    uint16_t arg;
+} ss_async_step_t;
+
+// Worst case is a shifted, AltGr'd dead key followed by the interval:
+// 3 downs, 3 ups and 1 tap delay, 3 for the trailing space, and 1 interval.
+#define SS_ASYNC_MAX_STEPS 11
+
+static ss_async_event_t queue[SEND_STRING_ASYNC_QUEUE_SIZE];
+static uint8_t          queue_head = 0;
+static uint8_t          queue_tail = 0;
+
+static ss_async_step_t steps[SS_ASYNC_MAX_STEPS];
+static uint8_t         step_count = 0;
+static uint8_t         step_index = 0;
+
+static uint8_t  current_interval = 0;
+static bool     waiting          = false;
+static uint32_t wait_timer       = 0;
+static uint16_t wait_duration    = 0;
+
+#ifdef UNICODE_COMMON_ENABLE
+static uint32_t unicode_code_point = 0;
+#endif
+
+static inline uint8_t queue_next(uint8_t index) {
+    return (index + 1) % SEND_STRING_ASYNC_QUEUE_SIZE;
+}
+
+static bool queue_push(uint8_t op, uint8_t arg) {
+    uint8_t next = queue_next(queue_head);
+    if (next == queue_tail) {
+        return false;
+    }
+    queue[queue_head] = (ss_async_event_t){.op = op, .arg = arg};
+    queue_head        = next;
+    return true;
+}
+
+static bool queue_pop(ss_async_event_t *event) {
+    if (queue_head == queue_tail) {
+        return false;
+    }
+    *event     = queue[queue_tail];
+    queue_tail = queue_next(queue_tail);
+    return true;
+}
+
+static uint8_t read_ram(const char *string) {
+    return *string;
+}
+
+bool send_string_async(const char *string) {
+    return send_string_async_with_delay(string, 0);
+}
+
+bool send_string_async_with_delay(const char *string, uint8_t interval) {
+    return send_string_async_with_reader(string, interval, read_ram);
+}
+
+#if defined(__AVR__)
+static uint8_t read_progmem(const char *string) {
+    return pgm_read_byte(string);
+}
+
+bool send_string_async_with_delay_P(const char *string, uint8_t interval) {
+    return send_string_async_with_reader(string, interval, read_progmem);
+}
+#endif
+
+/**
+ * \brief Read the rest of a UTF-8 sequence.
+ *
+ * \param lead The first byte of the sequence, already read from `string`.
+ *
+ * \return A pointer to the last byte of the sequence, or `NULL` if the string ended first.
+ */
+static const char *read_utf8(uint8_t lead, const char *string, send_string_async_read_t read, int32_t *code_point) {
+    char    utf8[5] = {lead};
+    uint8_t length  = lead >= 0xF0 ? 4 : (lead >= 0xE0 ? 3 : 2);
+    for (uint8_t i = 1; i < length; i++) {
+        utf8[i] = read(++string);
+        if (!utf8[i]) return NULL;
+    }
+#ifdef UNICODE_COMMON_ENABLE
+    decode_utf8(utf8, code_point);
+#else
+    *code_point = -1;
+#endif
+    return string;
+}
+
+bool send_string_async_with_reader(const char *string, uint8_t interval, send_string_async_read_t read) {
+    // Remember where we started, so a string that does not fit can be dropped as a whole
+    uint8_t start = queue_head;
+    bool    ok    = queue_push(SS_ASYNC_INTERVAL, interval);
+
+    while (ok) {
+        uint8_t ascii_code = read(string);
+        if (!ascii_code) break;
+        if (ascii_code == SS_QMK_PREFIX) {
+            ascii_code = read(++string);
+            if (ascii_code == SS_TAP_CODE || ascii_code == SS_DOWN_CODE || ascii_code == SS_UP_CODE) {
+                uint8_t keycode = read(++string);
+                if (!keycode) break;
+                uint8_t op = ascii_code == SS_TAP_CODE ? SS_ASYNC_TAP : (ascii_code == SS_DOWN_CODE ? SS_ASYNC_DOWN : SS_ASYNC_UP);
+                ok         = queue_push(op, keycode);
+            } else if (ascii_code == SS_DELAY_CODE) {
+                uint16_t ms      = 0;
+                uint8_t  keycode = read(++string);
+                while (isdigit(keycode)) {
+                    ms *= 10;
+                    ms += keycode - '0';
+                    keycode = read(++string);
+                }
+                if (ms > 0xFF) {
+                    ok = queue_push(SS_ASYNC_DELAY_X256, ms >> 8);
+                }
+                ok = ok && queue_push(SS_ASYNC_DELAY, ms & 0xFF);
+                if (!keycode) break;
+            } else if (!ascii_code) {
+                break;
+            }
+        } else if (ascii_code >= 0xC0) {
+            // UTF-8 is typed using the Unicode input mode, or left out without Unicode support
+            int32_t code_point;
+            string = read_utf8(ascii_code, string, read, &code_point);
+            if (!string) break;
+#ifdef UNICODE_COMMON_ENABLE
+            if (code_point >= 0) {
+                ok = queue_push(SS_ASYNC_UNICODE_X65536, code_point >> 16) && queue_push(SS_ASYNC_UNICODE_X256, (code_point >> 8) & 0xFF) && queue_push(SS_ASYNC_UNICODE, code_point & 0xFF);
+            }
+#endif
+        } else {
+            ok = queue_push(SS_ASYNC_CHAR, ascii_code);
+        }
+        ++string;
+    }
+
+    if (!ok) {
+        queue_head = start;
+    }
+    return ok;
+}
+
+bool send_string_async_is_busy(void) {
+    return queue_head != queue_tail || step_index < step_count || waiting;
+}
+
+void send_string_async_flush(void) {
+    while (true) {
+        send_string_async_task();
+        if (!send_string_async_is_busy()) {
+            return;
+        }
+        // Waiting on a delay or on the host, there is nothing else to do
+        wait_ms(1);
+    }
+}
+
+void send_string_async_cancel(void) {
+    // Release anything still held by the event being played back
+    for (; step_index < step_count; ++step_index) {
+        if (steps[step_index].type == SS_STEP_UNREGISTER) {
+            unregister_code(steps[step_index].arg);
+        }
+    }
+
+    // ...and anything that was going to be released later on
+    ss_async_event_t event;
+    while (queue_pop(&event)) {
+        if (event.op == SS_ASYNC_UP) {
+            unregister_code(event.arg);
+        }
+    }
+
+    step_count = step_index = 0;
+    waiting                 = false;
+}
+
+static inline void add_step(uint8_t type, uint16_t arg) {
+    steps[step_count++] = (ss_async_step_t){.type = type, .arg = arg};
+}
+
+static void add_tap_steps(uint8_t keycode) {
+    uint16_t delay = keycode == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY;
+    add_step(SS_STEP_REGISTER, keycode);
+    if (delay) {
+        add_step(SS_STEP_WAIT, delay);
+    }
+    add_step(SS_STEP_UNREGISTER, keycode);
+}
+
+static void add_char_steps(uint8_t ascii_code) {
+#if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') { // BEL
+        add_step(SS_STEP_BELL, 0);
+        return;
+    }
+#endif
+
+    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[ascii_code & 0x7F]);
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, ascii_code & 0x7F);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, ascii_code & 0x7F);
+    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, ascii_code & 0x7F);
+
+    if (is_shifted) {
+        add_step(SS_STEP_REGISTER, KC_LEFT_SHIFT);
+    }
+    if (is_altgred) {
+        add_step(SS_STEP_REGISTER, KC_RIGHT_ALT);
+    }
+    add_tap_steps(keycode);
+    if (is_altgred) {
+        add_step(SS_STEP_UNREGISTER, KC_RIGHT_ALT);
+    }
+    if (is_shifted) {
+        add_step(SS_STEP_UNREGISTER, KC_LEFT_SHIFT);
+    }
+    if (is_dead) {
+        add_tap_steps(KC_SPACE);
+    }
+}
+
+/**
+ * \brief Expand the next queued event into the steps needed to play it back.
+ *
+ * \return `false` if the queue is empty.
+ */
+static bool load_next_event(void) {
+    ss_async_event_t event;
+
+    step_count = step_index = 0;
+    if (!queue_pop(&event)) {
+        return false;
+    }
+
+    switch (event.op) {
+        case SS_ASYNC_INTERVAL:
+            current_interval = event.arg;
+            return true;
+        case SS_ASYNC_DELAY_X256:
+            add_step(SS_STEP_WAIT, (uint16_t)event.arg << 8);
+            return true;
+        case SS_ASYNC_CHAR:
+            add_char_steps(event.arg);
+            break;
+        case SS_ASYNC_TAP:
+            add_tap_steps(event.arg);
+            break;
+        case SS_ASYNC_DOWN:
+            add_step(SS_STEP_REGISTER, event.arg);
+            break;
+        case SS_ASYNC_UP:
+            add_step(SS_STEP_UNREGISTER, event.arg);
+            break;
+        case SS_ASYNC_DELAY:
+            if (event.arg) {
+                add_step(SS_STEP_WAIT, event.arg);
+            }
+            break;
+#ifdef UNICODE_COMMON_ENABLE
+        case SS_ASYNC_UNICODE_X65536:
+            unicode_code_point = (uint32_t)event.arg << 16;
+            return true;
+        case SS_ASYNC_UNICODE_X256:
+            unicode_code_point |= (uint32_t)event.arg << 8;
+            return true;
+        case SS_ASYNC_UNICODE:
+            unicode_code_point |= event.arg;
+            add_step(SS_STEP_UNICODE, 0);
+            break;
+#endif
+    }
+
+    if (current_interval) {
+        add_step(SS_STEP_WAIT, current_interval);
+    }
+    return true;
+}
+
+void send_string_async_task(void) {
+    while (true) {
+        if (waiting) {
+            if (timer_elapsed32(wait_timer) < wait_duration) {
+                return;
+            }
+            waiting = false;
+        }
+
+        if (step_index >= step_count) {
+            if (!load_next_event()) {
+                return;
+            }
+            continue;
+        }
+
+        ss_async_step_t *step = &steps[step_index];
+        if (step->type == SS_STEP_WAIT) {
+            wait_timer    = timer_read32();
+            wait_duration = step->arg;
+            waiting       = true;
+            ++step_index;
+            continue;
+        }
+
+        // Hold off until the previous report has been picked up by the host
+        if (!host_keyboard_ready()) {
+            return;
+        }
+
+        switch (step->type) {
+            case SS_STEP_REGISTER:
+                register_code(step->arg);
+                break;
+            case SS_STEP_UNREGISTER:
+                unregister_code(step->arg);
+                break;
+#if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+            case SS_STEP_BELL:
+                // Plays the bell sound, no report is sent
+                send_char('\a');
+                break;
+#endif
+#ifdef UNICODE_COMMON_ENABLE
+            case SS_STEP_UNICODE:
+                // The whole input sequence is typed in one go, as it depends on the input mode
+                register_unicode(unicode_code_point);
+                break;
+#endif
+        }
+        ++step_index;
+
+        // At most one report per pass through the main loop
+        return;
+    }
+}
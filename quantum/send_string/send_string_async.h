@@ -0,0 +1,138 @@
+/* Copyright 2023
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * \file
+ *
+ * \defgroup send_string_async Asynchronous Send String API
+ *
+ * \brief These functions queue strings to be typed out from the main loop, rather than blocking until they have been sent.
+ * \{
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "progmem.h"
+#include "send_string_keycodes.h"
+
+#ifndef SEND_STRING_ASYNC_QUEUE_SIZE
+#    define SEND_STRING_ASYNC_QUEUE_SIZE 64
+#endif
+
+/**
+ * \brief Function used to fetch the next byte of a string being queued.
+ *
+ * Each byte is read once, in order, so the reader may keep its own position instead of using `string`.
+ *
+ * \param string Pointer to the byte to read, in whatever address space the string lives in.
+ *
+ * \return The byte at `string`.
+ */
+typedef uint8_t (*send_string_async_read_t)(const char *string);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out.
+ *
+ * This function simply calls `send_string_async_with_delay(string, 0)`.
+ *
+ * \param string The string to type out.
+ *
+ * \return `true` if the whole string was queued, `false` if the queue did not have enough room (nothing is queued in that case).
+ */
+bool send_string_async(const char *string);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out, with a delay between each character.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ *
+ * \return `true` if the whole string was queued, `false` if the queue did not have enough room (nothing is queued in that case).
+ */
+bool send_string_async_with_delay(const char *string, uint8_t interval);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out, reading it through the supplied function.
+ *
+ * This allows strings stored outside of RAM (eg. in EEPROM) to be queued without copying them first.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ * \param read The function used to read each byte of `string`.
+ *
+ * \return `true` if the whole string was queued, `false` if the queue did not have enough room (nothing is queued in that case).
+ */
+bool send_string_async_with_reader(const char *string, uint8_t interval, send_string_async_read_t read);
+
+#if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out, with a delay between each character.
+ *
+ * On ARM devices, this function is simply an alias for send_string_async_with_delay(string, interval).
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ *
+ * \return `true` if the whole string was queued, `false` if the queue did not have enough room (nothing is queued in that case).
+ */
+bool send_string_async_with_delay_P(const char *string, uint8_t interval);
+#else
+#    define send_string_async_with_delay_P(string, interval) send_string_async_with_delay(string, interval)
+#endif
+
+/**
+ * \brief Shortcut macro for send_string_async_with_delay_P(PSTR(string), 0).
+ */
+#define SEND_STRING_ASYNC(string) send_string_async_with_delay_P(PSTR(string), 0)
+
+/**
+ * \brief Shortcut macro for send_string_async_with_delay_P(PSTR(string), interval).
+ */
+#define SEND_STRING_ASYNC_DELAY(string, interval) send_string_async_with_delay_P(PSTR(string), interval)
+
+/**
+ * \brief Check whether there are queued events that have not been sent yet.
+ *
+ * \return `true` if a string is currently being typed out.
+ */
+bool send_string_async_is_busy(void);
+
+/**
+ * \brief Discard everything left in the queue.
+ *
+ * Any key released later in the queue is released immediately, so that keys are not left stuck down.
+ */
+void send_string_async_cancel(void);
+
+/**
+ * \brief Type out everything left in the queue before returning.
+ *
+ * Blocks like send_string() does. Useful for falling back to synchronous sending without reordering anything that
+ * was already queued.
+ */
+void send_string_async_flush(void);
+
+/**
+ * \brief Emit the next queued event, if it is due and the host is ready to accept it.
+ *
+ * Called from the main loop.
+ */
+void send_string_async_task(void);
+
+/** \} */
@@ -399,7 +399,11 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
             break;
         }
         case id_dynamic_keymap_macro_get_buffer_size: {
-            uint16_t size   = dynamic_keymap_macro_get_buffer_size();
+#ifdef DYNAMIC_KEYMAP_MACRO_BYTECODE
+            uint16_t size = dynamic_keymap_macro_get_text_buffer_size();
+#else
+            uint16_t size = dynamic_keymap_macro_get_buffer_size();
+#endif
             command_data[0] = size >> 8;
             command_data[1] = size & 0xFF;
             break;
@@ -407,13 +411,24 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
         case id_dynamic_keymap_macro_get_buffer: {
             uint16_t offset = (command_data[0] << 8) | command_data[1];
             uint16_t size   = command_data[2]; // size <= 28
+#ifdef DYNAMIC_KEYMAP_MACRO_BYTECODE
+            dynamic_keymap_macro_get_text_buffer(offset, size, &command_data[3]);
+#else
             dynamic_keymap_macro_get_buffer(offset, size, &command_data[3]);
+#endif
             break;
         }
         case id_dynamic_keymap_macro_set_buffer: {
             uint16_t offset = (command_data[0] << 8) | command_data[1];
             uint16_t size   = command_data[2]; // size <= 28
+#ifdef DYNAMIC_KEYMAP_MACRO_BYTECODE
+            // Converted to bytecode as it is written, fails if it doesn't fit or isn't written in order
+            if (!dynamic_keymap_macro_set_text_buffer(offset, size, &command_data[3])) {
+                *command_id = id_unhandled;
+            }
+#else
             dynamic_keymap_macro_set_buffer(offset, size, &command_data[3]);
+#endif
             break;
         }
         case id_dynamic_keymap_macro_reset: {
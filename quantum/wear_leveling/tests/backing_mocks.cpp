@@ -24,6 +24,9 @@ void MockBackingStore::reset_instance() {
     backing_write_invoke_count  = 0;
     backing_lock_invoke_count   = 0;
 
+    backing_read_invoke_count      = 0;
+    backing_read_bulk_invoke_count = 0;
+
     init_success_callback   = [](std::uint64_t) { return true; };
     erase_success_callback  = [](std::uint64_t) { return true; };
     unlock_success_callback = [](std::uint64_t) { return true; };
@@ -31,6 +34,22 @@ void MockBackingStore::reset_instance() {
     lock_success_callback   = [](std::uint64_t) { return true; };
 
     write_log.clear();
+
+    set_timing(MockBackingStoreTiming{});
+}
+
+void MockBackingStore::set_timing(const MockBackingStoreTiming& t) {
+    EXPECT_TRUE(t.sector_size > 0 && t.sector_size % BACKING_STORE_WRITE_SIZE == 0) << "Sector size must be a multiple of the backing store integral size";
+    timing             = t;
+    backing_elapsed_ns = 0;
+    sector_erasures.assign((WEAR_LEVELING_BACKING_SIZE + timing.sector_size - 1) / timing.sector_size, 0);
+}
+
+void MockBackingStore::erase_sectors(std::uint32_t address, std::size_t length) {
+    for (std::size_t i = address / timing.sector_size; i < sector_erasures.size() && i * timing.sector_size < address + length; ++i) {
+        ++sector_erasures[i];
+        backing_elapsed_ns += timing.erase_ns;
+    }
 }
 
 bool MockBackingStore::init(void) {
@@ -70,6 +89,36 @@ bool MockBackingStore::erase(void) {
 
     // Keep track of the erase in the write log so that we can verify during tests
     append_log(true);
+    erase_sectors(0, WEAR_LEVELING_BACKING_SIZE);
+
+    ++backing_erasure_count;
+    return true;
+}
+
+bool MockBackingStore::erase_range(uint32_t address, std::size_t length) {
+    ++backing_erase_invoke_count;
+
+    EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
+    EXPECT_TRUE(address + length <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
+#ifdef BACKING_STORE_ERASE_SIZE
+    EXPECT_TRUE(address % BACKING_STORE_ERASE_SIZE == 0 && length % BACKING_STORE_ERASE_SIZE == 0) << "Erased range was not aligned with the backing store erase size";
+#endif
+    EXPECT_FALSE(is_locked()) << "Erase was attempted without being unlocked first";
+
+    // Drop out of erase early with failure if we need to
+    if (erase_success_callback && !erase_success_callback(backing_erase_invoke_count)) {
+        append_log(address, length, true);
+        return false;
+    }
+
+    // Erase each slot in the range
+    for (std::size_t i = address / BACKING_STORE_WRITE_SIZE; i < (address + length) / BACKING_STORE_WRITE_SIZE; ++i) {
+        backing_storage[i].erase();
+    }
+
+    // Keep track of the erase in the write log so that we can verify during tests
+    append_log(address, length, true);
+    erase_sectors(address, length);
 
     ++backing_erasure_count;
     return true;
@@ -97,6 +146,7 @@ bool MockBackingStore::write(uint32_t address, backing_store_int_t value) {
 
     // Keep track of the total number of writes into the backing store
     ++backing_total_write_count;
+    backing_elapsed_ns += timing.write_ns;
 
     return true;
 }
@@ -114,6 +164,8 @@ bool MockBackingStore::lock(void) {
 }
 
 bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const {
+    ++backing_read_invoke_count;
+
     // precondition: value's buffer size already matches BACKING_STORE_WRITE_SIZE
     EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
     EXPECT_TRUE(address + BACKING_STORE_WRITE_SIZE <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
@@ -121,6 +173,23 @@ bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const
     // Read and take the complement as we're simulating flash memory -- 0xFF means 0x00
     std::size_t index = address / BACKING_STORE_WRITE_SIZE;
     value             = ~backing_storage[index].get();
+    backing_elapsed_ns += timing.read_ns;
+
+    return true;
+}
+
+bool MockBackingStore::read_bulk(uint32_t address, backing_store_int_t* values, std::size_t item_count) const {
+    ++backing_read_bulk_invoke_count;
+
+    EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
+    EXPECT_TRUE(address + item_count * BACKING_STORE_WRITE_SIZE <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
+
+    // Read and take the complement as we're simulating flash memory -- 0xFF means 0x00
+    std::size_t index = address / BACKING_STORE_WRITE_SIZE;
+    for (std::size_t i = 0; i < item_count; ++i) {
+        values[i] = ~backing_storage[index + i].get();
+    }
+    backing_elapsed_ns += timing.read_ns * item_count;
 
     return true;
 }
@@ -141,6 +210,12 @@ extern "C" bool backing_store_erase(void) {
     return MockBackingStore::Instance().erase();
 }
 
+#ifdef WEAR_LEVELING_DUAL_BANK
+extern "C" bool backing_store_erase_range(uint32_t address, size_t length) {
+    return MockBackingStore::Instance().erase_range(address, length);
+}
+#endif // WEAR_LEVELING_DUAL_BANK
+
 extern "C" bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return MockBackingStore::Instance().write(address, value);
 }
@@ -152,3 +227,7 @@ extern "C" bool backing_store_lock(void) {
 extern "C" bool backing_store_read(uint32_t address, backing_store_int_t* value) {
     return MockBackingStore::Instance().read(address, *value);
 }
+
+extern "C" bool backing_store_read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count) {
+    return MockBackingStore::Instance().read_bulk(address, values, item_count);
+}
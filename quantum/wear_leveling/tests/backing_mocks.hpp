@@ -63,9 +63,18 @@ class MockBackingStoreElement {
 struct MockBackingStoreLogEntry {
     MockBackingStoreLogEntry(uint32_t address, backing_store_int_t value) : address(address), value(value), erased(false) {}
     MockBackingStoreLogEntry(bool erased) : address(0), value(0), erased(erased) {}
+    MockBackingStoreLogEntry(uint32_t address, std::size_t length, bool erased) : address(address), value(0), erased(erased), length(length) {}
     uint32_t            address = 0;     // The address of the operation
     backing_store_int_t value   = 0;     // The value of the operation
-    bool                erased  = false; // Whether the entire backing store was erased
+    bool                erased  = false; // Whether the backing store was erased
+    std::size_t         length  = 0;     // The number of bytes erased, or zero if the entire backing store was erased
+};
+
+struct MockBackingStoreTiming {
+    std::size_t   sector_size = WEAR_LEVELING_BACKING_SIZE; // The size of the smallest erasable unit, in bytes
+    std::uint64_t erase_ns    = 0;                          // Time taken to erase a single sector
+    std::uint64_t write_ns    = 0;                          // Time taken to write a single backing store integral
+    std::uint64_t read_ns     = 0;                          // Time taken to read a single backing store integral
 };
 
 class MockBackingStore {
@@ -90,12 +99,21 @@ class MockBackingStore {
     // The write log for the backing store
     std::vector<MockBackingStoreLogEntry> write_log;
 
+    // The simulated timing of the backing store
+    MockBackingStoreTiming timing;
+    // The simulated time spent in the backing store, in nanoseconds
+    mutable std::uint64_t backing_elapsed_ns;
+    // The number of times each sector was erased
+    std::vector<std::uint64_t> sector_erasures;
+
     // The number of times each API was invoked
     std::uint64_t backing_init_invoke_count;
     std::uint64_t backing_unlock_invoke_count;
     std::uint64_t backing_erase_invoke_count;
     std::uint64_t backing_write_invoke_count;
     std::uint64_t backing_lock_invoke_count;
+    mutable std::uint64_t backing_read_invoke_count;
+    mutable std::uint64_t backing_read_bulk_invoke_count;
 
     // Whether init should succeed
     std::function<bool(std::uint64_t)> init_success_callback;
@@ -108,6 +126,9 @@ class MockBackingStore {
     // Whether locks should succeed
     std::function<bool(std::uint64_t)> lock_success_callback;
 
+    // Accounts for the erasure of every sector overlapping the range
+    void erase_sectors(std::uint32_t address, std::size_t length);
+
     template <typename... Args>
     void append_log(Args&&... args) {
         if (write_log.size() < MOCK_WRITE_LOG_MAX_ENTRIES::value) {
@@ -131,6 +152,20 @@ class MockBackingStore {
         return backing_total_write_count;
     }
 
+    // Simulated timing and wear
+    std::uint64_t elapsed_ns() const {
+        return backing_elapsed_ns;
+    }
+    std::size_t sector_count() const {
+        return sector_erasures.size();
+    }
+    std::uint64_t sector_erase_count(std::size_t sector) const {
+        return sector_erasures[sector];
+    }
+    std::uint64_t max_sector_erase_count() const {
+        return *std::max_element(sector_erasures.begin(), sector_erasures.end());
+    }
+
     // The number of times each API was invoked
     std::uint64_t init_invoke_count() const {
         return backing_init_invoke_count;
@@ -147,6 +182,12 @@ class MockBackingStore {
     std::uint64_t lock_invoke_count() const {
         return backing_lock_invoke_count;
     }
+    std::uint64_t read_invoke_count() const {
+        return backing_read_invoke_count;
+    }
+    std::uint64_t read_bulk_invoke_count() const {
+        return backing_read_bulk_invoke_count;
+    }
 
     // Clear out the internal data for the next run
     void reset_instance();
@@ -159,9 +200,11 @@ class MockBackingStore {
     bool init();
     bool unlock();
     bool erase();
+    bool erase_range(std::uint32_t address, std::size_t length);
     bool write(std::uint32_t address, backing_store_int_t value);
     bool lock();
     bool read(std::uint32_t address, backing_store_int_t& value) const;
+    bool read_bulk(std::uint32_t address, backing_store_int_t* values, std::size_t item_count) const;
 
     // Control over when init/writes/erases should succeed
     void set_init_callback(std::function<bool(std::uint64_t)> callback) {
@@ -180,6 +223,14 @@ class MockBackingStore {
         lock_success_callback = callback;
     }
 
+    // Drops everything recorded in the write log so far
+    void clear_write_log() {
+        write_log.clear();
+    }
+
+    // Control over the simulated timing, which also resets the simulated time and wear
+    void set_timing(const MockBackingStoreTiming& t);
+
     auto storage_begin() const -> decltype(backing_storage.begin()) {
         return backing_storage.begin();
     }
@@ -63,4 +63,98 @@ wear_leveling_8byte_SRC := \
 	$(wear_leveling_common_SRC) \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_dual_bank_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DWEAR_LEVELING_DUAL_BANK \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DBACKING_STORE_ERASE_SIZE=16 \
+	-DWEAR_LEVELING_BACKING_SIZE=128 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=16
+wear_leveling_dual_bank_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_dual_bank.cpp
+wear_leveling_dual_bank_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_boot_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=16384 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=2048 \
+	-DWEAR_LEVELING_CHECKPOINT_INTERVAL=64
+wear_leveling_boot_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_boot.cpp
+wear_leveling_boot_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_compressed_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DWEAR_LEVELING_COMPRESSION \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=2048 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=1536
+wear_leveling_compressed_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_compressed.cpp
+wear_leveling_compressed_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_endurance_2byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=8192 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=2048
+wear_leveling_endurance_2byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_endurance.cpp
+wear_leveling_endurance_2byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_endurance_4byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=4 \
+	-DWEAR_LEVELING_BACKING_SIZE=8192 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=2048
+wear_leveling_endurance_4byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_endurance.cpp
+wear_leveling_endurance_4byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_endurance_8byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=8 \
+	-DWEAR_LEVELING_BACKING_SIZE=8192 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=2048
+wear_leveling_endurance_8byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_endurance.cpp
+wear_leveling_endurance_8byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_endurance_dual_bank_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DWEAR_LEVELING_DUAL_BANK \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=16384 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=2048
+wear_leveling_endurance_dual_bank_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_endurance.cpp
+wear_leveling_endurance_dual_bank_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_endurance_compressed_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DWEAR_LEVELING_COMPRESSION \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=8192 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=2048
+wear_leveling_endurance_compressed_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_endurance.cpp
+wear_leveling_endurance_compressed_INC := \
 	$(wear_leveling_common_INC)
\ No newline at end of file
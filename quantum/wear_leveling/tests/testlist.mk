@@ -3,4 +3,12 @@ TEST_LIST += \
 	wear_leveling_2byte_optimized_writes \
 	wear_leveling_2byte \
 	wear_leveling_4byte \
-	wear_leveling_8byte
+	wear_leveling_8byte \
+	wear_leveling_dual_bank \
+	wear_leveling_boot \
+	wear_leveling_compressed \
+	wear_leveling_endurance_2byte \
+	wear_leveling_endurance_4byte \
+	wear_leveling_endurance_8byte \
+	wear_leveling_endurance_dual_bank \
+	wear_leveling_endurance_compressed
@@ -293,3 +293,33 @@ TEST_F(WearLeveling2ByteOptimizedWrites, PlaybackReadbackWord01_Success) {
     wear_leveling_read(0x02, &tmp, sizeof(tmp));
     EXPECT_EQ(tmp, 1) << "Failed to read back the seeded data";
 }
+
+/**
+ * This test verifies that firmware without checkpoints plays back a write log containing one as if it wasn't there.
+ */
+TEST_F(WearLeveling2ByteOptimizedWrites, PlaybackCheckpoint_Skipped) {
+    auto& inst     = MockBackingStore::Instance();
+    auto  logstart = inst.storage_begin() + (WEAR_LEVELING_LOGICAL_SIZE / sizeof(backing_store_int_t));
+
+    // Invalid FNV1a_64 hash
+    (logstart + 0)->set(0);
+    (logstart + 1)->set(0);
+    (logstart + 2)->set(0);
+    (logstart + 3)->set(0);
+
+    // A checkpoint, then a 1-byte logical write of 0x11 at logical offset 0x01
+    auto entry0 = LOG_ENTRY_MAKE_CHECKPOINT(0xFFFFFFFF);
+    auto entry1 = LOG_ENTRY_MAKE_OPTIMIZED_64(0x01, 0x11);
+    for (int i = 0; i < 4; ++i) {
+        (logstart + 4 + i)->set(~entry0.raw16[i]); // start at offset 4 to skip FNV1a_64 result
+    }
+    (logstart + 8)->set(~entry1.raw16[0]);
+
+    wear_leveling_init();
+    uint8_t tmp;
+
+    wear_leveling_read(0x01, &tmp, sizeof(tmp));
+    EXPECT_EQ(tmp, 0x11) << "Failed to read back the data written after the checkpoint";
+    wear_leveling_read(0x1FF, &tmp, sizeof(tmp));
+    EXPECT_EQ(tmp, 0) << "Checkpoint was played back as a write";
+}
@@ -0,0 +1,274 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingBoot : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        verify_data.fill(0);
+        single_bytes = 0;
+        wear_leveling_init();
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+    std::size_t                                          single_bytes;
+
+    wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    void verify_readback(void) {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        EXPECT_EQ(readback, verify_data) << "Invalid readback";
+    }
+
+    /**
+     * Writes a pattern over the whole logical area until it ends up in the consolidated area.
+     */
+    void consolidate_pattern(void) {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> pattern;
+        for (std::uint8_t round = 1;; ++round) {
+            std::iota(pattern.begin(), pattern.end(), round);
+            wear_leveling_status_t status = test_write(0, pattern.data(), pattern.size());
+            ASSERT_NE(status, WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+            if (status == WEAR_LEVELING_CONSOLIDATED) {
+                break;
+            }
+        }
+    }
+
+    /**
+     * Appends the requested number of single byte writes to the write log.
+     * Each one is a 4-byte multibyte entry, none of which can be mistaken for a checkpoint.
+     */
+    void append_single_bytes(std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i, ++single_bytes) {
+            std::uint8_t value = 0x80 + (single_bytes / 1000);
+            ASSERT_EQ(test_write(100 + (single_bytes % 1000), &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        }
+    }
+};
+
+/**
+ * Finds the addresses of the checkpoints in the write log, which must otherwise only hold single byte writes.
+ */
+static std::vector<std::uint32_t> checkpoint_addresses(void) {
+    auto&                      inst = MockBackingStore::Instance();
+    std::vector<std::uint32_t> addresses;
+    std::uint32_t              address = WEAR_LEVELING_LOG_OFFSET;
+    while (address < WEAR_LEVELING_BACKING_SIZE) {
+        backing_store_int_t value = ~(inst.storage_begin() + (address / sizeof(backing_store_int_t)))->get();
+        if (value == 0) {
+            break;
+        }
+        if (value == 0x0100) {
+            addresses.push_back(address);
+            address += 8;
+        } else {
+            address += 4;
+        }
+    }
+    return addresses;
+}
+
+/**
+ * Overwrites a value in the mock backing store, bypassing the usual write-once checks.
+ */
+static void corrupt(std::uint32_t address) {
+    auto& inst = MockBackingStore::Instance();
+    auto  it   = inst.storage_begin() + (address / sizeof(backing_store_int_t));
+    auto  v    = it->get();
+    it->erase();
+    it->set(v ^ 0x5A5A);
+}
+
+/**
+ * This test verifies that a checkpoint is appended every time the write log passes another checkpoint interval.
+ */
+TEST_F(WearLevelingBoot, Checkpoint_AppendedEveryInterval) {
+    append_single_bytes((WEAR_LEVELING_CHECKPOINT_INTERVAL) / 4 - 1);
+    EXPECT_TRUE(checkpoint_addresses().empty()) << "Checkpoint written too early";
+
+    append_single_bytes(1);
+    auto addresses = checkpoint_addresses();
+    ASSERT_EQ(addresses.size(), 1) << "Checkpoint not written";
+    EXPECT_EQ(addresses[0], (WEAR_LEVELING_LOG_OFFSET) + (WEAR_LEVELING_CHECKPOINT_INTERVAL)) << "Checkpoint written at the wrong address";
+
+    append_single_bytes((WEAR_LEVELING_CHECKPOINT_INTERVAL) / 4 - 1);
+    EXPECT_EQ(checkpoint_addresses().size(), 1) << "Checkpoint written too early";
+
+    append_single_bytes(1);
+    addresses = checkpoint_addresses();
+    ASSERT_EQ(addresses.size(), 2) << "Checkpoint not written";
+    EXPECT_EQ(addresses[1], addresses[0] + 8 + (WEAR_LEVELING_CHECKPOINT_INTERVAL)) << "Checkpoint written at the wrong address";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+
+    // The interval carries on from the last checkpoint after a restart
+    append_single_bytes((WEAR_LEVELING_CHECKPOINT_INTERVAL) / 4);
+    addresses = checkpoint_addresses();
+    ASSERT_EQ(addresses.size(), 3) << "Checkpoint not written";
+    EXPECT_EQ(addresses[2], addresses[1] + 8 + (WEAR_LEVELING_CHECKPOINT_INTERVAL)) << "Checkpoint written at the wrong address";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that a matching checkpoint vouches for the consolidated data, without its FNV1a_64 being checked.
+ */
+TEST_F(WearLevelingBoot, Checkpoint_VouchesForConsolidatedData) {
+    consolidate_pattern();
+    append_single_bytes(2 * (WEAR_LEVELING_CHECKPOINT_INTERVAL) / 4 + 4);
+    ASSERT_EQ(checkpoint_addresses().size(), 2) << "Checkpoint not written";
+
+    // With the FNV1a_64 broken, the consolidated data would otherwise be discarded
+    corrupt(WEAR_LEVELING_LOGICAL_SIZE);
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that without a checkpoint, a mismatching FNV1a_64 still discards the consolidated data.
+ */
+TEST_F(WearLevelingBoot, NoCheckpoint_ChecksumStillVerified) {
+    consolidate_pattern();
+    append_single_bytes(4);
+    ASSERT_TRUE(checkpoint_addresses().empty()) << "Checkpoint written too early";
+
+    corrupt(WEAR_LEVELING_LOGICAL_SIZE);
+
+    // Only the write log remains
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> expected{};
+    std::copy(verify_data.begin() + 100, verify_data.begin() + 104, expected.begin() + 100);
+    verify_data = expected;
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that without a matching checkpoint, the FNV1a_64 of the consolidated data is checked instead.
+ */
+TEST_F(WearLevelingBoot, CorruptCheckpoint_FallsBackToChecksum) {
+    consolidate_pattern();
+    append_single_bytes((WEAR_LEVELING_CHECKPOINT_INTERVAL) / 4 + 4);
+    auto addresses = checkpoint_addresses();
+    ASSERT_EQ(addresses.size(), 1) << "Checkpoint not written";
+
+    corrupt(addresses[0] + 2);
+
+    // Nothing is lost, as the consolidated data still matches its FNV1a_64
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that a damaged checkpoint is skipped over if a later one matches.
+ */
+TEST_F(WearLevelingBoot, CorruptCheckpoint_LaterOneMatches) {
+    consolidate_pattern();
+    append_single_bytes(2 * (WEAR_LEVELING_CHECKPOINT_INTERVAL) / 4 + 4);
+    auto addresses = checkpoint_addresses();
+    ASSERT_EQ(addresses.size(), 2) << "Checkpoint not written";
+
+    // With the FNV1a_64 broken too, only the second checkpoint can vouch for the consolidated data
+    corrupt(addresses[0] + 2);
+    corrupt(WEAR_LEVELING_LOGICAL_SIZE);
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that damage to the write log after the last matching checkpoint rolls the data back to that checkpoint.
+ */
+TEST_F(WearLevelingBoot, CorruptLog_RollsBackToLastMatchingCheckpoint) {
+    consolidate_pattern();
+    append_single_bytes((WEAR_LEVELING_CHECKPOINT_INTERVAL) / 4);
+    auto at_checkpoint = verify_data;
+    append_single_bytes((WEAR_LEVELING_CHECKPOINT_INTERVAL) / 4 + 4);
+    auto addresses = checkpoint_addresses();
+    ASSERT_EQ(addresses.size(), 2) << "Checkpoint not written";
+
+    // Changes the address and value of the first write after the first checkpoint, so the second no longer matches
+    corrupt(addresses[0] + 8 + 2);
+
+    verify_data = at_checkpoint;
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_CONSOLIDATED) << "Damaged write log should have triggered consolidation";
+    verify_readback();
+
+    // The damaged write log was consolidated away, so writing carries on as usual
+    EXPECT_TRUE(checkpoint_addresses().empty()) << "Write log not consolidated";
+    append_single_bytes(4);
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test measures startup with a nearly full write log, checking the backing store is only read a chunk at a time.
+ */
+TEST_F(WearLevelingBoot, FullLog_ReadInChunks) {
+    auto&                 inst     = MockBackingStore::Instance();
+    constexpr std::size_t log_size = (WEAR_LEVELING_BACKING_SIZE) - (WEAR_LEVELING_LOG_OFFSET);
+
+    // Each single byte write takes up 4 bytes of the write log, and each interval of them another 8 for the checkpoint
+    consolidate_pattern();
+    append_single_bytes((log_size * 9 / 10) * (WEAR_LEVELING_CHECKPOINT_INTERVAL) / ((WEAR_LEVELING_CHECKPOINT_INTERVAL) + 8) / 4);
+    auto addresses = checkpoint_addresses();
+    ASSERT_GT(addresses.size(), 1) << "Checkpoints not written";
+
+    auto measure = [&](const char* name, std::size_t max_bulk_reads) {
+        auto reads      = inst.read_invoke_count();
+        auto bulk_reads = inst.read_bulk_invoke_count();
+        auto start      = std::chrono::steady_clock::now();
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+        auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        verify_readback();
+
+        reads      = inst.read_invoke_count() - reads;
+        bulk_reads = inst.read_bulk_invoke_count() - bulk_reads;
+        EXPECT_EQ(reads, 0) << "Backing store should only be read in bulk";
+        EXPECT_LE(bulk_reads, max_bulk_reads) << "Too many bulk reads";
+        std::cout << "[ BOOT     ] " << name << ": " << bulk_reads << " bulk reads, " << elapsed << "us" << std::endl;
+    };
+
+    // Consolidated data and whether the log reaches a checkpoint, then the write log a chunk at a time, plus the
+    // consolidated data again and its FNV1a_64 record when no checkpoint can be used
+    constexpr std::size_t chunk_bytes = (WEAR_LEVELING_PLAYBACK_CHUNK) * sizeof(backing_store_int_t);
+    constexpr std::size_t log_reads   = (log_size + chunk_bytes - 1) / chunk_bytes;
+    measure("checkpoint", 2 + log_reads);
+
+    for (auto address : addresses) {
+        corrupt(address + 2);
+    }
+    measure("checksum", 2 + log_reads + ((WEAR_LEVELING_LOGICAL_SIZE) + chunk_bytes - 1) / chunk_bytes + 1);
+}
+
+/**
+ * This test verifies that a write log too short to hold a checkpoint doesn't cause the consolidated data to be read twice.
+ */
+TEST_F(WearLevelingBoot, ShortLog_ConsolidatedReadOnce) {
+    auto& inst = MockBackingStore::Instance();
+
+    consolidate_pattern();
+    append_single_bytes(4);
+    ASSERT_TRUE(checkpoint_addresses().empty()) << "Checkpoint written too early";
+
+    auto bulk_reads = inst.read_bulk_invoke_count();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+
+    // Consolidated data, the checkpoint slot, the FNV1a_64 record, and a single chunk of write log
+    EXPECT_EQ(inst.read_bulk_invoke_count() - bulk_reads, 4) << "Consolidated data should only be read once";
+}
@@ -0,0 +1,205 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include <random>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingCompressed : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        verify_data.fill(0);
+        wear_leveling_init();
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    void verify_readback(void) {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        EXPECT_EQ(readback, verify_data) << "Invalid readback";
+    }
+
+    /**
+     * Writes the supplied contents, then keeps toggling the last byte until the write log is consolidated.
+     */
+    void consolidate(const std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE>& contents) {
+        for (std::size_t i = 0; i < contents.size(); i += 4) {
+            ASSERT_NE(test_write(i, &contents[i], std::min<std::size_t>(4, contents.size() - i)), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+        }
+        for (std::uint8_t round = 1;; ++round) {
+            wear_leveling_status_t status = test_write(WEAR_LEVELING_LOGICAL_SIZE - 1, &round, 1);
+            ASSERT_NE(status, WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+            if (status == WEAR_LEVELING_CONSOLIDATED) {
+                break;
+            }
+        }
+    }
+};
+
+/**
+ * Reads an 8-byte record straight from the mock backing store.
+ */
+static write_log_entry_t read_record(std::uint32_t address) {
+    auto&             inst = MockBackingStore::Instance();
+    auto              it   = inst.storage_begin() + (address / sizeof(backing_store_int_t));
+    write_log_entry_t entry;
+    auto              values = reinterpret_cast<backing_store_int_t*>(entry.raw8);
+    for (std::size_t i = 0; i < sizeof(entry) / sizeof(backing_store_int_t); ++i) {
+        values[i] = ~(it + i)->get();
+    }
+    return entry;
+}
+
+/**
+ * Length of the compressed snapshot, from its header.
+ */
+static std::uint32_t snapshot_length(void) {
+    write_log_entry_t header = read_record(0);
+    EXPECT_EQ(header.raw32[1], header.raw32[0] ^ (WEAR_LEVELING_SNAPSHOT_MAGIC)) << "Invalid snapshot header";
+    return header.raw32[0];
+}
+
+/**
+ * Address of the first write after consolidation, which should be the start of the write log.
+ */
+static std::uint32_t first_write_address(void) {
+    auto& inst = MockBackingStore::Instance();
+    auto  it   = std::find_if(inst.log_begin(), inst.log_end(), [](const MockBackingStoreLogEntry& e) { return !e.erased; });
+    EXPECT_NE(it, inst.log_end()) << "Nothing was written";
+    return it == inst.log_end() ? 0 : it->address;
+}
+
+/**
+ * Overwrites a value in the mock backing store, bypassing the usual write-once checks.
+ */
+static void corrupt(std::uint32_t address) {
+    auto& inst = MockBackingStore::Instance();
+    auto  it   = inst.storage_begin() + (address / sizeof(backing_store_int_t));
+    auto  v    = it->get();
+    it->erase();
+    it->set(v ^ 0x5A5A);
+}
+
+/**
+ * This test verifies that a blank backing store is treated as an empty snapshot, with the write log directly after
+ * its header and checksum.
+ */
+TEST_F(WearLevelingCompressed, BlankStore_LogFollowsEmptySnapshot) {
+    auto&        inst  = MockBackingStore::Instance();
+    std::uint8_t value = 0x42;
+    EXPECT_EQ(test_write(100, &value, 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(first_write_address(), WEAR_LEVELING_SNAPSHOT_OFFSET) << "Write log should start after the empty snapshot";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(inst.erasure_count(), 0) << "Blank backing store should not be erased";
+    verify_readback();
+}
+
+/**
+ * This test verifies that mostly-zero data is stored in far less than the logical size, with the write log directly
+ * after it.
+ */
+TEST_F(WearLevelingCompressed, SparseData_Compresses) {
+    auto&                                                inst = MockBackingStore::Instance();
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> contents{};
+    std::iota(contents.begin() + 64, contents.begin() + 128, 1);
+    contents[512] = 0xAA;
+    consolidate(contents);
+
+    std::uint32_t length = snapshot_length();
+    EXPECT_LT(length, 128) << "Snapshot was not compressed";
+
+    inst.clear_write_log();
+    std::uint8_t value = 0x42;
+    EXPECT_EQ(test_write(200, &value, 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(first_write_address(), WEAR_LEVELING_SNAPSHOT_OFFSET + length) << "Write log should start after the snapshot";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that data which can't be compressed still fits, and reads back.
+ */
+TEST_F(WearLevelingCompressed, RandomData_RoundTrip) {
+    std::mt19937                                         rng(0x5EED);
+    std::uniform_int_distribution<int>                   byte(1, 255);
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> contents;
+    std::generate(contents.begin(), contents.end(), [&] { return byte(rng); });
+    consolidate(contents);
+
+    EXPECT_LE(snapshot_length(), WEAR_LEVELING_SNAPSHOT_MAX_SIZE) << "Snapshot larger than the worst case";
+    EXPECT_GT(snapshot_length(), WEAR_LEVELING_LOGICAL_SIZE) << "Random data should not compress";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies the boundaries of the encoding -- single zeros, runs of zeros and literals either side of the
+ * maximum run length, and zeros at the very end.
+ */
+TEST_F(WearLevelingCompressed, RunBoundaries_RoundTrip) {
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> contents;
+    std::size_t                                          i    = 0;
+    auto                                                 fill = [&](std::size_t count, bool zero) {
+        for (std::size_t j = 0; j < count && i < contents.size(); ++j, ++i) {
+            contents[i] = zero ? 0 : (std::uint8_t)(1 + i % 255);
+        }
+    };
+    for (std::size_t run : {1, 2, 127, 128, 129, 256, 257}) {
+        fill(run, false);
+        fill(run, true);
+        fill(1, false);
+        fill(1, true);
+    }
+    fill(contents.size(), false);
+    contents[contents.size() - 2] = 0;
+    consolidate(contents);
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that a damaged snapshot is discarded, while the write log after it is still played back.
+ */
+TEST_F(WearLevelingCompressed, CorruptSnapshot_ClearsCache) {
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> contents{};
+    std::iota(contents.begin(), contents.begin() + 32, 1);
+    consolidate(contents);
+
+    std::uint8_t value = 0x42;
+    EXPECT_EQ(test_write(300, &value, 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    corrupt(WEAR_LEVELING_SNAPSHOT_OFFSET);
+
+    // Only the write log remains
+    verify_data.fill(0);
+    verify_data[300] = value;
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that a damaged header, which leaves the write log unreachable, forces consolidation.
+ */
+TEST_F(WearLevelingCompressed, CorruptHeader_ForcesConsolidation) {
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> contents{};
+    std::iota(contents.begin(), contents.begin() + 32, 1);
+    consolidate(contents);
+    corrupt(0);
+
+    verify_data.fill(0);
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_CONSOLIDATED) << "Init returned incorrect status";
+    verify_readback();
+    EXPECT_EQ(snapshot_length(), 16) << "Snapshot of a clear cache should be minimal";
+}
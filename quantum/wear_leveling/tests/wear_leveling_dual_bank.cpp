@@ -0,0 +1,336 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingDualBank : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        verify_data.fill(0);
+        wear_leveling_init();
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    void verify_readback(void) {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        EXPECT_EQ(readback, verify_data) << "Invalid readback";
+    }
+};
+
+/**
+ * Reads the bank marker straight from the mock backing store.
+ *
+ * @return true if the bank has a valid marker
+ */
+static bool read_bank_marker(int bank, uint32_t* generation) {
+    auto&    inst = MockBackingStore::Instance();
+    auto     it   = inst.storage_begin() + ((bank * (WEAR_LEVELING_BANK_SIZE)) + (WEAR_LEVELING_LOGICAL_SIZE) + 8) / sizeof(backing_store_int_t);
+    uint32_t raw[2];
+    auto     bytes = reinterpret_cast<backing_store_int_t*>(raw);
+    for (std::size_t i = 0; i < sizeof(raw) / sizeof(backing_store_int_t); ++i) {
+        bytes[i] = ~(it + i)->get();
+    }
+    *generation = raw[0];
+    return raw[1] == (WEAR_LEVELING_BANK_MAGIC);
+}
+
+/**
+ * Counts the number of times the whole backing store was erased.
+ */
+static std::size_t full_erase_count(void) {
+    auto& inst = MockBackingStore::Instance();
+    return std::count_if(inst.log_begin(), inst.log_end(), [](const MockBackingStoreLogEntry& e) { return e.erased && e.length == 0; });
+}
+
+/**
+ * Fills the write log of the active bank up to the consolidation threshold, using single byte writes.
+ */
+static constexpr std::size_t DUE_ENTRIES = (((WEAR_LEVELING_BANK_SIZE) - (WEAR_LEVELING_LOG_OFFSET)) * (WEAR_LEVELING_CONSOLIDATE_THRESHOLD) / 100) / sizeof(backing_store_int_t);
+
+/**
+ * This test verifies that a blank backing store is formatted on startup, with the first bank marked as the active one.
+ */
+TEST_F(WearLevelingDualBank, FreshInit_FirstBankMarked) {
+    auto&    inst = MockBackingStore::Instance();
+    uint32_t generation;
+    EXPECT_TRUE(read_bank_marker(0, &generation)) << "First bank should be marked";
+    EXPECT_EQ(generation, 1) << "Invalid generation";
+    EXPECT_FALSE(read_bank_marker(1, &generation)) << "Second bank should not be marked";
+
+    uint8_t test_value = 0x15;
+    EXPECT_EQ(test_write(0x02, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ((inst.log_end() - 1)->address, WEAR_LEVELING_LOG_OFFSET) << "Invalid first write address.";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that once the write log passes the threshold, the background task consolidates into the other bank
+ * without any write having to wait for it, and without ever erasing the active bank.
+ */
+TEST_F(WearLevelingDualBank, BackgroundConsolidation_NoInlineErase) {
+    auto&       inst   = MockBackingStore::Instance();
+    std::size_t erases = full_erase_count();
+
+    for (std::size_t i = 0; i < DUE_ENTRIES; ++i) {
+        uint8_t value = 0x40 + i;
+        EXPECT_EQ(test_write(i, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+
+    uint32_t generation;
+    for (int i = 0; i < 100 && !read_bank_marker(1, &generation); ++i) {
+        wear_leveling_task();
+    }
+    EXPECT_TRUE(read_bank_marker(1, &generation)) << "Second bank should be marked";
+    EXPECT_EQ(generation, 2) << "Invalid generation";
+
+    // The previous bank is erased afterwards, by itself
+    for (int i = 0; i < 100; ++i) {
+        wear_leveling_task();
+    }
+    EXPECT_FALSE(read_bank_marker(0, &generation)) << "First bank should have been erased";
+    for (auto it = inst.storage_begin(); it != inst.storage_begin() + (WEAR_LEVELING_BANK_SIZE) / sizeof(backing_store_int_t); ++it) {
+        EXPECT_TRUE(it->is_erased()) << "First bank should have been erased";
+    }
+    EXPECT_EQ(full_erase_count(), erases) << "Whole backing store should not have been erased";
+    EXPECT_TRUE(inst.is_locked()) << "Backing store should have been locked again";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that the background work is spread over several calls to the task, with the previous bank erased
+ * one erase step at a time rather than all at once.
+ */
+TEST_F(WearLevelingDualBank, BackgroundConsolidation_SpreadOverSeveralTasks) {
+    auto& inst = MockBackingStore::Instance();
+
+    for (std::size_t i = 0; i < DUE_ENTRIES; ++i) {
+        uint8_t value = 0x70 + i;
+        EXPECT_EQ(test_write(i, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+
+    uint32_t generation;
+    int      consolidate_tasks = 0;
+    while (consolidate_tasks < 100 && !read_bank_marker(1, &generation)) {
+        wear_leveling_task();
+        ++consolidate_tasks;
+    }
+    EXPECT_TRUE(read_bank_marker(1, &generation)) << "Second bank should be marked";
+    EXPECT_GT(consolidate_tasks, 1) << "Consolidation should not have been done in a single task";
+
+    auto range_erases = [&inst]() { return std::count_if(inst.log_begin(), inst.log_end(), [](const MockBackingStoreLogEntry& e) { return e.erased && e.length != 0; }); };
+    auto erases       = range_erases();
+    int  erase_tasks  = 0;
+    for (int i = 0; i < 100; ++i) {
+        wear_leveling_task();
+        auto now = range_erases();
+        EXPECT_LE(now - erases, 1) << "Only one erase step should be done per task";
+        if (now != erases) {
+            ++erase_tasks;
+        }
+        erases = now;
+    }
+    EXPECT_EQ(erase_tasks, (WEAR_LEVELING_BANK_SIZE) / (WEAR_LEVELING_ERASE_STEP)) << "Previous bank should have been erased one step at a time";
+    EXPECT_GT(erase_tasks, 1) << "Erase step should default to the backing store erase size";
+    EXPECT_FALSE(read_bank_marker(0, &generation)) << "First bank should have been erased";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that a reset part way through consolidation leaves the data intact, and that the partially-written
+ * bank is reclaimed afterwards.
+ */
+TEST_F(WearLevelingDualBank, ResetDuringConsolidation_DataIntact) {
+    for (std::size_t i = 0; i < DUE_ENTRIES; ++i) {
+        uint8_t value = 0x60 + i;
+        EXPECT_EQ(test_write(i, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+
+    // Copies the data, but stops before the bank marker is written
+    wear_leveling_task();
+
+    uint32_t generation;
+    EXPECT_FALSE(read_bank_marker(1, &generation)) << "Second bank should not be marked yet";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+
+    // Keep going until the banks have been switched twice
+    for (int i = 0; i < 200; ++i) {
+        uint8_t value = 0x80 + i;
+        EXPECT_NE(test_write(i % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value)), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+        wear_leveling_task();
+        if (i % 7 == 0) {
+            EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+            verify_readback();
+        }
+    }
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that writes made while consolidation is in progress end up in the new bank.
+ */
+TEST_F(WearLevelingDualBank, WritesDuringConsolidation_Preserved) {
+    for (std::size_t i = 0; i < DUE_ENTRIES; ++i) {
+        uint8_t value = 0x20 + i;
+        EXPECT_EQ(test_write(i, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+
+    wear_leveling_task();
+
+    uint8_t value = 0x99;
+    EXPECT_EQ(test_write(0x01, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    uint16_t value16 = 0x1234;
+    EXPECT_EQ(test_write(0x0E, &value16, sizeof(value16)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+
+    uint32_t generation;
+    for (int i = 0; i < 100 && !read_bank_marker(1, &generation); ++i) {
+        wear_leveling_task();
+    }
+    EXPECT_TRUE(read_bank_marker(1, &generation)) << "Second bank should be marked";
+
+    // Drop the first bank, so the readback can only come from the second
+    for (int i = 0; i < 100; ++i) {
+        wear_leveling_task();
+    }
+    EXPECT_FALSE(read_bank_marker(0, &generation)) << "First bank should have been erased";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that if the background task never runs, a full write log still consolidates in-line into the
+ * other bank, without erasing the whole backing store.
+ */
+TEST_F(WearLevelingDualBank, FullLogWithoutTask_ConsolidatesInline) {
+    std::size_t erases  = full_erase_count();
+    std::size_t entries = ((WEAR_LEVELING_BANK_SIZE) - (WEAR_LEVELING_LOG_OFFSET)) / sizeof(backing_store_int_t);
+
+    for (std::size_t i = 0; i < entries; ++i) {
+        uint8_t value = 0x30 + i;
+        EXPECT_EQ(test_write(i % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value)), i + 1 == entries ? WEAR_LEVELING_CONSOLIDATED : WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+
+    uint32_t generation;
+    EXPECT_TRUE(read_bank_marker(1, &generation)) << "Second bank should be marked";
+    EXPECT_EQ(generation, 2) << "Invalid generation";
+
+    // Cycle through the banks a few more times
+    for (int i = 0; i < 100; ++i) {
+        uint8_t value = 0xA0 + i;
+        EXPECT_NE(test_write(i % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value)), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(full_erase_count(), erases) << "Whole backing store should not have been erased";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that if the newest bank's consolidated data is corrupt, the previous bank is used instead.
+ */
+TEST_F(WearLevelingDualBank, CorruptNewestBank_FallsBackToPrevious) {
+    auto&       inst    = MockBackingStore::Instance();
+    std::size_t entries = ((WEAR_LEVELING_BANK_SIZE) - (WEAR_LEVELING_LOG_OFFSET)) / sizeof(backing_store_int_t);
+
+    for (std::size_t i = 0; i < entries; ++i) {
+        uint8_t value = 0x50 + i;
+        test_write(i % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value));
+    }
+
+    uint32_t generation;
+    EXPECT_TRUE(read_bank_marker(1, &generation)) << "Second bank should be marked";
+
+    // Corrupt the consolidated data of the second bank
+    (inst.storage_begin() + (WEAR_LEVELING_BANK_SIZE) / sizeof(backing_store_int_t))->erase();
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_CONSOLIDATED) << "Init returned incorrect status";
+    verify_readback();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that data written with the single bank layout is picked up on first startup with dual banks.
+ */
+TEST_F(WearLevelingDualBank, SingleBankLayout_Migrated) {
+    auto& inst = MockBackingStore::Instance();
+    inst.reset_instance();
+
+    // Lay out the consolidated data and its checksum
+    std::iota(verify_data.begin(), verify_data.end(), 0x10);
+    auto values = reinterpret_cast<const backing_store_int_t*>(verify_data.data());
+    for (std::size_t i = 0; i < (WEAR_LEVELING_LOGICAL_SIZE) / sizeof(backing_store_int_t); ++i) {
+        (inst.storage_begin() + i)->set(~values[i]);
+    }
+    uint64_t hash   = fnv_64a_buf(verify_data.data(), verify_data.size(), FNV1A_64_INIT);
+    auto     hashes = reinterpret_cast<const backing_store_int_t*>(&hash);
+    for (std::size_t i = 0; i < sizeof(hash) / sizeof(backing_store_int_t); ++i) {
+        (inst.storage_begin() + (WEAR_LEVELING_LOGICAL_SIZE) / sizeof(backing_store_int_t) + i)->set(~hashes[i]);
+    }
+
+    // ...followed by a write log entry
+    auto entry = LOG_ENTRY_MAKE_OPTIMIZED_64(0x03, 0x77);
+    (inst.storage_begin() + ((WEAR_LEVELING_LOGICAL_SIZE) + 8) / sizeof(backing_store_int_t))->set(~entry.raw16[0]);
+    verify_data[0x03] = 0x77;
+
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Init returned incorrect status";
+    verify_readback();
+
+    uint32_t generation;
+    EXPECT_TRUE(read_bank_marker(0, &generation)) << "First bank should be marked";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that a transaction too large for the write log, committed while consolidation is in progress,
+ * restarts consolidation so that data already copied across is not left out of date.
+ */
+TEST_F(WearLevelingDualBank, LargeTransactionDuringConsolidation_Restarts) {
+    for (std::size_t i = 0; i < DUE_ENTRIES; ++i) {
+        uint8_t value = 0x20 + i;
+        EXPECT_EQ(test_write(i, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+
+    // Copies the data, but stops before the bank marker is written
+    wear_leveling_task();
+
+    wear_leveling_begin();
+    for (std::size_t i = 0; i < WEAR_LEVELING_LOGICAL_SIZE; ++i) {
+        uint8_t value = 0xC0 + i;
+        EXPECT_EQ(test_write(i, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(wear_leveling_commit(), WEAR_LEVELING_CONSOLIDATED) << "Commit returned incorrect status";
+
+    uint32_t generation;
+    EXPECT_TRUE(read_bank_marker(1, &generation)) << "Second bank should be marked";
+
+    // Drop the first bank, so the readback can only come from the second
+    for (int i = 0; i < 100; ++i) {
+        wear_leveling_task();
+    }
+    EXPECT_FALSE(read_bank_marker(0, &generation)) << "First bank should have been erased";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
@@ -0,0 +1,182 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+/* Replays typical EEPROM workloads against a backing store with simulated flash timing, reporting for each:
+ *  - the number of times the most-worn sector was erased,
+ *  - the number of bytes written to the backing store,
+ *  - the worst-case latency of a single write, commit or wear_leveling_task(), and the total time spent in the backing
+ *    store,
+ *  - how many times the workload could be repeated before the most-worn sector reaches its rated endurance.
+ *
+ * Run for each BACKING_STORE_WRITE_SIZE with the WEAR_LEVELING_BACKING_SIZE and WEAR_LEVELING_LOGICAL_SIZE of the
+ * board in question, adjusting the flash parameters below to match its datasheet.
+ */
+
+// Flash parameters, roughly those of an STM32F103 -- 2kB pages, with a 20ms page erase and 50us per program operation
+static constexpr MockBackingStoreTiming ENDURANCE_TIMING = {
+    .sector_size = 2048,
+    .erase_ns    = 20000000,
+    .write_ns    = 50000,
+    .read_ns     = 30,
+};
+// Rated erase cycles of each sector
+static constexpr std::uint64_t ENDURANCE_CYCLES = 10000;
+
+// Layout of the simulated EEPROM contents
+static constexpr std::uint32_t RGBLIGHT_ADDRESS       = 24;
+static constexpr std::uint32_t DYNAMIC_KEYMAP_ADDRESS = 64;
+static constexpr std::size_t   DYNAMIC_KEYMAP_SIZE    = 4 * 90 * 2; // 4 layers, 90 keys
+static constexpr std::size_t   DYNAMIC_MACRO_SIZE     = 512;
+static constexpr std::size_t   VIA_CHUNK_SIZE         = 28; // payload of a single VIA raw HID message
+
+static_assert(DYNAMIC_KEYMAP_ADDRESS + DYNAMIC_KEYMAP_SIZE + DYNAMIC_MACRO_SIZE <= WEAR_LEVELING_LOGICAL_SIZE, "Simulated EEPROM contents do not fit in the logical size");
+
+class WearLevelingEndurance : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        verify_data.fill(0);
+        wear_leveling_init();
+        MockBackingStore::Instance().set_timing(ENDURANCE_TIMING);
+        worst_ns = 0;
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+    std::uint64_t                                        worst_ns;
+
+    /**
+     * Runs a single operation, keeping track of the worst-case time spent in the backing store.
+     */
+    template <typename F>
+    wear_leveling_status_t timed(F&& operation) {
+        auto&                  inst   = MockBackingStore::Instance();
+        auto                   start  = inst.elapsed_ns();
+        wear_leveling_status_t status = operation();
+        worst_ns                      = std::max(worst_ns, inst.elapsed_ns() - start);
+        return status;
+    }
+
+    wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return timed([&] { return wear_leveling_write(address, value, length); });
+    }
+
+    /**
+     * Runs the background maintenance the main loop would run between writes.
+     */
+    void idle(void) {
+        timed([] {
+            wear_leveling_task();
+            return WEAR_LEVELING_SUCCESS;
+        });
+    }
+
+    void verify_readback(void) {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        EXPECT_EQ(readback, verify_data) << "Invalid readback";
+    }
+
+    /**
+     * Prints the results of a workload repeated `iterations` times.
+     */
+    void report(const char* name, std::size_t iterations) {
+        auto&         inst    = MockBackingStore::Instance();
+        std::uint64_t erases  = inst.max_sector_erase_count();
+        std::uint64_t written = inst.total_write_count() * BACKING_STORE_WRITE_SIZE;
+
+        std::ostringstream lifetime;
+        if (erases == 0) {
+            lifetime << "unbounded";
+        } else {
+            lifetime << (ENDURANCE_CYCLES * iterations / erases) << " iterations";
+        }
+
+        RecordProperty(std::string(name) + "_erases", std::to_string(erases));
+        RecordProperty(std::string(name) + "_bytes_written", std::to_string(written));
+        RecordProperty(std::string(name) + "_worst_ns", std::to_string(worst_ns));
+        std::cout << std::fixed << std::setprecision(3) << "[ ENDURANCE] " << name << " x" << iterations << ": " << erases << " erases, " << written << " bytes written, worst " << (worst_ns / 1e6) << "ms, total " << (inst.elapsed_ns() / 1e6) << "ms, lifetime " << lifetime.str() << std::endl;
+    }
+};
+
+/**
+ * This workload uploads a full keymap and macro buffer through VIA, one message per transaction, with different
+ * contents each time.
+ */
+TEST_F(WearLevelingEndurance, ViaKeymapUpload) {
+    constexpr std::size_t uploads = 50;
+    constexpr std::size_t length  = DYNAMIC_KEYMAP_SIZE + DYNAMIC_MACRO_SIZE;
+
+    std::mt19937                       rng(0x5EED);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::array<std::uint8_t, length>   buffer;
+    for (std::size_t upload = 0; upload < uploads; ++upload) {
+        std::generate(buffer.begin(), buffer.end(), [&] { return byte(rng); });
+        for (std::size_t offset = 0; offset < length; offset += VIA_CHUNK_SIZE) {
+            wear_leveling_begin();
+            for (std::size_t i = offset; i < std::min(length, offset + VIA_CHUNK_SIZE); ++i) {
+                ASSERT_NE(test_write(DYNAMIC_KEYMAP_ADDRESS + i, &buffer[i], 1), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+            }
+            ASSERT_NE(timed([] { return wear_leveling_commit(); }), WEAR_LEVELING_FAILED) << "Commit returned incorrect status";
+            idle();
+        }
+    }
+
+    verify_readback();
+    report("via_keymap_upload", uploads);
+}
+
+/**
+ * This workload steps the RGB Light hue through its range, saving the whole config every step.
+ */
+TEST_F(WearLevelingEndurance, RgbAdjustments) {
+    constexpr std::size_t steps = 5000;
+
+    std::array<std::uint8_t, 8> config = {1, 1, 0, 255, 255, 0, 0, 0};
+    for (std::size_t step = 0; step < steps; ++step) {
+        config[2] += 8;
+        ASSERT_NE(test_write(RGBLIGHT_ADDRESS, config.data(), config.size()), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+        idle();
+    }
+
+    auto& inst = MockBackingStore::Instance();
+    EXPECT_GT(inst.max_sector_erase_count(), 0) << "Workload should be large enough to consolidate";
+
+    verify_readback();
+    report("rgb_adjustments", steps);
+}
+
+/**
+ * This workload measures startup with most of the write log in use.
+ */
+TEST_F(WearLevelingEndurance, Boot) {
+    auto&                 inst     = MockBackingStore::Instance();
+    constexpr std::size_t log_size = (WEAR_LEVELING_BANK_SIZE) - (WEAR_LEVELING_LOG_OFFSET);
+
+    // Fill the write log with single byte writes, leaving room for checkpoints so that it doesn't consolidate
+    constexpr std::size_t entry_size = std::max<std::size_t>(4, BACKING_STORE_WRITE_SIZE);
+    for (std::size_t i = 0; i < (log_size * 3 / 4) / entry_size; ++i) {
+        std::uint8_t value = 0x80 + (i / 256);
+        ASSERT_EQ(test_write(DYNAMIC_KEYMAP_ADDRESS + (i % 256), &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    ASSERT_EQ(inst.max_sector_erase_count(), 0) << "Write log should not have been consolidated";
+
+    // Only account for the time spent booting
+    inst.set_timing(ENDURANCE_TIMING);
+    worst_ns = 0;
+
+    constexpr std::size_t boots = 10;
+    for (std::size_t boot = 0; boot < boots; ++boot) {
+        EXPECT_EQ(timed([] { return wear_leveling_init(); }), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    }
+
+    verify_readback();
+    report("boot", boots);
+}
@@ -202,3 +202,78 @@ TEST_F(WearLevelingGeneral, WriteFailure_NoSubsequentWrites) {
     wear_leveling_read(0x04, &test_val, sizeof(test_val));
     EXPECT_EQ(test_val, 0x14) << "Readback should come from cache regardless of unlock failure";
 }
+
+/**
+ * This test verifies that writes within a transaction only reach the backing store on commit, within a single unlock.
+ */
+TEST_F(WearLevelingGeneral, Transaction_WrittenOnCommit) {
+    auto& inst = MockBackingStore::Instance();
+
+    wear_leveling_begin();
+    uint8_t test_val = 0x14;
+    EXPECT_EQ(wear_leveling_write(0x02, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write should have succeeded";
+    test_val = 0x15;
+    EXPECT_EQ(wear_leveling_write(0x08, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write should have succeeded";
+
+    EXPECT_EQ(inst.unlock_invoke_count(), 0) << "Unlock should not have been invoked";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Write should not have been invoked";
+
+    test_val = 0;
+    wear_leveling_read(0x02, &test_val, sizeof(test_val));
+    EXPECT_EQ(test_val, 0x14) << "Readback should come from cache before commit";
+
+    EXPECT_EQ(wear_leveling_commit(), WEAR_LEVELING_SUCCESS) << "Commit should have succeeded";
+    EXPECT_EQ(inst.unlock_invoke_count(), 1) << "Unlock should have been invoked once";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Erase should not have been invoked";
+    EXPECT_EQ(inst.write_invoke_count(), 2) << "Write should have been invoked twice";
+    EXPECT_EQ(inst.lock_invoke_count(), 1) << "Lock should have been invoked once";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init should have succeeded";
+    wear_leveling_read(0x08, &test_val, sizeof(test_val));
+    EXPECT_EQ(test_val, 0x15) << "Invalid readback";
+}
+
+/**
+ * This test verifies that repeated and adjacent writes within a transaction are coalesced, and that nested transactions
+ * are only written out by the outermost commit.
+ */
+TEST_F(WearLevelingGeneral, Transaction_Coalesced) {
+    auto& inst = MockBackingStore::Instance();
+
+    wear_leveling_begin();
+    wear_leveling_begin();
+    for (uint8_t i = 1; i <= 5; ++i) {
+        EXPECT_EQ(wear_leveling_write(0x03, &i, sizeof(i)), WEAR_LEVELING_SUCCESS) << "Write should have succeeded";
+    }
+    EXPECT_EQ(wear_leveling_commit(), WEAR_LEVELING_SUCCESS) << "Inner commit should have succeeded";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Inner commit should not have written anything";
+    EXPECT_EQ(wear_leveling_commit(), WEAR_LEVELING_SUCCESS) << "Outer commit should have succeeded";
+    EXPECT_EQ(inst.write_invoke_count(), 1) << "Only the last value should have been written";
+
+    EXPECT_EQ(wear_leveling_commit(), WEAR_LEVELING_FAILED) << "Unbalanced commit should have failed";
+}
+
+/**
+ * This test verifies that a transaction which doesn't fit in the write log consolidates once, rather than filling the
+ * write log first.
+ */
+TEST_F(WearLevelingGeneral, Transaction_TooLarge_SingleConsolidation) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> testvalue;
+    std::iota(testvalue.begin(), testvalue.end(), 0x20);
+
+    wear_leveling_begin();
+    for (std::size_t i = 0; i < testvalue.size(); ++i) {
+        EXPECT_EQ(wear_leveling_write(i, &testvalue[i], 1), WEAR_LEVELING_SUCCESS) << "Write should have succeeded";
+    }
+    EXPECT_EQ(wear_leveling_commit(), WEAR_LEVELING_CONSOLIDATED) << "Commit should have consolidated";
+
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Erase should have been invoked once";
+    EXPECT_EQ(inst.write_invoke_count(), (WEAR_LEVELING_LOGICAL_SIZE + 8) / sizeof(backing_store_int_t)) << "Only the consolidated data and its checksum should have been written";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init should have succeeded";
+    wear_leveling_read(0, readback.data(), readback.size());
+    EXPECT_EQ(readback, testvalue) << "Invalid readback";
+}
@@ -153,7 +153,99 @@
         ║  │Address >> 1 ║
         ║  └── Value: 1  ║
         ╚════════════════╝
-        0 <= Address <= 0x3FFE (16382) */
+        0 <= Address <= 0x3FFE (16382)
+
+    Checkpoints:
+
+        With a single bank, a checkpoint is appended every time another
+        WEAR_LEVELING_CHECKPOINT_INTERVAL bytes of the write log have been
+        used. It holds a checksum of the logical data at that point:
+
+        ╔ Checkpoint ═══════════════════════════════════════════════════════════╗
+        ║00000000║00000001║CCCCCCCC║CCCCCCCC║00000000║00000001║CCCCCCCC║CCCCCCCC║
+        ║        ║        ║└──────┬────────┘║        ║        ║└──────┬────────┘║
+        ║        ║        ║ Checksum[15:0]  ║        ║        ║ Checksum[31:16] ║
+        ╚════════╩════════╩═════════════════╩════════╩════════╩═════════════════╝
+
+        Each half is a multi-byte entry of zero length, addressed somewhere in
+        the first 512 bytes, which firmware without checkpoints plays back as
+        a write of nothing -- downgrading keeps the EEPROM contents.
+
+        The checksum is the sum of every byte of logical data multiplied by an
+        odd weight depending on its address, so it's kept up to date as the
+        cache changes rather than recalculated: writing a checkpoint, and
+        checking one during playback, costs next to nothing.
+
+        On startup, if the write log is too short to hold a checkpoint, the
+        consolidated data is checked against its FNV1a_64 as it's read.
+        Otherwise the checksum is calculated as the consolidated data is read,
+        and every checkpoint is checked during playback. A matching checkpoint
+        vouches for the consolidated data and all of the write log before it,
+        so the FNV1a_64 is only checked, re-reading the consolidated data a
+        chunk at a time, if none matches. If a checkpoint after the last
+        matching one doesn't match, the write log after the last matching one
+        is damaged: the cache is rebuilt from the consolidated data and the
+        write log up to the last matching checkpoint only, and consolidated
+        straight away to get rid of the rest.
+
+        With a single bank the write log holds the only copy of everything
+        written since the last consolidation, so it always has to be played
+        back in full -- what checkpoints save is checking the consolidated
+        data, and they bound what's lost to damage in the write log.
+
+    Compressed snapshot:
+
+        With WEAR_LEVELING_COMPRESSION defined (single bank only), the
+        consolidated data is stored compressed, and the write log starts
+        directly after it rather than at a fixed offset:
+
+        ╔ Snapshot Header ══════════════════════════════════════════════════════╗
+        ║LLLLLLLL║LLLLLLLL║LLLLLLLL║LLLLLLLL║MMMMMMMM║MMMMMMMM║MMMMMMMM║MMMMMMMM║
+        ║└──────────────┬──────────────────┘║└──────────────┬──────────────────┘║
+        ║            Length                 ║      Length ^ SNAPSHOT_MAGIC      ║
+        ╚═══════════════════════════════════╩═══════════════════════════════════╝
+
+        The header is followed by the FNV1a_64 of the compressed bytes, then
+        the compressed bytes themselves, padded with zeros to a multiple of 8.
+        An all-zero header is an empty snapshot on a blank backing store.
+
+        The compressed bytes are a sequence of runs, each starting with a
+        control byte:
+
+            0XXXXXXX -- XXXXXXX+1 bytes follow, copied verbatim
+            1XXXXXXX -- XXXXXXX+1 zero bytes
+
+        Decompression stops once the logical size has been filled.
+
+        The header is written first, then the compressed bytes, then the
+        FNV1a_64. Checkpoints aren't written, as the FNV1a_64 is checked
+        while decompressing anyway.
+
+    Dual-bank layout:
+
+        With WEAR_LEVELING_DUAL_BANK defined, the backing store is split into
+        two banks of equal size. Each is laid out as above, with an extra bank
+        marker between the FNV1a_64 and the write log:
+
+        ╔ Bank Marker ══════════════════════════════════════════════════════════╗
+        ║GGGGGGGG║GGGGGGGG║GGGGGGGG║GGGGGGGG║MMMMMMMM║MMMMMMMM║MMMMMMMM║MMMMMMMM║
+        ║└──────────────┬──────────────────┘║└──────────────┬──────────────────┘║
+        ║          Generation               ║     WEAR_LEVELING_BANK_MAGIC      ║
+        ╚═══════════════════════════════════╩═══════════════════════════════════╝
+
+        Only one bank is active at a time. Once its write log is more than
+        WEAR_LEVELING_CONSOLIDATE_THRESHOLD percent full, wear_leveling_task()
+        copies the cache into the other, erased, bank a few writes at a time.
+        Writes made in the meantime are appended to the write logs of both
+        banks. The FNV1a_64 and the bank marker with the next generation are
+        written last, which is what switches banks -- on startup the valid bank
+        with the latest generation is used, so a power loss at any point leaves
+        a complete bank to fall back on. The previous bank is then erased in
+        the background, ready for the next consolidation.
+
+        Consolidation only happens in-line with a write if the write log fills
+        up before the background task has caught up. */
+
 
 /**
  * Storage area for the wear-leveling cache.
@@ -162,8 +254,50 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+    uint8_t                                                        transaction_depth;
+    uint8_t                                                        dirty_count;
+    struct {
+        uint32_t start;
+        uint32_t end;
+    } dirty[(WEAR_LEVELING_TRANSACTION_RANGES)]; // ranges modified during the current transaction, in order of modification
+#ifdef WEAR_LEVELING_CHECKPOINTS
+    uint32_t checksum;        // checksum of the cache, see the checkpoint format above
+    uint32_t next_checkpoint; // write log address from which the next checkpoint is appended
+    uint32_t checkpoint_end;  // during playback, end of the last matching checkpoint, or zero
+    bool     mismatch;        // during playback, a checkpoint after the last matching one didn't match
+    bool     verified;        // the consolidated data was checked before playback, so checkpoints aren't checked
+#endif                        // WEAR_LEVELING_CHECKPOINTS
+#ifdef WEAR_LEVELING_COMPRESSION
+    uint32_t log_address; // start of the write log, directly after the compressed snapshot
+#endif                    // WEAR_LEVELING_COMPRESSION
+#ifdef WEAR_LEVELING_DUAL_BANK
+    uint32_t bank_address;          // start of the active bank
+    uint32_t generation;            // generation of the active bank
+    uint8_t  spare_state;           // state of the other bank, see below
+    uint32_t spare_progress;        // progress of the background work on the other bank
+    uint32_t spare_write_address;   // next write log slot of the other bank while consolidating
+    uint64_t spare_checksum;        // FNV1a_64 of the data copied so far while consolidating
+#endif                              // WEAR_LEVELING_DUAL_BANK
 } wear_leveling;
 
+#ifdef WEAR_LEVELING_DUAL_BANK
+/**
+ * State of the bank that is not in use.
+ */
+enum {
+    SPARE_BANK_UNKNOWN,      //< Not yet checked, scanning to see if it needs erasing
+    SPARE_BANK_DIRTY,        //< Being erased
+    SPARE_BANK_ERASED,       //< Ready for the next consolidation
+    SPARE_BANK_CONSOLIDATING //< Cache being copied across
+};
+
+#    define WEAR_LEVELING_SPARE_BANK_ADDRESS ((WEAR_LEVELING_BANK_SIZE) - wear_leveling.bank_address)
+#elif defined(WEAR_LEVELING_COMPRESSION)
+#    define WEAR_LEVELING_LOG_START (wear_leveling.log_address)
+#else
+#    define WEAR_LEVELING_LOG_START (WEAR_LEVELING_LOG_OFFSET)
+#endif // WEAR_LEVELING_DUAL_BANK
+
 /**
  * Locking helper: status
  */
@@ -202,18 +336,89 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
  */
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+    wear_leveling.dirty_count = 0;
+#ifdef WEAR_LEVELING_DUAL_BANK
+    wear_leveling.write_address = wear_leveling.bank_address + (WEAR_LEVELING_LOG_OFFSET);
+#else
+    wear_leveling.write_address = WEAR_LEVELING_LOG_START;
+#endif
+#ifdef WEAR_LEVELING_CHECKPOINTS
+    wear_leveling.checksum        = 0;
+    wear_leveling.next_checkpoint = (WEAR_LEVELING_LOG_OFFSET) + (WEAR_LEVELING_CHECKPOINT_INTERVAL);
+#endif
 }
 
+#ifdef WEAR_LEVELING_CHECKPOINTS
 /**
- * Reads the consolidated data from the backing store into the cache.
+ * Weight of a byte of logical data in the checkpoint checksum. Always odd, so that changing any single byte changes the checksum.
+ */
+static inline uint32_t wear_leveling_checksum_weight(uint32_t address) {
+    return ((address << 1) | 1) * 0x9E3779B1UL;
+}
+
+/**
+ * Calculates the checkpoint checksum of the whole cache, once it's been read from the consolidated data.
+ */
+static void wear_leveling_checksum_reset(void) {
+    wear_leveling.checksum = 0;
+    for (uint32_t i = 0; i < (WEAR_LEVELING_LOGICAL_SIZE); ++i) {
+        wear_leveling.checksum += wear_leveling.cache[i] * wear_leveling_checksum_weight(i);
+    }
+}
+#endif // WEAR_LEVELING_CHECKPOINTS
+
+/**
+ * Updates the cache with logical data, keeping the checkpoint checksum in step.
+ */
+static void wear_leveling_cache_update(uint32_t address, const void *value, size_t length) {
+#ifdef WEAR_LEVELING_CHECKPOINTS
+    const uint8_t *p = value;
+    for (size_t i = 0; i < length; ++i) {
+        wear_leveling.checksum += ((uint32_t)p[i] - wear_leveling.cache[address + i]) * wear_leveling_checksum_weight(address + i);
+    }
+#endif // WEAR_LEVELING_CHECKPOINTS
+    memcpy(&wear_leveling.cache[address], value, length);
+}
+
+/**
+ * Reads an 8-byte record, such as the FNV1a_64 of the consolidated area, from the backing store.
+ */
+static bool wear_leveling_read_record(uint32_t address, write_log_entry_t *entry) {
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_read_bulk(address, entry->raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_read_bulk(address, entry->raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_read(address, &entry->raw64);
+#endif
+}
+
+/**
+ * Writes an 8-byte record, such as the FNV1a_64 of the consolidated area, to the backing store.
+ */
+static bool wear_leveling_write_record(uint32_t address, write_log_entry_t *entry) {
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_write_bulk(address, entry->raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_write_bulk(address, entry->raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_write(address, entry->raw64);
+#endif
+}
+
+#if !defined(WEAR_LEVELING_CHECKPOINTS) && !defined(WEAR_LEVELING_COMPRESSION)
+/**
+ * Reads the consolidated data starting at the supplied address of the backing store into the cache.
  * Does not consider the write log.
+ *
+ * @param valid[out] whether the checksum matched -- if not, the cache is cleared
  */
-static wear_leveling_status_t wear_leveling_read_consolidated(void) {
+static wear_leveling_status_t wear_leveling_read_consolidated_from(uint32_t address, bool *valid) {
     wl_dprintf("Reading consolidated data\n");
 
+    *valid                        = false;
     wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
-    if (!backing_store_read_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    if (!backing_store_read_bulk(address, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to read from backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
@@ -223,17 +428,12 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
         uint64_t          expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
         write_log_entry_t entry;
         wl_dprintf("Reading checksum\n");
-#if BACKING_STORE_WRITE_SIZE == 2
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
-#elif BACKING_STORE_WRITE_SIZE == 4
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
-#elif BACKING_STORE_WRITE_SIZE == 8
-        backing_store_read((WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
-#endif
+        wear_leveling_read_record(address + (WEAR_LEVELING_LOGICAL_SIZE), &entry);
         // If we have a mismatch, clear the cache but do not flag a failure,
         // which will cater for the completely clean MCU case.
         if (entry.raw64 == expected) {
             wl_dprintf("Checksum matches, consolidated data is correct\n");
+            *valid = true;
         } else {
             wl_dprintf("Checksum mismatch, clearing cache\n");
             wear_leveling_clear_cache();
@@ -247,18 +447,301 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
 
     return status;
 }
+#endif // !defined(WEAR_LEVELING_CHECKPOINTS) && !defined(WEAR_LEVELING_COMPRESSION)
+
+#if defined(WEAR_LEVELING_CHECKPOINTS)
+// Last slot of the write log that has to be in use before the first checkpoint is appended
+#    define WEAR_LEVELING_CHECKPOINT_SLOT ((WEAR_LEVELING_LOG_OFFSET) + ((WEAR_LEVELING_CHECKPOINT_INTERVAL) + (BACKING_STORE_WRITE_SIZE)-1) / (BACKING_STORE_WRITE_SIZE) * (BACKING_STORE_WRITE_SIZE) - (BACKING_STORE_WRITE_SIZE))
+
+/**
+ * Reads the consolidated data from the backing store into the cache.
+ * If the write log is long enough to hold a checkpoint, verifying the data is left until the write log has been played
+ * back, as a checkpoint can vouch for it far more cheaply. Otherwise it's checked against its FNV1a_64 straight away,
+ * rather than having to read it again after playback.
+ * Does not consider the write log.
+ */
+static wear_leveling_status_t wear_leveling_read_consolidated(void) {
+    wl_dprintf("Reading consolidated data\n");
+    wear_leveling.verified       = false;
+    wear_leveling.mismatch       = false;
+    wear_leveling.checkpoint_end = 0;
+    if (!backing_store_read_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+        wl_dprintf("Failed to read from backing store\n");
+        wear_leveling_clear_cache();
+        return WEAR_LEVELING_FAILED;
+    }
+    wear_leveling_checksum_reset();
+
+    backing_store_int_t slot = 0;
+    if ((WEAR_LEVELING_CHECKPOINT_SLOT) < (WEAR_LEVELING_BACKING_SIZE) && !backing_store_read_bulk((WEAR_LEVELING_CHECKPOINT_SLOT), &slot, 1)) {
+        wl_dprintf("Failed to read from backing store\n");
+        wear_leveling_clear_cache();
+        return WEAR_LEVELING_FAILED;
+    }
+    if (slot != 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    write_log_entry_t entry;
+    wl_dprintf("Reading checksum\n");
+    if (!wear_leveling_read_record((WEAR_LEVELING_LOGICAL_SIZE), &entry)) {
+        wear_leveling_clear_cache();
+        return WEAR_LEVELING_FAILED;
+    }
+    if (entry.raw64 != fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT)) {
+        // If we have a mismatch, clear the cache but do not flag a failure, which will cater for the completely clean MCU case.
+        wl_dprintf("Checksum mismatch, clearing cache\n");
+        wear_leveling_clear_cache();
+    }
+
+    // Either way, there's nothing left to check after playback
+    wear_leveling.verified = true;
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Verifies the consolidated data at the supplied address of the backing store against its FNV1a_64, reading it back a chunk at a time.
+ * Used once the cache no longer holds the consolidated data, i.e. after the write log has been played back.
+ *
+ * @param valid[out] whether the checksum matched
+ */
+static wear_leveling_status_t wear_leveling_verify_consolidated_at(uint32_t address, bool *valid) {
+    backing_store_int_t chunk[(WEAR_LEVELING_PLAYBACK_CHUNK)];
+    uint64_t            hash      = FNV1A_64_INIT;
+    uint32_t            remaining = (WEAR_LEVELING_LOGICAL_SIZE);
+
+    *valid = false;
+    while (remaining > 0) {
+        uint32_t length = remaining < sizeof(chunk) ? remaining : sizeof(chunk);
+        if (!backing_store_read_bulk(address, chunk, length / sizeof(backing_store_int_t))) {
+            wl_dprintf("Failed to read from backing store\n");
+            return WEAR_LEVELING_FAILED;
+        }
+        hash = fnv_64a_buf(chunk, length, hash);
+        address += length;
+        remaining -= length;
+    }
+
+    write_log_entry_t entry;
+    wl_dprintf("Reading checksum\n");
+    if (!wear_leveling_read_record(address, &entry)) {
+        return WEAR_LEVELING_FAILED;
+    }
+    *valid = entry.raw64 == hash;
+    return WEAR_LEVELING_SUCCESS;
+}
+#elif defined(WEAR_LEVELING_COMPRESSION)
+/**
+ * Reads the compressed snapshot from the backing store into the cache, decompressing it as it's read.
+ * Does not consider the write log, but works out where it starts.
+ * If the snapshot doesn't match its FNV1a_64 the cache is cleared, and if its header is damaged the write log
+ * can't be found either, so it's skipped and consolidation is forced instead.
+ */
+static wear_leveling_status_t wear_leveling_read_consolidated(void) {
+    wl_dprintf("Reading compressed snapshot\n");
+
+    write_log_entry_t header;
+    write_log_entry_t checksum;
+    if (!wear_leveling_read_record(0, &header) || !wear_leveling_read_record(8, &checksum)) {
+        wl_dprintf("Failed to read from backing store\n");
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // An all-zero header is a blank backing store, i.e. an empty snapshot
+    uint32_t length = header.raw32[0];
+    if (header.raw64 != 0 && (header.raw32[1] != (length ^ (WEAR_LEVELING_SNAPSHOT_MAGIC)) || length % 8 != 0 || length > (WEAR_LEVELING_SNAPSHOT_MAX_SIZE))) {
+        wl_dprintf("Invalid snapshot header, skipping write log\n");
+        wear_leveling.log_address = (WEAR_LEVELING_BACKING_SIZE);
+        wear_leveling_clear_cache();
+        return WEAR_LEVELING_SUCCESS;
+    }
+    wear_leveling.log_address = (WEAR_LEVELING_SNAPSHOT_OFFSET) + length;
+
+    // See the compressed snapshot format in the documentation header at the top of the file
+    backing_store_int_t chunk[(WEAR_LEVELING_PLAYBACK_CHUNK)];
+    uint64_t            hash    = FNV1A_64_INIT;
+    uint32_t            address = (WEAR_LEVELING_SNAPSHOT_OFFSET);
+    uint32_t            out     = 0;
+    uint8_t             literal = 0;
+    bool                valid   = true;
+    while (address < wear_leveling.log_address) {
+        uint32_t count = (wear_leveling.log_address - address) / (BACKING_STORE_WRITE_SIZE);
+        if (count > (WEAR_LEVELING_PLAYBACK_CHUNK)) {
+            count = (WEAR_LEVELING_PLAYBACK_CHUNK);
+        }
+        if (!backing_store_read_bulk(address, chunk, count)) {
+            wl_dprintf("Failed to read from backing store\n");
+            wear_leveling_clear_cache();
+            return WEAR_LEVELING_FAILED;
+        }
+        hash = fnv_64a_buf(chunk, count * (BACKING_STORE_WRITE_SIZE), hash);
+        address += count * (BACKING_STORE_WRITE_SIZE);
+
+        const uint8_t *p = (const uint8_t *)chunk;
+        for (uint32_t i = 0; i < count * (BACKING_STORE_WRITE_SIZE) && out < (WEAR_LEVELING_LOGICAL_SIZE); ++i) {
+            if (literal > 0) {
+                wear_leveling.cache[out++] = p[i];
+                --literal;
+            } else if (p[i] & 0x80) {
+                uint32_t run = (p[i] & 0x7F) + 1;
+                if (out + run > (WEAR_LEVELING_LOGICAL_SIZE)) {
+                    valid = false;
+                    break;
+                }
+                memset(&wear_leveling.cache[out], 0, run);
+                out += run;
+            } else {
+                literal = p[i] + 1;
+            }
+        }
+    }
+
+    // Anything short of the full logical size is either a blank backing store or damaged
+    if (!valid || out != (WEAR_LEVELING_LOGICAL_SIZE) || checksum.raw64 != hash) {
+        wl_dprintf("Checksum mismatch, clearing cache\n");
+        wear_leveling_clear_cache();
+    }
+    return WEAR_LEVELING_SUCCESS;
+}
+#elif !defined(WEAR_LEVELING_DUAL_BANK)
+/**
+ * Reads the consolidated data from the backing store into the cache.
+ * Does not consider the write log.
+ */
+static wear_leveling_status_t wear_leveling_read_consolidated(void) {
+    bool valid;
+    return wear_leveling_read_consolidated_from(0, &valid);
+}
+#endif
+
+#ifdef WEAR_LEVELING_COMPRESSION
+/**
+ * Output of the compressed snapshot, staged 8 bytes at a time so it can be written with any backing store write size.
+ */
+typedef struct {
+    uint32_t          address; // backing store address of the staged bytes
+    uint32_t          length;  // number of bytes output so far
+    uint64_t          hash;    // FNV1a_64 of the bytes written so far
+    bool              write;   // whether to write to the backing store, or just measure the length
+    bool              failed;  // whether a write to the backing store failed
+    write_log_entry_t staged;
+} wear_leveling_snapshot_writer_t;
+
+/**
+ * Outputs a byte of the compressed snapshot, writing out the staged bytes once there are 8 of them.
+ */
+static void wear_leveling_snapshot_put(wear_leveling_snapshot_writer_t *writer, uint8_t value) {
+    writer->staged.raw8[writer->length % 8] = value;
+    if (++writer->length % 8 != 0) {
+        return;
+    }
+    if (writer->write && !writer->failed) {
+        writer->hash = fnv_64a_buf(writer->staged.raw8, 8, writer->hash);
+        if (!wear_leveling_write_record(writer->address, &writer->staged)) {
+            writer->failed = true;
+        }
+    }
+    writer->address += 8;
+    writer->staged.raw64 = 0;
+}
+
+/**
+ * Compresses the cache. See the compressed snapshot format in the documentation header at the top of the file.
+ */
+static void wear_leveling_snapshot_compress(wear_leveling_snapshot_writer_t *writer) {
+    const uint8_t *cache = wear_leveling.cache;
+    uint32_t       i     = 0;
+    while (i < (WEAR_LEVELING_LOGICAL_SIZE)) {
+        // Runs of two or more zeros are elided
+        uint32_t run = 0;
+        while (i + run < (WEAR_LEVELING_LOGICAL_SIZE) && run < 128 && cache[i + run] == 0) {
+            ++run;
+        }
+        if (run >= 2) {
+            wear_leveling_snapshot_put(writer, 0x80 | (run - 1));
+            i += run;
+            continue;
+        }
+
+        // Anything else is copied verbatim, up until the next run of zeros
+        run = 0;
+        while (i + run < (WEAR_LEVELING_LOGICAL_SIZE) && run < 128 && !(cache[i + run] == 0 && i + run + 1 < (WEAR_LEVELING_LOGICAL_SIZE) && cache[i + run + 1] == 0)) {
+            ++run;
+        }
+        wear_leveling_snapshot_put(writer, run - 1);
+        for (uint32_t j = 0; j < run; ++j) {
+            wear_leveling_snapshot_put(writer, cache[i + j]);
+        }
+        i += run;
+    }
+
+    // Pad out to a whole record, padding is ignored once the logical size has been filled
+    while (writer->length % 8 != 0) {
+        wear_leveling_snapshot_put(writer, 0);
+    }
+}
+
+/**
+ * Writes the current cache as a compressed snapshot at the start of the backing store, and works out where the write log now starts.
+ * Does not clear the write log.
+ * Pre-condition: this is just after an erase, so we can write directly without reading.
+ */
+static wear_leveling_status_t wear_leveling_write_snapshot(void) {
+    wl_dprintf("Writing compressed snapshot\n");
 
+    // Measure the snapshot first, so the header can be written ahead of it
+    wear_leveling_snapshot_writer_t writer = {.address = (WEAR_LEVELING_SNAPSHOT_OFFSET), .hash = FNV1A_64_INIT};
+    wear_leveling_snapshot_compress(&writer);
+    wear_leveling.log_address = (WEAR_LEVELING_SNAPSHOT_OFFSET) + writer.length;
+    wl_dprintf("Compressed %d bytes into %d\n", (int)(WEAR_LEVELING_LOGICAL_SIZE), (int)writer.length);
+
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    wear_leveling_status_t      status      = WEAR_LEVELING_CONSOLIDATED;
+
+    write_log_entry_t header;
+    header.raw32[0] = writer.length;
+    header.raw32[1] = writer.length ^ (WEAR_LEVELING_SNAPSHOT_MAGIC);
+    if (!wear_leveling_write_record(0, &header)) {
+        wl_dprintf("Failed to write to backing store\n");
+        status = WEAR_LEVELING_FAILED;
+    }
+
+    if (status != WEAR_LEVELING_FAILED) {
+        writer = (wear_leveling_snapshot_writer_t){.address = (WEAR_LEVELING_SNAPSHOT_OFFSET), .hash = FNV1A_64_INIT, .write = true};
+        wear_leveling_snapshot_compress(&writer);
+        if (writer.failed) {
+            wl_dprintf("Failed to write to backing store\n");
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    if (status != WEAR_LEVELING_FAILED) {
+        // Write out the FNV1a_64 result of the snapshot last, a partially written snapshot won't match it
+        write_log_entry_t entry;
+        entry.raw64 = writer.hash;
+        wl_dprintf("Writing checksum\n");
+        if (!wear_leveling_write_record(8, &entry)) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        wear_leveling_lock();
+    }
+    return status;
+}
+#else
 /**
- * Writes the current cache to consolidated data at the beginning of the backing store.
+ * Writes the current cache to consolidated data at the supplied address of the backing store.
  * Does not clear the write log.
  * Pre-condition: this is just after an erase, so we can write directly without reading.
  */
-static wear_leveling_status_t wear_leveling_write_consolidated(void) {
+static wear_leveling_status_t wear_leveling_write_consolidated_to(uint32_t address) {
     wl_dprintf("Writing consolidated data\n");
 
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     wear_leveling_status_t      status      = WEAR_LEVELING_CONSOLIDATED;
-    if (!backing_store_write_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    if (!backing_store_write_bulk(address, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to write to backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
@@ -268,32 +751,259 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
         write_log_entry_t entry;
         entry.raw64 = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
         wl_dprintf("Writing checksum\n");
-        do {
-#if BACKING_STORE_WRITE_SIZE == 2
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 4
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2)) {
-                status = WEAR_LEVELING_FAILED;
+        if (!wear_leveling_write_record(address + (WEAR_LEVELING_LOGICAL_SIZE), &entry)) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        wear_leveling_lock();
+    }
+    return status;
+}
+#endif // WEAR_LEVELING_COMPRESSION
+
+#ifdef WEAR_LEVELING_DUAL_BANK
+/**
+ * Reads the marker of the bank at the supplied address.
+ *
+ * @return true if the bank has been completely written
+ */
+static bool wear_leveling_read_bank_marker(uint32_t bank_address, uint32_t *generation) {
+    write_log_entry_t entry;
+    if (!wear_leveling_read_record(bank_address + (WEAR_LEVELING_LOGICAL_SIZE) + 8, &entry)) {
+        return false;
+    }
+    *generation = entry.raw32[0];
+    return entry.raw32[1] == (WEAR_LEVELING_BANK_MAGIC);
+}
+
+/**
+ * Writes the marker of the bank at the supplied address, making it the one used from now on.
+ */
+static bool wear_leveling_write_bank_marker(uint32_t bank_address, uint32_t generation) {
+    write_log_entry_t entry;
+    entry.raw32[0] = generation;
+    entry.raw32[1] = (WEAR_LEVELING_BANK_MAGIC);
+    return wear_leveling_write_record(bank_address + (WEAR_LEVELING_LOGICAL_SIZE) + 8, &entry);
+}
+
+/**
+ * Erases the whole backing store and lays out the first bank from the current cache.
+ * During this operation, there is the potential for data loss if a power loss occurs.
+ */
+static wear_leveling_status_t wear_leveling_format(void) {
+    wl_dprintf("Formatting backing store\n");
+
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = WEAR_LEVELING_FAILED;
+    if (backing_store_erase()) {
+        status = wear_leveling_write_consolidated_to(0);
+        if (status != WEAR_LEVELING_FAILED && !wear_leveling_write_bank_marker(0, wear_leveling.generation + 1)) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    } else {
+        wl_dprintf("Failed to erase backing store\n");
+    }
+
+    wear_leveling.bank_address   = 0;
+    wear_leveling.generation     = wear_leveling.generation + 1;
+    wear_leveling.write_address  = (WEAR_LEVELING_LOG_OFFSET);
+    wear_leveling.spare_state    = status == WEAR_LEVELING_FAILED ? SPARE_BANK_UNKNOWN : SPARE_BANK_ERASED;
+    wear_leveling.spare_progress = 0;
+
+    if (lock_status == STATUS_SUCCESS) {
+        wear_leveling_lock();
+    }
+    return status;
+}
+
+/**
+ * Whether the write log of the active bank is full enough that consolidation should start.
+ */
+static inline bool wear_leveling_consolidation_due(void) {
+    uint32_t used = wear_leveling.write_address - (wear_leveling.bank_address + (WEAR_LEVELING_LOG_OFFSET));
+    return used * 100 >= ((WEAR_LEVELING_BANK_SIZE) - (WEAR_LEVELING_LOG_OFFSET)) * (WEAR_LEVELING_CONSOLIDATE_THRESHOLD);
+}
+
+/**
+ * Performs some of the work on the spare bank -- checking it is blank, erasing it, or copying the cache across.
+ * The backing store must already be unlocked.
+ *
+ * @param budget[in] the maximum number of backing store writes or reads to perform
+ * @param start[in] whether to start consolidating even if the write log is not yet full enough
+ * @return WEAR_LEVELING_CONSOLIDATED once the banks have been switched
+ */
+static wear_leveling_status_t wear_leveling_consolidate_step(size_t budget, bool start) {
+    const uint32_t spare_address = WEAR_LEVELING_SPARE_BANK_ADDRESS;
+
+    while (budget > 0) {
+        switch (wear_leveling.spare_state) {
+            case SPARE_BANK_UNKNOWN: {
+                // Left over from before a reset, so it may be partially written -- only erase it if needed
+                backing_store_int_t value;
+                if (!backing_store_read(spare_address + wear_leveling.spare_progress, &value)) {
+                    return WEAR_LEVELING_FAILED;
+                }
+                wear_leveling.spare_progress += (BACKING_STORE_WRITE_SIZE);
+                if (value != 0) {
+                    wear_leveling.spare_state    = SPARE_BANK_DIRTY;
+                    wear_leveling.spare_progress = 0;
+                } else if (wear_leveling.spare_progress >= (WEAR_LEVELING_BANK_SIZE)) {
+                    wear_leveling.spare_state = SPARE_BANK_ERASED;
+                }
+                --budget;
+            } break;
+
+            case SPARE_BANK_DIRTY:
+                wl_dprintf("Erasing spare bank\n");
+                if (!backing_store_erase_range(spare_address + wear_leveling.spare_progress, (WEAR_LEVELING_ERASE_STEP))) {
+                    wl_dprintf("Failed to erase backing store\n");
+                    return WEAR_LEVELING_FAILED;
+                }
+                wear_leveling.spare_progress += (WEAR_LEVELING_ERASE_STEP);
+                if (wear_leveling.spare_progress >= (WEAR_LEVELING_BANK_SIZE)) {
+                    wear_leveling.spare_state = SPARE_BANK_ERASED;
+                }
+                // An erase is expensive, so it's the only thing done this step
+                budget = 0;
                 break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 8
-            if (!backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64)) {
-                status = WEAR_LEVELING_FAILED;
+
+            case SPARE_BANK_ERASED:
+                if (!start && !wear_leveling_consolidation_due()) {
+                    return WEAR_LEVELING_SUCCESS;
+                }
+                wl_dprintf("Consolidating into spare bank\n");
+                wear_leveling.spare_state         = SPARE_BANK_CONSOLIDATING;
+                wear_leveling.spare_progress      = 0;
+                wear_leveling.spare_write_address = spare_address + (WEAR_LEVELING_LOG_OFFSET);
+                wear_leveling.spare_checksum      = FNV1A_64_INIT;
                 break;
+
+            case SPARE_BANK_CONSOLIDATING: {
+                if (wear_leveling.spare_progress < (WEAR_LEVELING_LOGICAL_SIZE)) {
+                    // Copy the next chunk of the cache. Zeros are skipped, the bank is already erased.
+                    const uint8_t      *p     = &wear_leveling.cache[wear_leveling.spare_progress];
+                    backing_store_int_t value = *(const backing_store_int_t *)p;
+                    if (value != 0 && !backing_store_write(spare_address + wear_leveling.spare_progress, value)) {
+                        wear_leveling.spare_state    = SPARE_BANK_DIRTY;
+                        wear_leveling.spare_progress = 0;
+                        return WEAR_LEVELING_FAILED;
+                    }
+                    // Anything written to the cache from here on is also appended to the spare bank's write log
+                    wear_leveling.spare_checksum = fnv_64a_buf((void *)p, (BACKING_STORE_WRITE_SIZE), wear_leveling.spare_checksum);
+                    wear_leveling.spare_progress += (BACKING_STORE_WRITE_SIZE);
+                    --budget;
+                    break;
+                }
+
+                // The checksum covers what was copied, the write log of the spare bank covers anything since
+                write_log_entry_t entry;
+                entry.raw64 = wear_leveling.spare_checksum;
+                if (!wear_leveling_write_record(spare_address + (WEAR_LEVELING_LOGICAL_SIZE), &entry) || !wear_leveling_write_bank_marker(spare_address, wear_leveling.generation + 1)) {
+                    wl_dprintf("Failed to write bank marker\n");
+                    wear_leveling.spare_state    = SPARE_BANK_DIRTY;
+                    wear_leveling.spare_progress = 0;
+                    return WEAR_LEVELING_FAILED;
+                }
+
+                // Switch over, the previous bank is erased in the background
+                wl_dprintf("Switched to bank at 0x%04X\n", (int)spare_address);
+                wear_leveling.write_address  = wear_leveling.spare_write_address;
+                wear_leveling.bank_address   = spare_address;
+                wear_leveling.generation     = wear_leveling.generation + 1;
+                wear_leveling.spare_state    = SPARE_BANK_DIRTY;
+                wear_leveling.spare_progress = 0;
+                return WEAR_LEVELING_CONSOLIDATED;
             }
-#endif
-        } while (0);
+        }
     }
 
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Finishes consolidation into the spare bank in-line, erasing it first if need be.
+ * The active bank is left untouched, so there is no data loss if a power loss occurs.
+ */
+static wear_leveling_status_t wear_leveling_consolidate_force(void) {
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status;
+    do {
+        status = wear_leveling_consolidate_step(SIZE_MAX, true);
+    } while (status == WEAR_LEVELING_SUCCESS);
+
     if (lock_status == STATUS_SUCCESS) {
         wear_leveling_lock();
     }
     return status;
 }
 
+/**
+ * Consolidates in-line if the current write log position is at the end of the active bank.
+ * Otherwise, consolidation is left to wear_leveling_task().
+ *
+ * @return true if consolidation occurred
+ */
+static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
+    if (wear_leveling.write_address >= wear_leveling.bank_address + (WEAR_LEVELING_BANK_SIZE)) {
+        return wear_leveling_consolidate_force();
+    }
+
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Appends the supplied log entry to the write log, consolidating first if it does not fit.
+ * While consolidation is in progress, it is appended to the spare bank's write log as well.
+ *
+ * @return true if consolidation occurred
+ */
+static wear_leveling_status_t wear_leveling_append_entry(backing_store_int_t *values, size_t count) {
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    const uint32_t         length = count * (BACKING_STORE_WRITE_SIZE);
+
+    // Log entries are never split across a bank switch
+    for (int attempt = 0; wear_leveling.write_address + length > wear_leveling.bank_address + (WEAR_LEVELING_BANK_SIZE); ++attempt) {
+        if (attempt == 2) {
+            return WEAR_LEVELING_FAILED;
+        }
+        status = wear_leveling_consolidate_force();
+        if (status == WEAR_LEVELING_FAILED) {
+            return status;
+        }
+    }
+
+    if (!backing_store_write_bulk(wear_leveling.write_address, values, count)) {
+        wl_dprintf("Failed to write to backing store\n");
+        return WEAR_LEVELING_FAILED;
+    }
+    wear_leveling.write_address += length;
+
+    if (wear_leveling.spare_state == SPARE_BANK_CONSOLIDATING) {
+        if (!backing_store_write_bulk(wear_leveling.spare_write_address, values, count)) {
+            wl_dprintf("Failed to write to backing store\n");
+            wear_leveling.spare_state    = SPARE_BANK_DIRTY;
+            wear_leveling.spare_progress = 0;
+            return WEAR_LEVELING_FAILED;
+        }
+        wear_leveling.spare_write_address += length;
+    }
+
+    return status;
+}
+#else  // WEAR_LEVELING_DUAL_BANK
+
 /**
  * Forces a write of the current cache.
  * Erases the backing store, including the write log.
@@ -310,13 +1020,20 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     }
 
     // Write the cache to the first section of the backing store.
-    wear_leveling_status_t status = wear_leveling_write_consolidated();
+#    ifdef WEAR_LEVELING_COMPRESSION
+    wear_leveling_status_t status = wear_leveling_write_snapshot();
+#    else
+    wear_leveling_status_t status = wear_leveling_write_consolidated_to(0);
+#    endif
     if (status == WEAR_LEVELING_FAILED) {
         wl_dprintf("Failed to write consolidated data\n");
     }
 
     // Next write of the log occurs after the consolidated values at the start of the backing store.
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling.write_address = WEAR_LEVELING_LOG_START;
+#    ifdef WEAR_LEVELING_CHECKPOINTS
+    wear_leveling.next_checkpoint = (WEAR_LEVELING_LOG_OFFSET) + (WEAR_LEVELING_CHECKPOINT_INTERVAL);
+#    endif
 
     return status;
 }
@@ -351,6 +1068,65 @@ static wear_leveling_status_t wear_leveling_append_raw(backing_store_int_t value
     return wear_leveling_consolidate_if_needed();
 }
 
+/**
+ * Appends the supplied log entry to the write log, one fixed-width write at a time.
+ * If consolidation occurs part way through, the rest of the entry is skipped as the cache has already been written.
+ *
+ * @return true if consolidation occurred
+ */
+static wear_leveling_status_t wear_leveling_append_entry(backing_store_int_t *values, size_t count) {
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    for (size_t i = 0; i < count; ++i) {
+        status = wear_leveling_append_raw(values[i]);
+        if (status != WEAR_LEVELING_SUCCESS) {
+            return status;
+        }
+    }
+    return status;
+}
+
+#    ifdef WEAR_LEVELING_CHECKPOINTS
+/**
+ * Appends a checkpoint to the write log, once enough of it has been written since the previous one.
+ * Must only be called once the write log has caught up with the cache, i.e. not part way through a transaction.
+ *
+ * @return true if consolidation occurred
+ */
+static wear_leveling_status_t wear_leveling_checkpoint_if_needed(void) {
+    // Not worth it if the log is about to be consolidated anyway
+    if (wear_leveling.write_address < wear_leveling.next_checkpoint || wear_leveling.write_address + 8 > (WEAR_LEVELING_BACKING_SIZE)) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Writing checkpoint\n");
+    write_log_entry_t log         = LOG_ENTRY_MAKE_CHECKPOINT(wear_leveling.checksum);
+    wear_leveling.next_checkpoint = wear_leveling.write_address + 8 + (WEAR_LEVELING_CHECKPOINT_INTERVAL);
+#        if BACKING_STORE_WRITE_SIZE == 2
+    return wear_leveling_append_entry(log.raw16, 4);
+#        elif BACKING_STORE_WRITE_SIZE == 4
+    return wear_leveling_append_entry(log.raw32, 2);
+#        elif BACKING_STORE_WRITE_SIZE == 8
+    return wear_leveling_append_entry(&log.raw64, 1);
+#        endif
+}
+#    endif // WEAR_LEVELING_CHECKPOINTS
+#endif     // WEAR_LEVELING_DUAL_BANK
+
+/**
+ * Whether a write can stop early given the status of writing part of it to the write log.
+ *
+ * On failure there's nothing more to be done. With a single bank, consolidation writes out the cache
+ * which already holds the rest of the data. With dual banks, the remaining log entries are still needed
+ * as the consolidated data may have been copied before the cache was updated.
+ */
+static inline bool wear_leveling_write_stop(wear_leveling_status_t status) {
+#ifdef WEAR_LEVELING_DUAL_BANK
+    return status == WEAR_LEVELING_FAILED;
+#else
+    return status != WEAR_LEVELING_SUCCESS;
+#endif
+}
+
 /**
  * Handles writing multi_byte-encoded data to the backing store.
  *
@@ -364,50 +1140,13 @@ static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address
     }
 
     // Write to the backing store. See the multi-byte log format in the documentation header at the top of the file.
-    wear_leveling_status_t status;
 #if BACKING_STORE_WRITE_SIZE == 2
-    status = wear_leveling_append_raw(log.raw16[0]);
-    if (status != WEAR_LEVELING_SUCCESS) {
-        return status;
-    }
-
-    status = wear_leveling_append_raw(log.raw16[1]);
-    if (status != WEAR_LEVELING_SUCCESS) {
-        return status;
-    }
-
-    if (length > 1) {
-        status = wear_leveling_append_raw(log.raw16[2]);
-        if (status != WEAR_LEVELING_SUCCESS) {
-            return status;
-        }
-    }
-
-    if (length > 3) {
-        status = wear_leveling_append_raw(log.raw16[3]);
-        if (status != WEAR_LEVELING_SUCCESS) {
-            return status;
-        }
-    }
+    return wear_leveling_append_entry(log.raw16, 2 + (length > 1 ? 1 : 0) + (length > 3 ? 1 : 0));
 #elif BACKING_STORE_WRITE_SIZE == 4
-    status = wear_leveling_append_raw(log.raw32[0]);
-    if (status != WEAR_LEVELING_SUCCESS) {
-        return status;
-    }
-
-    if (length > 1) {
-        status = wear_leveling_append_raw(log.raw32[1]);
-        if (status != WEAR_LEVELING_SUCCESS) {
-            return status;
-        }
-    }
+    return wear_leveling_append_entry(log.raw32, 1 + (length > 1 ? 1 : 0));
 #elif BACKING_STORE_WRITE_SIZE == 8
-    status = wear_leveling_append_raw(log.raw64);
-    if (status != WEAR_LEVELING_SUCCESS) {
-        return status;
-    }
+    return wear_leveling_append_entry(&log.raw64, 1);
 #endif
-    return status;
 }
 
 /**
@@ -417,19 +1156,23 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     const uint8_t *        p         = value;
     size_t                 remaining = length;
     wear_leveling_status_t status    = WEAR_LEVELING_SUCCESS;
+    wear_leveling_status_t result    = WEAR_LEVELING_SUCCESS;
     while (remaining > 0) {
 #if BACKING_STORE_WRITE_SIZE == 2
         // Small-write optimizations - uint16_t, 0 or 1, address is even, address <16384:
         if (remaining >= 2 && address % 2 == 0 && address < 16384) {
             const uint16_t v = ((uint16_t)p[1]) << 8 | p[0]; // don't just dereference a uint16_t here -- if unaligned it generates faults on some MCUs
             if (v == 0 || v == 1) {
-                const write_log_entry_t log = LOG_ENTRY_MAKE_WORD_01(address, v);
-                status                      = wear_leveling_append_raw(log.raw16[0]);
-                if (status != WEAR_LEVELING_SUCCESS) {
+                write_log_entry_t log = LOG_ENTRY_MAKE_WORD_01(address, v);
+                status                = wear_leveling_append_entry(log.raw16, 1);
+                if (wear_leveling_write_stop(status)) {
                     // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
                     // If a failure occurred, pass it on.
                     return status;
                 }
+                if (status == WEAR_LEVELING_CONSOLIDATED) {
+                    result = status;
+                }
 
                 remaining -= 2;
                 address += 2;
@@ -440,13 +1183,16 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
 
         // Small-write optimizations - address<64:
         if (address < 64) {
-            const write_log_entry_t log = LOG_ENTRY_MAKE_OPTIMIZED_64(address, *p);
-            status                      = wear_leveling_append_raw(log.raw16[0]);
-            if (status != WEAR_LEVELING_SUCCESS) {
+            write_log_entry_t log = LOG_ENTRY_MAKE_OPTIMIZED_64(address, *p);
+            status                = wear_leveling_append_entry(log.raw16, 1);
+            if (wear_leveling_write_stop(status)) {
                 // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
                 // If a failure occurred, pass it on.
                 return status;
             }
+            if (status == WEAR_LEVELING_CONSOLIDATED) {
+                result = status;
+            }
 
             remaining--;
             address++;
@@ -456,112 +1202,227 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
 #endif // BACKING_STORE_WRITE_SIZE == 2
         const size_t this_length = remaining >= LOG_ENTRY_MULTIBYTE_MAX_BYTES ? LOG_ENTRY_MULTIBYTE_MAX_BYTES : remaining;
         status                   = wear_leveling_write_raw_multibyte(address, p, this_length);
-        if (status != WEAR_LEVELING_SUCCESS) {
+        if (wear_leveling_write_stop(status)) {
             // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
             // If a failure occurred, pass it on.
             return status;
         }
+        if (status == WEAR_LEVELING_CONSOLIDATED) {
+            result = status;
+        }
         remaining -= this_length;
         address += (uint32_t)this_length;
         p += this_length;
     }
 
-    return status;
+    return result;
+}
+/**
+ * Records a range of the cache modified during a transaction, merging it with any range it overlaps or touches.
+ * If there are no free ranges left, it's merged with the closest one instead.
+ */
+static void wear_leveling_mark_dirty(uint32_t start, uint32_t end) {
+    while (true) {
+        // Find a range overlapping or touching this one, otherwise the closest one
+        uint8_t  found = wear_leveling.dirty_count;
+        uint32_t best  = UINT32_MAX;
+        for (uint8_t i = 0; i < wear_leveling.dirty_count; ++i) {
+            uint32_t gap = start > wear_leveling.dirty[i].end ? start - wear_leveling.dirty[i].end : (wear_leveling.dirty[i].start > end ? wear_leveling.dirty[i].start - end : 0);
+            if (gap < best) {
+                best  = gap;
+                found = i;
+            }
+        }
+        if (found == wear_leveling.dirty_count || (best > 0 && wear_leveling.dirty_count < (WEAR_LEVELING_TRANSACTION_RANGES))) {
+            break;
+        }
+
+        // Take the range out, keeping the others in order, and widen this one to cover it
+        start = wear_leveling.dirty[found].start < start ? wear_leveling.dirty[found].start : start;
+        end   = wear_leveling.dirty[found].end > end ? wear_leveling.dirty[found].end : end;
+        --wear_leveling.dirty_count;
+        memmove(&wear_leveling.dirty[found], &wear_leveling.dirty[found + 1], (wear_leveling.dirty_count - found) * sizeof(wear_leveling.dirty[0]));
+    }
+
+    wear_leveling.dirty[wear_leveling.dirty_count].start = start;
+    wear_leveling.dirty[wear_leveling.dirty_count].end   = end;
+    ++wear_leveling.dirty_count;
 }
 
 /**
- * "Replays" the write log from the backing store, updating the local cache with updated values.
+ * Upper bound of the number of bytes of write log needed to write the supplied logical range.
  */
-static wear_leveling_status_t wear_leveling_playback_log(void) {
-    wl_dprintf("Playback write log\n");
+static uint32_t wear_leveling_log_size(uint32_t start, uint32_t end) {
+    uint32_t size = 0;
+#if BACKING_STORE_WRITE_SIZE == 2
+    // Each byte below address 64 gets its own log entry
+    if (start < 64) {
+        uint32_t optimized_end = end < 64 ? end : 64;
+        size += (optimized_end - start) * 2;
+        start = optimized_end;
+    }
+#endif // BACKING_STORE_WRITE_SIZE == 2
+    size += ((end - start + LOG_ENTRY_MULTIBYTE_MAX_BYTES - 1) / LOG_ENTRY_MULTIBYTE_MAX_BYTES) * 8;
+    return size;
+}
 
-    wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
-    bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
-    while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
-        backing_store_int_t value;
-        bool                ok = backing_store_read(address, &value);
-        if (!ok) {
-            wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
-            cancel_playback = true;
-            status          = WEAR_LEVELING_FAILED;
-            break;
+/**
+ * Sequential reader over the write log, fetching from the backing store a chunk at a time.
+ */
+typedef struct {
+    uint32_t            address;       // next address to be consumed
+    uint32_t            end;           // end of the write log
+    uint32_t            chunk_address; // address of the first value in the chunk
+    uint8_t             chunk_count;   // number of values in the chunk
+    backing_store_int_t chunk[(WEAR_LEVELING_PLAYBACK_CHUNK)];
+} wear_leveling_log_reader_t;
+
+/**
+ * Fetches the next value of the write log.
+ *
+ * @return false if the end of the write log was reached, or the read failed
+ */
+static bool wear_leveling_log_next(wear_leveling_log_reader_t *reader, backing_store_int_t *value) {
+    if (reader->address >= reader->end) {
+        return false;
+    }
+
+    uint32_t index = (reader->address - reader->chunk_address) / (BACKING_STORE_WRITE_SIZE);
+    if (index >= reader->chunk_count) {
+        uint32_t count = (reader->end - reader->address) / (BACKING_STORE_WRITE_SIZE);
+        if (count > (WEAR_LEVELING_PLAYBACK_CHUNK)) {
+            count = (WEAR_LEVELING_PLAYBACK_CHUNK);
         }
-        if (value == 0) {
-            wl_dprintf("Found empty slot, no more log entries\n");
-            cancel_playback = true;
-            break;
+        if (!backing_store_read_bulk(reader->address, reader->chunk, count)) {
+            wl_dprintf("Failed to load from backing store\n");
+            return false;
         }
+        reader->chunk_address = reader->address;
+        reader->chunk_count   = (uint8_t)count;
+        index                 = 0;
+    }
+
+    *value = reader->chunk[index];
+    reader->address += (BACKING_STORE_WRITE_SIZE);
+    return true;
+}
+
+#ifdef WEAR_LEVELING_CHECKPOINTS
+/**
+ * Checks a checkpoint found while playing back the write log against the data played back so far.
+ *
+ * @param end address of the write log just after the checkpoint
+ */
+static wear_leveling_status_t wear_leveling_playback_checkpoint(const write_log_entry_t *log, uint32_t end) {
+    // Either damaged, or only part of it made it to the backing store
+    if (!LOG_ENTRY_IS_CHECKPOINT(*log)) {
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling.next_checkpoint = end + (WEAR_LEVELING_CHECKPOINT_INTERVAL);
+    if (wear_leveling.verified) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    if (LOG_ENTRY_CHECKPOINT_GET_CHECKSUM(*log) == wear_leveling.checksum) {
+        wear_leveling.checkpoint_end = end;
+        wear_leveling.mismatch       = false;
+    } else {
+        wear_leveling.mismatch = true;
+    }
+    wl_dprintf("Checkpoint %s\n", wear_leveling.mismatch ? "mismatch" : "matches");
+    return WEAR_LEVELING_SUCCESS;
+}
+#endif // WEAR_LEVELING_CHECKPOINTS
 
-        // If we got a nonzero value, then we need to increment the address to ensure next write occurs at next location
-        address += (BACKING_STORE_WRITE_SIZE);
+/**
+ * "Replays" the write log between the supplied addresses of the backing store, updating the local cache with updated values.
+ * The next write to the log is set up to occur after the last entry found.
+ */
+static wear_leveling_status_t wear_leveling_read_log(uint32_t address, uint32_t end) {
+    wl_dprintf("Playback write log\n");
 
+    wear_leveling_log_reader_t reader = {.address = address, .end = end, .chunk_address = address, .chunk_count = 0};
+    wear_leveling_status_t     status = WEAR_LEVELING_SUCCESS;
+    while (status == WEAR_LEVELING_SUCCESS && reader.address < end) {
         // Read from the write log
         write_log_entry_t log;
 #if BACKING_STORE_WRITE_SIZE == 2
-        log.raw16[0] = value;
+        backing_store_int_t *values = log.raw16;
 #elif BACKING_STORE_WRITE_SIZE == 4
-        log.raw32[0] = value;
+        backing_store_int_t *values = log.raw32;
 #elif BACKING_STORE_WRITE_SIZE == 8
-        log.raw64 = value;
+        backing_store_int_t *values = &log.raw64;
 #endif
+        if (!wear_leveling_log_next(&reader, &values[0])) {
+            wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
+            status = WEAR_LEVELING_FAILED;
+            break;
+        }
+        if (values[0] == 0) {
+            wl_dprintf("Found empty slot, no more log entries\n");
+            // Leave the empty slot for the next write
+            reader.address -= (BACKING_STORE_WRITE_SIZE);
+            break;
+        }
 
+        // Work out how many more values make up this entry. See the log format in the documentation header at the top of the file.
+        size_t fetched = 1;
+        size_t count   = 1;
         switch (LOG_ENTRY_GET_TYPE(log)) {
             case LOG_ENTRY_TYPE_MULTIBYTE: {
 #if BACKING_STORE_WRITE_SIZE == 2
-                ok = backing_store_read(address, &log.raw16[1]);
-                if (!ok) {
-                    wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
-                    cancel_playback = true;
-                    status          = WEAR_LEVELING_FAILED;
+                // The length is held in the second value
+                if (!wear_leveling_log_next(&reader, &values[1])) {
+                    status = WEAR_LEVELING_FAILED;
                     break;
                 }
-                address += (BACKING_STORE_WRITE_SIZE);
-#endif // BACKING_STORE_WRITE_SIZE == 2
+                const uint8_t l = LOG_ENTRY_MULTIBYTE_GET_LENGTH(log);
+                fetched         = 2;
+                count           = 2 + (l > 1 ? 1 : 0) + (l > 3 ? 1 : 0);
+#elif BACKING_STORE_WRITE_SIZE == 4
+                const uint8_t l = LOG_ENTRY_MULTIBYTE_GET_LENGTH(log);
+                count           = 1 + (l > 1 ? 1 : 0);
+#endif
+#ifdef WEAR_LEVELING_CHECKPOINTS
+                // Zero length is a checkpoint, which is played back in one go rather than as two empty writes
+                if (LOG_ENTRY_MULTIBYTE_GET_LENGTH(log) == 0) {
+                    count = 8 / (BACKING_STORE_WRITE_SIZE);
+                }
+#endif // WEAR_LEVELING_CHECKPOINTS
+            } break;
+            default:
+                break;
+        }
+        for (size_t i = fetched; status == WEAR_LEVELING_SUCCESS && i < count; ++i) {
+            if (!wear_leveling_log_next(&reader, &values[i])) {
+                // Either a read failure, or an entry truncated by the end of the write log
+                wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
+                status = WEAR_LEVELING_FAILED;
+            }
+        }
+        if (status != WEAR_LEVELING_SUCCESS) {
+            break;
+        }
+
+        switch (LOG_ENTRY_GET_TYPE(log)) {
+            case LOG_ENTRY_TYPE_MULTIBYTE: {
                 const uint32_t a = LOG_ENTRY_MULTIBYTE_GET_ADDRESS(log);
                 const uint8_t  l = LOG_ENTRY_MULTIBYTE_GET_LENGTH(log);
 
-                if (a + l > (WEAR_LEVELING_LOGICAL_SIZE)) {
-                    cancel_playback = true;
-                    status          = WEAR_LEVELING_FAILED;
+#ifdef WEAR_LEVELING_CHECKPOINTS
+                if (l == 0) {
+                    status = wear_leveling_playback_checkpoint(&log, reader.address);
                     break;
                 }
+#endif // WEAR_LEVELING_CHECKPOINTS
 
-#if BACKING_STORE_WRITE_SIZE == 2
-                if (l > 1) {
-                    ok = backing_store_read(address, &log.raw16[2]);
-                    if (!ok) {
-                        wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
-                        cancel_playback = true;
-                        status          = WEAR_LEVELING_FAILED;
-                        break;
-                    }
-                    address += (BACKING_STORE_WRITE_SIZE);
-                }
-                if (l > 3) {
-                    ok = backing_store_read(address, &log.raw16[3]);
-                    if (!ok) {
-                        wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
-                        cancel_playback = true;
-                        status          = WEAR_LEVELING_FAILED;
-                        break;
-                    }
-                    address += (BACKING_STORE_WRITE_SIZE);
-                }
-#elif BACKING_STORE_WRITE_SIZE == 4
-                if (l > 1) {
-                    ok = backing_store_read(address, &log.raw32[1]);
-                    if (!ok) {
-                        wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
-                        cancel_playback = true;
-                        status = WEAR_LEVELING_FAILED;
-                        break;
-                    }
-                    address += (BACKING_STORE_WRITE_SIZE);
+                if (a + l > (WEAR_LEVELING_LOGICAL_SIZE)) {
+                    status = WEAR_LEVELING_FAILED;
+                    break;
                 }
-#endif
 
-                memcpy(&wear_leveling.cache[a], &log.raw8[3], l);
+                wear_leveling_cache_update(a, &log.raw8[3], l);
             } break;
 #if BACKING_STORE_WRITE_SIZE == 2
             case LOG_ENTRY_TYPE_OPTIMIZED_64: {
@@ -569,36 +1430,77 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 const uint8_t  v = LOG_ENTRY_OPTIMIZED_64_GET_VALUE(log);
 
                 if (a >= (WEAR_LEVELING_LOGICAL_SIZE)) {
-                    cancel_playback = true;
-                    status          = WEAR_LEVELING_FAILED;
+                    status = WEAR_LEVELING_FAILED;
                     break;
                 }
 
-                wear_leveling.cache[a] = v;
+                wear_leveling_cache_update(a, &v, 1);
             } break;
             case LOG_ENTRY_TYPE_WORD_01: {
                 const uint32_t a = LOG_ENTRY_WORD_01_GET_ADDRESS(log);
                 const uint8_t  v = LOG_ENTRY_WORD_01_GET_VALUE(log);
 
                 if (a + 1 >= (WEAR_LEVELING_LOGICAL_SIZE)) {
-                    cancel_playback = true;
-                    status          = WEAR_LEVELING_FAILED;
+                    status = WEAR_LEVELING_FAILED;
                     break;
                 }
 
-                wear_leveling.cache[a + 0] = v;
-                wear_leveling.cache[a + 1] = 0;
+                const uint8_t w[2] = {v, 0};
+                wear_leveling_cache_update(a, w, 2);
             } break;
 #endif // BACKING_STORE_WRITE_SIZE == 2
             default: {
-                cancel_playback = true;
-                status          = WEAR_LEVELING_FAILED;
+                status = WEAR_LEVELING_FAILED;
             } break;
         }
     }
 
     // We've reached the end of the log, so we're at the new write location
-    wear_leveling.write_address = address;
+    wear_leveling.write_address = reader.address;
+
+    return status;
+}
+
+/**
+ * "Replays" the write log from the backing store, updating the local cache with updated values.
+ */
+static wear_leveling_status_t wear_leveling_playback_log(void) {
+#ifdef WEAR_LEVELING_DUAL_BANK
+    wear_leveling_status_t status = wear_leveling_read_log(wear_leveling.bank_address + (WEAR_LEVELING_LOG_OFFSET), wear_leveling.bank_address + (WEAR_LEVELING_BANK_SIZE));
+#else
+    wear_leveling_status_t status = wear_leveling_read_log(WEAR_LEVELING_LOG_START, (WEAR_LEVELING_BACKING_SIZE));
+#    ifdef WEAR_LEVELING_CHECKPOINTS
+    if (wear_leveling.checkpoint_end != 0) {
+        if (wear_leveling.mismatch) {
+            // The write log after the last matching checkpoint is damaged -- rebuild the cache from everything up to it,
+            // then consolidate to get rid of the rest
+            wl_dprintf("Rolling back to last matching checkpoint\n");
+            uint32_t end = wear_leveling.checkpoint_end;
+            if (!backing_store_read_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+                wl_dprintf("Failed to read from backing store\n");
+                return WEAR_LEVELING_FAILED;
+            }
+            wear_leveling_checksum_reset();
+            wear_leveling.verified = true;
+            wear_leveling_read_log((WEAR_LEVELING_LOG_OFFSET), end);
+            status = WEAR_LEVELING_FAILED;
+        }
+    } else if (!wear_leveling.verified) {
+        // No checkpoint vouched for the consolidated data, check it against its FNV1a_64 instead
+        bool valid;
+        if (wear_leveling_verify_consolidated_at(0, &valid) == WEAR_LEVELING_FAILED) {
+            return WEAR_LEVELING_FAILED;
+        }
+        if (!valid) {
+            // Same as a mismatch before playback -- start from a clear cache, and apply the write log on top
+            wl_dprintf("Checksum mismatch, clearing cache\n");
+            wear_leveling_clear_cache();
+            wear_leveling.verified = true;
+            status                 = wear_leveling_read_log((WEAR_LEVELING_LOG_OFFSET), (WEAR_LEVELING_BACKING_SIZE));
+        }
+    }
+#    endif // WEAR_LEVELING_CHECKPOINTS
+#endif
 
     if (status == WEAR_LEVELING_FAILED) {
         // If we had a failure during readback, assume we're corrupted -- force a consolidation with the data we already have
@@ -611,13 +1513,64 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
     return status;
 }
 
+#ifdef WEAR_LEVELING_DUAL_BANK
+/**
+ * Finds the bank holding the latest complete consolidated data, and reads it into the cache.
+ * Does not consider the write log.
+ */
+static wear_leveling_status_t wear_leveling_select_bank(void) {
+    uint32_t generation[2] = {0, 0};
+    bool     marked[2];
+    for (int i = 0; i < 2; ++i) {
+        marked[i] = wear_leveling_read_bank_marker(i * (WEAR_LEVELING_BANK_SIZE), &generation[i]);
+    }
+
+    // Try the newest bank first, falling back to the other if its data doesn't match the checksum
+    int newest = (marked[1] && (!marked[0] || (int32_t)(generation[1] - generation[0]) > 0)) ? 1 : 0;
+    for (int i = 0; i < 2; ++i) {
+        int bank = (i == 0) ? newest : 1 - newest;
+        if (!marked[bank]) {
+            continue;
+        }
+
+        bool valid;
+        wear_leveling.bank_address = bank * (WEAR_LEVELING_BANK_SIZE);
+        if (wear_leveling_read_consolidated_from(wear_leveling.bank_address, &valid) == WEAR_LEVELING_FAILED) {
+            return WEAR_LEVELING_FAILED;
+        }
+        if (valid) {
+            wl_dprintf("Using bank at 0x%04X\n", (int)wear_leveling.bank_address);
+            wear_leveling.generation     = generation[bank];
+            wear_leveling.write_address  = wear_leveling.bank_address + (WEAR_LEVELING_LOG_OFFSET);
+            wear_leveling.spare_state    = SPARE_BANK_UNKNOWN;
+            wear_leveling.spare_progress = 0;
+            return WEAR_LEVELING_SUCCESS;
+        }
+    }
+
+    // No complete bank, so this is either a clean MCU or data written without dual banks.
+    // Pick up any data in the single bank layout, then start over from the first bank.
+    bool valid;
+    wear_leveling.bank_address = 0;
+    wear_leveling.generation   = 0;
+    if (wear_leveling_read_consolidated_from(0, &valid) == WEAR_LEVELING_FAILED) {
+        return WEAR_LEVELING_FAILED;
+    }
+    if (valid) {
+        wear_leveling_read_log((WEAR_LEVELING_LOGICAL_SIZE) + 8, (WEAR_LEVELING_BACKING_SIZE));
+    }
+    return wear_leveling_format();
+}
+#endif // WEAR_LEVELING_DUAL_BANK
+
 /**
  * Wear-leveling initialization
  */
 wear_leveling_status_t wear_leveling_init(void) {
     wl_dprintf("Init\n");
 
-    // Reset the cache
+    // Reset the cache, dropping any transaction in progress
+    wear_leveling.transaction_depth = 0;
     wear_leveling_clear_cache();
 
     // Initialise the backing store
@@ -628,7 +1581,11 @@ wear_leveling_status_t wear_leveling_init(void) {
     }
 
     // Read the previous consolidated values, then replay the existing write log so that the cache has the "live" values
+#ifdef WEAR_LEVELING_DUAL_BANK
+    wear_leveling_status_t status = wear_leveling_select_bank();
+#else
     wear_leveling_status_t status = wear_leveling_read_consolidated();
+#endif
     if (status == WEAR_LEVELING_FAILED) {
         // If it failed, clear the cache and return with failure
         wear_leveling_clear_cache();
@@ -652,6 +1609,13 @@ wear_leveling_status_t wear_leveling_init(void) {
 wear_leveling_status_t wear_leveling_erase(void) {
     wl_dprintf("Erase\n");
 
+#ifdef WEAR_LEVELING_DUAL_BANK
+    // Lay out the first bank straight away, rather than on next startup
+    memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
+    wear_leveling.dirty_count = 0;
+    return wear_leveling_format() == WEAR_LEVELING_FAILED ? WEAR_LEVELING_FAILED : WEAR_LEVELING_SUCCESS;
+#else
+
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
@@ -661,6 +1625,9 @@ wear_leveling_status_t wear_leveling_erase(void) {
 
     // Perform the erase
     bool ret = backing_store_erase();
+#    ifdef WEAR_LEVELING_COMPRESSION
+    wear_leveling.log_address = (WEAR_LEVELING_SNAPSHOT_OFFSET);
+#    endif
     wear_leveling_clear_cache();
 
     // Lock the backing store if we acquired the lock successfully
@@ -669,6 +1636,7 @@ wear_leveling_status_t wear_leveling_erase(void) {
     }
 
     return ret ? WEAR_LEVELING_SUCCESS : WEAR_LEVELING_FAILED;
+#endif // WEAR_LEVELING_DUAL_BANK
 }
 
 /**
@@ -689,7 +1657,13 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     }
 
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
-    memcpy(&wear_leveling.cache[address], value, length);
+    wear_leveling_cache_update(address, value, length);
+
+    // Inside a transaction, the backing store is only written on commit
+    if (wear_leveling.transaction_depth > 0) {
+        wear_leveling_mark_dirty(address, address + length);
+        return WEAR_LEVELING_SUCCESS;
+    }
 
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
@@ -709,6 +1683,11 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
         case WEAR_LEVELING_SUCCESS:
             // Consolidate the cache + write log if required
             status = wear_leveling_consolidate_if_needed();
+#ifdef WEAR_LEVELING_CHECKPOINTS
+            if (status == WEAR_LEVELING_SUCCESS) {
+                status = wear_leveling_checkpoint_if_needed();
+            }
+#endif // WEAR_LEVELING_CHECKPOINTS
             break;
 
         default:
@@ -743,6 +1722,121 @@ wear_leveling_status_t wear_leveling_read(const uint32_t address, void *value, s
     return WEAR_LEVELING_SUCCESS;
 }
 
+/**
+ * Starts a transaction.
+ */
+void wear_leveling_begin(void) {
+    ++wear_leveling.transaction_depth;
+}
+
+/**
+ * Ends a transaction, writing out the ranges modified during it.
+ */
+wear_leveling_status_t wear_leveling_commit(void) {
+    wl_assert(wear_leveling.transaction_depth > 0);
+    if (wear_leveling.transaction_depth == 0) {
+        return WEAR_LEVELING_FAILED;
+    }
+    if (--wear_leveling.transaction_depth > 0 || wear_leveling.dirty_count == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    uint32_t needed = 0;
+    for (uint8_t i = 0; i < wear_leveling.dirty_count; ++i) {
+        needed += wear_leveling_log_size(wear_leveling.dirty[i].start, wear_leveling.dirty[i].end);
+    }
+
+#ifdef WEAR_LEVELING_DUAL_BANK
+    const uint32_t log_end = wear_leveling.bank_address + (WEAR_LEVELING_BANK_SIZE);
+#else
+    const uint32_t log_end = (WEAR_LEVELING_BACKING_SIZE);
+#endif
+
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    if (wear_leveling.write_address + needed > log_end) {
+#ifdef WEAR_LEVELING_DUAL_BANK
+        // Anything already copied into the spare bank may be out of date, as none of this went to its write log
+        if (wear_leveling.spare_state == SPARE_BANK_CONSOLIDATING) {
+            wear_leveling.spare_state    = SPARE_BANK_DIRTY;
+            wear_leveling.spare_progress = 0;
+        }
+#endif
+        // Rather than filling the write log only to consolidate part way through, consolidate once straight away
+        wl_dprintf("Transaction too large for write log, consolidating\n");
+        status = wear_leveling_consolidate_force();
+    } else {
+        for (uint8_t i = 0; i < wear_leveling.dirty_count; ++i) {
+            uint32_t               address = wear_leveling.dirty[i].start;
+            wear_leveling_status_t result  = wear_leveling_write_raw(address, &wear_leveling.cache[address], wear_leveling.dirty[i].end - address);
+            if (wear_leveling_write_stop(result)) {
+                status = result;
+                break;
+            }
+            if (result == WEAR_LEVELING_CONSOLIDATED) {
+                status = result;
+            }
+        }
+        if (status == WEAR_LEVELING_SUCCESS) {
+            // Consolidate the cache + write log if required
+            status = wear_leveling_consolidate_if_needed();
+        }
+#ifdef WEAR_LEVELING_CHECKPOINTS
+        if (status == WEAR_LEVELING_SUCCESS) {
+            status = wear_leveling_checkpoint_if_needed();
+        }
+#endif // WEAR_LEVELING_CHECKPOINTS
+    }
+    wear_leveling.dirty_count = 0;
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Background maintenance of the backing store.
+ */
+void wear_leveling_task(void) {
+    backing_store_task();
+
+#ifdef WEAR_LEVELING_DUAL_BANK
+    // Nothing to do until the write log fills up
+    if (wear_leveling.spare_state == SPARE_BANK_ERASED && !wear_leveling_consolidation_due()) {
+        return;
+    }
+
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return;
+    }
+
+    wear_leveling_consolidate_step((WEAR_LEVELING_CONSOLIDATE_STEP), false);
+
+    if (lock_status == STATUS_SUCCESS) {
+        wear_leveling_lock();
+    }
+#endif // WEAR_LEVELING_DUAL_BANK
+}
+
+/**
+ * Waits for the backing store to complete any writes it has queued.
+ */
+wear_leveling_status_t wear_leveling_flush(void) {
+    return backing_store_flush() ? WEAR_LEVELING_SUCCESS : WEAR_LEVELING_FAILED;
+}
+
 /**
  * Weak implementation of bulk read, drivers can implement more optimised implementations.
  */
@@ -766,3 +1860,15 @@ __attribute__((weak)) bool backing_store_write_bulk(uint32_t address, backing_st
     }
     return true;
 }
+
+/**
+ * Weak implementation of the backing store task, for drivers which complete every write before returning.
+ */
+__attribute__((weak)) void backing_store_task(void) {}
+
+/**
+ * Weak implementation of backing store flush, for drivers which complete every write before returning.
+ */
+__attribute__((weak)) bool backing_store_flush(void) {
+    return true;
+}
@@ -52,3 +52,42 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Starts a transaction.
+ *
+ * Until the matching wear_leveling_commit(), writes only update the cache and keep track of the modified ranges --
+ * nothing is written to the backing store. Transactions may be nested, in which case only the outermost commit writes
+ * to the backing store.
+ */
+void wear_leveling_begin(void);
+
+/**
+ * Ends a transaction, writing the ranges modified since wear_leveling_begin() to the backing store.
+ *
+ * The modified ranges are coalesced into as few write log entries as possible, all written while the backing store is
+ * unlocked once. If they would not fit in what's left of the write log, the cache is consolidated instead.
+ *
+ * A power loss part way through the commit may leave only some of the modified ranges written.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_commit(void);
+
+/**
+ * Background maintenance of the backing store, called from the main loop.
+ *
+ * With WEAR_LEVELING_DUAL_BANK, this incrementally consolidates the write log into the spare bank, and erases the
+ * previous bank afterwards. It also lets drivers which queue writes, such as the SPI flash driver, progress them
+ * without waiting.
+ */
+void wear_leveling_task(void);
+
+/**
+ * Waits for any writes still queued by the backing store driver to complete, such as before a reset.
+ *
+ * Drivers which complete every write before returning have nothing to do.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_flush(void);
@@ -61,10 +61,89 @@ typedef uint64_t backing_store_int_t;
         } while (0)
 #endif // WEAR_LEVELING_ASSERTS
 
+#ifdef WEAR_LEVELING_DUAL_BANK
+// Size of each of the two banks
+#    define WEAR_LEVELING_BANK_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+// Offset of the write log within a bank, after the consolidated data, its FNV1a_64 and the bank marker
+#    define WEAR_LEVELING_LOG_OFFSET ((WEAR_LEVELING_LOGICAL_SIZE) + 16)
+// Percentage of the write log in use before consolidation into the other bank is started in the background
+#    ifndef WEAR_LEVELING_CONSOLIDATE_THRESHOLD
+#        define WEAR_LEVELING_CONSOLIDATE_THRESHOLD 50
+#    endif
+// Number of backing store writes performed by each background consolidation step
+#    ifndef WEAR_LEVELING_CONSOLIDATE_STEP
+#        define WEAR_LEVELING_CONSOLIDATE_STEP 8
+#    endif
+// Number of bytes erased by each background erase step, must be a multiple of the backing store's erase size
+#    ifndef WEAR_LEVELING_ERASE_STEP
+#        ifdef BACKING_STORE_ERASE_SIZE
+#            define WEAR_LEVELING_ERASE_STEP (BACKING_STORE_ERASE_SIZE)
+#        else
+#            define WEAR_LEVELING_ERASE_STEP (WEAR_LEVELING_BANK_SIZE)
+#        endif
+#    endif
+// Marks a bank as holding complete consolidated data, alongside its generation
+#    define WEAR_LEVELING_BANK_MAGIC 0x4B4E4142 // "BANK"
+#else
+#    define WEAR_LEVELING_BANK_SIZE (WEAR_LEVELING_BACKING_SIZE)
+// Offset of the write log, after the consolidated data and its FNV1a_64
+#    define WEAR_LEVELING_LOG_OFFSET ((WEAR_LEVELING_LOGICAL_SIZE) + 8)
+#endif // WEAR_LEVELING_DUAL_BANK
+
+#ifdef WEAR_LEVELING_COMPRESSION
+#    ifdef WEAR_LEVELING_DUAL_BANK
+#        error WEAR_LEVELING_COMPRESSION is not supported with WEAR_LEVELING_DUAL_BANK.
+#    endif
+// Offset of the compressed snapshot, after its header and FNV1a_64
+#    define WEAR_LEVELING_SNAPSHOT_OFFSET 16
+// Largest possible compressed snapshot, padded to 8 bytes -- a control byte for every 128 bytes of literals, plus one
+#    define WEAR_LEVELING_SNAPSHOT_MAX_SIZE ((((WEAR_LEVELING_LOGICAL_SIZE) + ((WEAR_LEVELING_LOGICAL_SIZE) + 127) / 128 + 1) + 7) / 8 * 8)
+// Smallest write log left after the largest possible compressed snapshot
+#    define WEAR_LEVELING_SNAPSHOT_MIN_LOG 64
+// Marks the header of a compressed snapshot, XORed with its length
+#    define WEAR_LEVELING_SNAPSHOT_MAGIC 0x5A50534C // "LSPZ"
+#endif // WEAR_LEVELING_COMPRESSION
+
+// Number of bytes of write log between checkpoints, zero to disable -- single bank without compression only.
+#ifndef WEAR_LEVELING_CHECKPOINT_INTERVAL
+#    define WEAR_LEVELING_CHECKPOINT_INTERVAL 0
+#endif
+#if !defined(WEAR_LEVELING_DUAL_BANK) && !defined(WEAR_LEVELING_COMPRESSION) && (WEAR_LEVELING_CHECKPOINT_INTERVAL) > 0
+#    define WEAR_LEVELING_CHECKPOINTS
+#endif
+
+// Number of backing store values read at a time while playing back the write log
+#ifndef WEAR_LEVELING_PLAYBACK_CHUNK
+#    define WEAR_LEVELING_PLAYBACK_CHUNK 16
+#endif
+
+// Number of separate modified ranges tracked during a transaction before neighbouring ranges are merged
+#ifndef WEAR_LEVELING_TRANSACTION_RANGES
+#    define WEAR_LEVELING_TRANSACTION_RANGES 8
+#endif
+
 // Compile-time validation of configurable options
+#ifdef WEAR_LEVELING_COMPRESSION
+_Static_assert(WEAR_LEVELING_BACKING_SIZE >= WEAR_LEVELING_SNAPSHOT_OFFSET + WEAR_LEVELING_SNAPSHOT_MAX_SIZE + WEAR_LEVELING_SNAPSHOT_MIN_LOG, "Total backing size must fit the largest possible compressed snapshot as well as a write log");
+_Static_assert(WEAR_LEVELING_BACKING_SIZE % 8 == 0, "Backing size must be a multiple of 8 when using compression");
+#else
 _Static_assert(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Total backing size must be at least twice the size of the logical size");
-_Static_assert(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 _Static_assert(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
+#endif // WEAR_LEVELING_COMPRESSION
+_Static_assert(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
+_Static_assert(WEAR_LEVELING_PLAYBACK_CHUNK > 0 && WEAR_LEVELING_PLAYBACK_CHUNK < 256, "Playback chunk size must be between 1 and 255");
+_Static_assert(WEAR_LEVELING_TRANSACTION_RANGES > 0 && WEAR_LEVELING_TRANSACTION_RANGES < 256, "Number of transaction ranges must be between 1 and 255");
+#ifdef WEAR_LEVELING_CHECKPOINTS
+_Static_assert(WEAR_LEVELING_LOGICAL_SIZE >= 512, "Logical size must be at least 512 bytes when using checkpoints, so that older firmware reads them as empty writes");
+#endif // WEAR_LEVELING_CHECKPOINTS
+#ifdef WEAR_LEVELING_DUAL_BANK
+_Static_assert(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 4), "Total backing size must be at least four times the size of the logical size when using dual banks");
+_Static_assert(WEAR_LEVELING_BANK_SIZE % WEAR_LEVELING_ERASE_STEP == 0, "Bank size must be a multiple of the erase step");
+#    ifdef BACKING_STORE_ERASE_SIZE
+_Static_assert(WEAR_LEVELING_ERASE_STEP % BACKING_STORE_ERASE_SIZE == 0, "Erase step must be a multiple of the erase size");
+#    endif
+_Static_assert(WEAR_LEVELING_CONSOLIDATE_THRESHOLD > 0 && WEAR_LEVELING_CONSOLIDATE_THRESHOLD <= 100, "Consolidation threshold must be a percentage");
+#endif // WEAR_LEVELING_DUAL_BANK
 
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
@@ -75,6 +154,11 @@ bool backing_store_write_bulk(uint32_t address, backing_store_int_t* values, siz
 bool backing_store_lock(void);
 bool backing_store_read(uint32_t address, backing_store_int_t* value);
 bool backing_store_read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count); // weak implementation already provided, optimized implementation can be implemented by driver
+void backing_store_task(void);  // weak implementation already provided, drivers which queue writes can progress them here
+bool backing_store_flush(void); // weak implementation already provided, drivers which queue writes must complete them all here
+#ifdef WEAR_LEVELING_DUAL_BANK
+bool backing_store_erase_range(uint32_t address, size_t length); // erases exactly the requested range, fails if it does not line up with the erase granularity of the backing store
+#endif // WEAR_LEVELING_DUAL_BANK
 
 /**
  * Helper type used to contain a write log entry.
@@ -149,3 +233,20 @@ _Static_assert(LOG_ENTRY_TYPES <= (1 << 2), "Too many log entry types to fit int
             [1] = (uint8_t)((address) >> 1), /* address */                                            \
         }                                                                                             \
     }
+
+// Checkpoints are a pair of zero-length multi-byte entries, which older firmware plays back as empty writes
+#define LOG_ENTRY_IS_CHECKPOINT(entry) ((entry).raw8[0] == 0 && (entry).raw8[1] == 1 && (entry).raw8[4] == 0 && (entry).raw8[5] == 1)
+#define LOG_ENTRY_CHECKPOINT_GET_CHECKSUM(entry) (((uint32_t)((entry).raw8[2])) | (((uint32_t)((entry).raw8[3])) << 8) | (((uint32_t)((entry).raw8[6])) << 16) | (((uint32_t)((entry).raw8[7])) << 24))
+#define LOG_ENTRY_MAKE_CHECKPOINT(checksum)                                   \
+    (write_log_entry_t) {                                                     \
+        .raw8 = {                                                             \
+            [0] = 0,                                       /* type, length */ \
+            [1] = 1,                                       /* address */      \
+            [2] = ((uint8_t)(checksum)),                   /* checksum */     \
+            [3] = ((uint8_t)((uint32_t)(checksum) >> 8)),  /* checksum */     \
+            [4] = 0,                                       /* type, length */ \
+            [5] = 1,                                       /* address */      \
+            [6] = ((uint8_t)((uint32_t)(checksum) >> 16)), /* checksum */     \
+            [7] = ((uint8_t)((uint32_t)(checksum) >> 24)), /* checksum */     \
+        }                                                                     \
+    }
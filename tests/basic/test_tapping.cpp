@@ -190,3 +190,38 @@ TEST_F(Tapping, TapA_CTL_T_KeyWhileReleasingLayer) {
     run_one_scan_loop();
     VERIFY_AND_CLEAR(driver);
 }
+
+TEST_F(Tapping, FastRollWhileModTapPendingDoesNotOverflow) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_hold_key = KeymapKey(0, 7, 0, SFT_T(KC_P));
+    auto       key_a            = KeymapKey(0, 0, 1, KC_A);
+    auto       key_b            = KeymapKey(0, 1, 1, KC_B);
+    auto       key_c            = KeymapKey(0, 2, 1, KC_C);
+    auto       key_d            = KeymapKey(0, 3, 1, KC_D);
+    auto       key_e            = KeymapKey(0, 4, 1, KC_E);
+    auto       key_f            = KeymapKey(0, 5, 1, KC_F);
+
+    set_keymap({mod_tap_hold_key, key_a, key_b, key_c, key_d, key_e, key_f});
+
+    // Twelve events are held back while the mod-tap key is undecided
+    EXPECT_NO_REPORT(driver);
+    mod_tap_hold_key.press();
+    run_one_scan_loop();
+    tap_keys(key_a, key_b, key_c, key_d, key_e, key_f);
+    VERIFY_AND_CLEAR(driver);
+
+    // None of them are lost once the hold is settled
+    EXPECT_REPORT(driver, (KC_LSFT));
+    for (auto key : {KC_A, KC_B, KC_C, KC_D, KC_E, KC_F}) {
+        EXPECT_REPORT(driver, (KC_LSFT, key));
+        EXPECT_REPORT(driver, (KC_LSFT));
+    }
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,184 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class DynamicKeymapMacro : public TestFixture {
+   public:
+    void SetUp() override {
+        dynamic_keymap_macro_reset();
+    }
+
+    // Writes the whole text buffer the way VIA does: marked invalid, then written in order, then marked valid
+    bool write_text(const std::string &text) {
+        uint16_t             size = dynamic_keymap_macro_get_text_buffer_size();
+        std::vector<uint8_t> buffer(size, 0);
+        std::copy(text.begin(), text.end(), buffer.begin());
+
+        uint8_t flag = 0x42;
+        bool    ok   = dynamic_keymap_macro_set_text_buffer(size - 1, 1, &flag);
+        for (uint16_t offset = 0; offset < size - 1; offset += 28) {
+            uint16_t length = std::min<uint16_t>(28, size - 1 - offset);
+            ok &= dynamic_keymap_macro_set_text_buffer(offset, length, &buffer[offset]);
+        }
+        flag = 0;
+        ok &= dynamic_keymap_macro_set_text_buffer(size - 1, 1, &flag);
+        return ok;
+    }
+
+    std::string read_text(uint16_t length) {
+        std::vector<uint8_t> buffer(length, 0);
+        for (uint16_t offset = 0; offset < length; offset += 28) {
+            dynamic_keymap_macro_get_text_buffer(offset, std::min<uint16_t>(28, length - offset), &buffer[offset]);
+        }
+        return std::string(buffer.begin(), buffer.end());
+    }
+
+    std::vector<uint8_t> read_bytecode(uint16_t length) {
+        std::vector<uint8_t> buffer(length, 0);
+        dynamic_keymap_macro_get_buffer(0, length, buffer.data());
+        return buffer;
+    }
+};
+
+TEST_F(DynamicKeymapMacro, PlainTextIsKept) {
+    std::string text("hello\0" SS_TAP(X_A), 9);
+    EXPECT_TRUE(write_text(text));
+
+    // Only the second macro gains anything from bytecode
+    std::vector<uint8_t> expected = {'h', 'e', 'l', 'l', 'o', 0, DYNAMIC_KEYMAP_MACRO_OP_BYTECODE, DYNAMIC_KEYMAP_MACRO_OP_TAP, KC_A, 0};
+    EXPECT_EQ(read_bytecode(expected.size()), expected);
+    EXPECT_EQ(read_text(10), std::string("hello\0" SS_TAP(X_A) "\0", 10));
+}
+
+TEST_F(DynamicKeymapMacro, CodesAreConverted) {
+    EXPECT_TRUE(write_text(SS_TAP(X_A) "xy" SS_DOWN(X_LSFT) SS_DELAY(300) SS_UP(X_LSFT)));
+
+    std::vector<uint8_t> expected = {
+        DYNAMIC_KEYMAP_MACRO_OP_BYTECODE,
+        DYNAMIC_KEYMAP_MACRO_OP_TAP, KC_A,
+        'x', 'y',
+        DYNAMIC_KEYMAP_MACRO_OP_DOWN, KC_LEFT_SHIFT,
+        DYNAMIC_KEYMAP_MACRO_OP_DELAY, 0xAC, 0x02, // 300
+        DYNAMIC_KEYMAP_MACRO_OP_UP, KC_LEFT_SHIFT,
+        0,
+    };
+    EXPECT_EQ(read_bytecode(expected.size()), expected);
+
+    std::string text = SS_TAP(X_A) "xy" SS_DOWN(X_LSFT) SS_DELAY(300) SS_UP(X_LSFT);
+    EXPECT_EQ(read_text(text.size() + 1), text + std::string(1, '\0'));
+}
+
+TEST_F(DynamicKeymapMacro, RunsBecomeRepeats) {
+    std::string text = "a----------b";
+    EXPECT_TRUE(write_text(text + std::string(1, '\0') + "---"));
+
+    std::vector<uint8_t> expected = {
+        'a',
+        DYNAMIC_KEYMAP_MACRO_OP_BYTECODE,
+        DYNAMIC_KEYMAP_MACRO_OP_REPEAT, 10, 1, '-',
+        'b',
+        0,
+        // Too short to be worth it
+        '-', '-', '-',
+        0,
+    };
+    EXPECT_EQ(read_bytecode(expected.size()), expected);
+    EXPECT_EQ(read_text(text.size() + 5), text + std::string(1, '\0') + "---" + std::string(1, '\0'));
+}
+
+TEST_F(DynamicKeymapMacro, Utf8BecomesUnicode) {
+    std::string text = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+    EXPECT_TRUE(write_text(text));
+
+    std::vector<uint8_t> expected = {
+        'a',
+        DYNAMIC_KEYMAP_MACRO_OP_BYTECODE,
+        DYNAMIC_KEYMAP_MACRO_OP_UNICODE, 0xE9, 0x01, // U+00E9
+        DYNAMIC_KEYMAP_MACRO_OP_UNICODE, 0xAC, 0x41, // U+20AC
+        DYNAMIC_KEYMAP_MACRO_OP_UNICODE, 0x80, 0xEC, 0x07, // U+1F600
+        0,
+    };
+    EXPECT_EQ(read_bytecode(expected.size()), expected);
+    EXPECT_EQ(read_text(text.size() + 1), text + std::string(1, '\0'));
+}
+
+TEST_F(DynamicKeymapMacro, OverflowIsReported) {
+    // Nothing in here can be made smaller, and the text buffer is larger than the EEPROM behind it
+    std::string text;
+    while (text.size() < dynamic_keymap_macro_get_text_buffer_size() - 1) {
+        text += "abcdefghij";
+    }
+    text.resize(dynamic_keymap_macro_get_text_buffer_size() - 2);
+    EXPECT_FALSE(write_text(text));
+
+    // The macro is cut short, but the buffer is still usable
+    uint16_t             size     = dynamic_keymap_macro_get_buffer_size();
+    std::vector<uint8_t> bytecode = read_bytecode(size);
+    EXPECT_EQ(bytecode[size - 2], 0);
+    EXPECT_EQ(bytecode[size - 1], 0);
+
+    // And it fits again once it is written smaller
+    EXPECT_TRUE(write_text("abc"));
+}
+
+TEST_F(DynamicKeymapMacro, OutOfOrderWriteIsReported) {
+    uint8_t data[28] = {'a', 'b', 'c'};
+
+    EXPECT_FALSE(dynamic_keymap_macro_set_text_buffer(28, sizeof(data), data));
+
+    EXPECT_TRUE(dynamic_keymap_macro_set_text_buffer(0, sizeof(data), data));
+    EXPECT_FALSE(dynamic_keymap_macro_set_text_buffer(56, sizeof(data), data));
+    EXPECT_FALSE(dynamic_keymap_macro_set_text_buffer(28, sizeof(data), data));
+
+    EXPECT_TRUE(dynamic_keymap_macro_set_text_buffer(0, sizeof(data), data));
+    EXPECT_TRUE(dynamic_keymap_macro_set_text_buffer(28, sizeof(data), data));
+}
+
+TEST_F(DynamicKeymapMacro, BytecodeIsPlayedBack) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(write_text("a" SS_TAP(X_B) "ccccccc"));
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    for (int i = 0; i < 7; i++) {
+        EXPECT_REPORT(driver, (KC_C));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    dynamic_keymap_macro_send(0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMacro, CodesArePlayedBack) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(write_text(SS_DOWN(X_LSFT) SS_DELAY(20) "a" SS_UP(X_LSFT) SS_TAP(X_B)));
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    dynamic_keymap_macro_send(0);
+    VERIFY_AND_CLEAR(driver);
+
+    // Playing back leaves the buffer readable by the host
+    std::string text = SS_DOWN(X_LSFT) SS_DELAY(20) "a" SS_UP(X_LSFT) SS_TAP(X_B);
+    EXPECT_EQ(read_text(text.size() + 1), text + std::string(1, '\0'));
+}
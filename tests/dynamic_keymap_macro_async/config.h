@@ -0,0 +1,12 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define DYNAMIC_KEYMAP_LAYER_COUNT 1
+#define DYNAMIC_KEYMAP_MACRO_BYTECODE
+#define TRANSIENT_EEPROM_SIZE 512
+#define SEND_STRING_ASYNC_QUEUE_SIZE 16
+#define UNICODE_SELECTED_MODES UNICODE_MODE_LINUX
@@ -0,0 +1,103 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class DynamicKeymapMacroAsync : public TestFixture {
+   public:
+    void SetUp() override {
+        send_string_async_cancel();
+        dynamic_keymap_macro_reset();
+    }
+
+    // Writes the whole text buffer the way VIA does: marked invalid, then written in order, then marked valid
+    bool write_text(const std::string &text) {
+        uint16_t             size = dynamic_keymap_macro_get_text_buffer_size();
+        std::vector<uint8_t> buffer(size, 0);
+        std::copy(text.begin(), text.end(), buffer.begin());
+
+        uint8_t flag = 0x42;
+        bool    ok   = dynamic_keymap_macro_set_text_buffer(size - 1, 1, &flag);
+        for (uint16_t offset = 0; offset < size - 1; offset += 28) {
+            uint16_t length = std::min<uint16_t>(28, size - 1 - offset);
+            ok &= dynamic_keymap_macro_set_text_buffer(offset, length, &buffer[offset]);
+        }
+        flag = 0;
+        ok &= dynamic_keymap_macro_set_text_buffer(size - 1, 1, &flag);
+        return ok;
+    }
+};
+
+TEST_F(DynamicKeymapMacroAsync, BytecodeIsQueued) {
+    TestDriver driver;
+    InSequence s;
+
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+    EXPECT_TRUE(write_text(SS_DOWN(X_LSFT) SS_DELAY(100) "a" SS_UP(X_LSFT) "\xC3\xA9"));
+
+    // Nothing is sent until the main loop gets to it
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(0);
+    EXPECT_TRUE(send_string_async_is_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The delay doesn't hold up the main loop
+    EXPECT_NO_REPORT(driver);
+    idle_for(50);
+    EXPECT_TRUE(send_string_async_is_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_UNICODE(driver, 0x00E9);
+    idle_for(100);
+    EXPECT_FALSE(send_string_async_is_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMacroAsync, RepeatsAreExpanded) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(write_text("ccccccc"));
+
+    for (int i = 0; i < 7; i++) {
+        EXPECT_REPORT(driver, (KC_C));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    dynamic_keymap_macro_send(0);
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMacroAsync, MacroThatDoesNotFitIsSentStraightAway) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(write_text("a" + std::string(20, 'c')));
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    for (int i = 0; i < 20; i++) {
+        EXPECT_REPORT(driver, (KC_C));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    dynamic_keymap_macro_send(0);
+    EXPECT_FALSE(send_string_async_is_busy());
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,22 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TAPPING_TERM 200
+
+// Number of randomized streams to run, and input events per stream
+#ifndef FUZZ_ROUNDS
+#    define FUZZ_ROUNDS 25
+#endif
+#ifndef FUZZ_EVENTS_PER_ROUND
+#    define FUZZ_EVENTS_PER_ROUND 200
+#endif
+
+// Upper bound on keyboard reports produced per input event; tap dance,
+// auto shift and key overrides may each add a few reports per event
+#ifndef FUZZ_MAX_REPORTS_PER_EVENT
+#    define FUZZ_MAX_REPORTS_PER_EVENT 8
+#endif
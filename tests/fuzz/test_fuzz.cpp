@@ -0,0 +1,211 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::Invoke;
+
+/* Randomized key event streams are run through the full key pipeline (tap-hold,
+ * layer-tap, combos, tap dance, key overrides and auto shift), checking that:
+ *  - every key and modifier that was pressed in a report is released again,
+ *  - nothing is left pressed once all keys are released and the timers ran out,
+ *  - the number of reports stays proportional to the number of input events.
+ *
+ * Set QMK_FUZZ_SEED to replay a single stream, e.g. the one reported by a failure.
+ */
+
+namespace {
+
+struct FuzzStats {
+    size_t events  = 0;
+    size_t reports = 0;
+    double seconds = 0;
+};
+
+std::vector<uint8_t> pressed_codes(const report_keyboard_t& report) {
+    std::vector<uint8_t> codes;
+    for (uint8_t i = 0; i < 8; i++) {
+        if (report.mods & (1 << i)) {
+            codes.push_back(KC_LEFT_CTRL + i);
+        }
+    }
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report.keys[i]) {
+            codes.push_back(report.keys[i]);
+        }
+    }
+    return codes;
+}
+
+/* Uniform value in [low, high] taken straight from the generator output, as
+ * std::uniform_int_distribution differs between standard libraries and would
+ * make a reported seed replay a different stream elsewhere. The modulo bias is
+ * negligible for these small ranges. */
+uint32_t next_in_range(std::mt19937& rng, uint32_t low, uint32_t high) {
+    return low + rng() % (high - low + 1);
+}
+
+/* Milliseconds until the next event: mostly fast rolls, sometimes long enough
+ * to cross the tapping, combo or auto shift terms. */
+uint32_t next_gap(std::mt19937& rng) {
+    uint32_t bucket = next_in_range(rng, 0, 9);
+    if (bucket < 7) {
+        return next_in_range(rng, 0, 30);
+    } else if (bucket < 9) {
+        return next_in_range(rng, 30, TAPPING_TERM + 50);
+    }
+    return next_in_range(rng, TAPPING_TERM + 50, 3 * TAPPING_TERM);
+}
+
+} // namespace
+
+class KeyPipelineFuzz : public TestFixture {
+   public:
+    void SetUp() override {
+        keys.emplace_back(0, 0, 0, LSFT_T(KC_A));
+        keys.emplace_back(0, 1, 0, LCTL_T(KC_S));
+        keys.emplace_back(0, 2, 0, KC_D);
+        keys.emplace_back(0, 3, 0, LT(1, KC_F));
+        keys.emplace_back(0, 4, 0, KC_J);
+        keys.emplace_back(0, 5, 0, KC_K);
+        keys.emplace_back(0, 6, 0, TD(0));
+        keys.emplace_back(0, 7, 0, KC_BSPC);
+        keys.emplace_back(0, 8, 0, KC_LSFT);
+        keys.emplace_back(0, 9, 0, KC_L);
+
+        for (const auto& key : keys) {
+            add_key(key);
+            add_key(KeymapKey(1, key.position.col, key.position.row, KC_TRNS));
+        }
+    }
+
+    FuzzStats run_stream(uint32_t seed);
+
+    std::vector<KeymapKey> keys;
+};
+
+FuzzStats KeyPipelineFuzz::run_stream(uint32_t seed) {
+    SCOPED_TRACE("replay with QMK_FUZZ_SEED=" + std::to_string(seed));
+
+    TestDriver                     driver;
+    std::vector<report_keyboard_t> reports;
+    FuzzStats                      stats;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([&](report_keyboard_t& report) { reports.push_back(report); }));
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(AnyNumber());
+    EXPECT_CALL(driver, send_extra_mock(_)).Times(AnyNumber());
+
+    std::mt19937      rng(seed);
+    std::vector<bool> held(keys.size(), false);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < FUZZ_EVENTS_PER_ROUND; i++) {
+        size_t index = next_in_range(rng, 0, keys.size() - 1);
+        if (held[index]) {
+            keys[index].release();
+        } else {
+            keys[index].press();
+        }
+        held[index] = !held[index];
+        stats.events++;
+
+        run_one_scan_loop();
+        idle_for(next_gap(rng));
+    }
+
+    for (size_t index = 0; index < keys.size(); index++) {
+        if (held[index]) {
+            keys[index].release();
+            stats.events++;
+            run_one_scan_loop();
+        }
+    }
+
+    // Let every pending term run out
+    idle_for(TAPPING_TERM * 10);
+
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    stats.reports = reports.size();
+
+    VERIFY_AND_CLEAR(driver);
+
+    // Every keycode is pressed at most once at a time, and released again
+    std::map<uint8_t, int> press_count;
+    std::vector<uint8_t>   previous;
+    for (size_t n = 0; n < reports.size(); n++) {
+        std::vector<uint8_t> current = pressed_codes(reports[n]);
+        for (uint8_t code : current) {
+            if (std::find(previous.begin(), previous.end(), code) == previous.end()) {
+                press_count[code]++;
+            }
+        }
+        for (uint8_t code : previous) {
+            if (std::find(current.begin(), current.end(), code) == current.end()) {
+                press_count[code]--;
+            }
+        }
+        for (const auto& entry : press_count) {
+            EXPECT_GE(entry.second, 0) << "keycode " << get_keycode_identifier_or_default(entry.first) << " released more often than pressed in report " << n << ": " << reports[n];
+            EXPECT_LE(entry.second, 1) << "keycode " << get_keycode_identifier_or_default(entry.first) << " pressed twice in report " << n << ": " << reports[n];
+        }
+        if (HasFailure()) {
+            break;
+        }
+        previous = current;
+    }
+    for (const auto& entry : press_count) {
+        EXPECT_EQ(entry.second, 0) << "keycode " << get_keycode_identifier_or_default(entry.first) << " was left pressed";
+    }
+
+    // No stuck keys, mods or layers
+    if (!reports.empty()) {
+        EXPECT_TRUE(pressed_codes(reports.back()).empty()) << "last report " << reports.back();
+    }
+    EXPECT_EQ(get_mods(), 0);
+    EXPECT_EQ(get_weak_mods(), 0);
+    EXPECT_EQ(layer_state, 0);
+
+    // Report count bounds
+    EXPECT_LE(stats.reports, stats.events * FUZZ_MAX_REPORTS_PER_EVENT);
+
+    return stats;
+}
+
+TEST_F(KeyPipelineFuzz, RandomStreamsKeepInvariants) {
+    std::vector<uint32_t> seeds;
+    if (const char* replay = std::getenv("QMK_FUZZ_SEED")) {
+        seeds.push_back(std::strtoul(replay, nullptr, 0));
+    } else {
+        for (uint32_t round = 0; round < FUZZ_ROUNDS; round++) {
+            seeds.push_back(0x5EED0000 + round);
+        }
+    }
+
+    FuzzStats total;
+    for (uint32_t seed : seeds) {
+        FuzzStats stats = run_stream(seed);
+        total.events += stats.events;
+        total.reports += stats.reports;
+        total.seconds += stats.seconds;
+        if (HasFailure()) {
+            break;
+        }
+    }
+
+    double events_per_second = total.seconds > 0 ? total.events / total.seconds : 0;
+    RecordProperty("events", std::to_string(total.events));
+    RecordProperty("reports", std::to_string(total.reports));
+    RecordProperty("events_per_second", std::to_string(events_per_second));
+    std::cout << "[ FUZZ     ] " << seeds.size() << " streams, " << total.events << " events, " << total.reports << " reports, " << static_cast<uint64_t>(events_per_second) << " events/s" << std::endl;
+}
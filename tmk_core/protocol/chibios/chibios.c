@@ -61,9 +61,11 @@ uint8_t keyboard_leds(void);
 void    send_keyboard(report_keyboard_t *report);
 void    send_mouse(report_mouse_t *report);
 void    send_extra(report_extra_t *report);
+bool    keyboard_ready(void);
+bool    mouse_ready(void);
 
 /* host struct */
-host_driver_t chibios_driver = {keyboard_leds, send_keyboard, send_mouse, send_extra};
+host_driver_t chibios_driver = {keyboard_leds, send_keyboard, send_mouse, send_extra, keyboard_ready, mouse_ready};
 
 #ifdef VIRTSER_ENABLE
 void virtser_task(void);
@@ -0,0 +1,9 @@
+usb_report_queue_DEFS := -DMOUSE_ENABLE -DEXTRAKEY_ENABLE
+
+usb_report_queue_SRC := \
+    $(TMK_PATH)/protocol/chibios/tests/usb_report_queue_tests.cpp \
+    $(TMK_PATH)/protocol/chibios/usb_report_queue.c
+
+usb_report_queue_INC := \
+    $(TMK_PATH)/protocol/chibios \
+    $(TMK_PATH)/protocol
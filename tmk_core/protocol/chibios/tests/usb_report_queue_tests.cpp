@@ -0,0 +1,380 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "keycode.h"
+#include "usb_report_queue.h"
+}
+
+// Stands in for the endpoint: reports are "transmitted" when started, and the host collects them whenever complete()
+// is called. send() paces itself the way send_string does, by waiting for the host to collect a report while the queue
+// is full; send_unpaced() pushes straight away, the way the matrix scan does.
+class ReportQueueHost {
+   public:
+    ReportQueueHost() {
+        usb_report_queue_reset(&queue);
+    }
+
+    void send(const void *report, size_t size, report_kind_t kind, uint8_t transitions) {
+        while (!usb_report_queue_has_room(&queue)) {
+            ASSERT_TRUE(queue.in_flight) << "queue full without a report being transmitted";
+            complete();
+        }
+        EXPECT_TRUE(usb_report_queue_push(&queue, report, size, kind, transitions));
+        start();
+    }
+
+    bool send_unpaced(const void *report, size_t size, report_kind_t kind, uint8_t transitions) {
+        bool kept = usb_report_queue_push(&queue, report, size, kind, transitions);
+        start();
+        return kept;
+    }
+
+    void complete(void) {
+        usb_report_queue_release(&queue);
+        start();
+    }
+
+    void drain(void) {
+        while (queue.count > 0) {
+            complete();
+        }
+    }
+
+    usb_report_queue_t                    queue;
+    std::vector<usb_report_queue_entry_t> received;
+
+   private:
+    void start(void) {
+        usb_report_queue_entry_t *entry = usb_report_queue_start(&queue);
+        if (entry != NULL) {
+            received.push_back(*entry);
+        }
+    }
+};
+
+class KeyboardReportQueue : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        memset(&sent, 0, sizeof(sent));
+    }
+
+    void send_keys(uint8_t mods, const std::set<uint8_t> &keys, bool paced = true) {
+        report_keyboard_t report = {};
+        report.mods              = mods;
+        int i                    = 0;
+        for (auto key : keys) {
+            report.keys[i++] = key;
+        }
+        uint8_t transitions = usb_report_keyboard_transitions(&sent, &report, false);
+        if (paced) {
+            host.send(&report, sizeof(report), REPORT_KIND_KEYBOARD, transitions);
+        } else {
+            host.send_unpaced(&report, sizeof(report), REPORT_KIND_KEYBOARD, transitions);
+        }
+        sent = report;
+        generated.push_back(report);
+    }
+
+    // Keys held in a report, mods included as 0xE0..0xE7, so two reports compare the same whatever the key order
+    static std::set<uint8_t> held(const report_keyboard_t &report) {
+        std::set<uint8_t> keys;
+        for (int i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+            if (report.keys[i]) keys.insert(report.keys[i]);
+        }
+        for (int i = 0; i < 8; i++) {
+            if (report.mods & (1 << i)) keys.insert(KC_LEFT_CTRL + i);
+        }
+        return keys;
+    }
+
+    // The distinct states a sequence of reports goes through, which is all the host can act on
+    static std::vector<std::set<uint8_t>> states(const std::vector<report_keyboard_t> &reports) {
+        std::vector<std::set<uint8_t>> result;
+        for (auto &report : reports) {
+            auto keys = held(report);
+            if (result.empty() || result.back() != keys) {
+                result.push_back(keys);
+            }
+        }
+        return result;
+    }
+
+    std::vector<report_keyboard_t> received(void) {
+        std::vector<report_keyboard_t> reports;
+        for (auto &entry : host.received) {
+            EXPECT_EQ(entry.kind, REPORT_KIND_KEYBOARD);
+            reports.push_back(entry.report.keyboard);
+        }
+        return reports;
+    }
+
+    ReportQueueHost                host;
+    report_keyboard_t              sent;
+    std::vector<report_keyboard_t> generated;
+};
+
+TEST_F(KeyboardReportQueue, TransitionsAreDetected) {
+    report_keyboard_t a = {}, b = {};
+
+    b.keys[0] = KC_A;
+    EXPECT_EQ(usb_report_keyboard_transitions(&a, &b, false), REPORT_TRANSITION_PRESS);
+    EXPECT_EQ(usb_report_keyboard_transitions(&b, &a, false), REPORT_TRANSITION_RELEASE);
+    EXPECT_EQ(usb_report_keyboard_transitions(&b, &b, false), 0);
+
+    a.keys[1] = KC_A;
+    EXPECT_EQ(usb_report_keyboard_transitions(&a, &b, false), 0);
+
+    a.mods = MOD_BIT(KC_LEFT_SHIFT);
+    EXPECT_EQ(usb_report_keyboard_transitions(&a, &b, false), REPORT_TRANSITION_RELEASE);
+
+    b.keys[0] = KC_B;
+    EXPECT_EQ(usb_report_keyboard_transitions(&a, &b, false), REPORT_TRANSITION_PRESS | REPORT_TRANSITION_RELEASE);
+}
+
+TEST_F(KeyboardReportQueue, FullQueueCollapsesIntoNewestState) {
+    report_keyboard_t report = {};
+    for (int i = 0; i < USB_REPORT_QUEUE_SIZE; i++) {
+        report_keyboard_t next = report;
+        next.keys[0]           = report.keys[0] ? 0 : KC_A;
+        EXPECT_TRUE(usb_report_queue_push(&host.queue, &next, sizeof(next), REPORT_KIND_KEYBOARD, usb_report_keyboard_transitions(&report, &next, false)));
+        report = next;
+    }
+    EXPECT_EQ(host.queue.count, USB_REPORT_QUEUE_SIZE);
+
+    // Takes the place of the newest report, the host misses a state but not the latest one
+    report_keyboard_t next = report;
+    next.keys[0]           = report.keys[0] ? 0 : KC_A;
+    EXPECT_FALSE(usb_report_queue_push(&host.queue, &next, sizeof(next), REPORT_KIND_KEYBOARD, usb_report_keyboard_transitions(&report, &next, false)));
+    EXPECT_EQ(host.queue.count, USB_REPORT_QUEUE_SIZE);
+    EXPECT_EQ(memcmp(&host.queue.entries[USB_REPORT_QUEUE_SIZE - 1].report.keyboard, &next, sizeof(next)), 0);
+
+    // Nothing changes, so it can stand in for the waiting report
+    EXPECT_TRUE(usb_report_queue_push(&host.queue, &next, sizeof(next), REPORT_KIND_KEYBOARD, 0));
+    EXPECT_EQ(host.queue.count, USB_REPORT_QUEUE_SIZE);
+}
+
+TEST(ReportQueue, FullQueueMakesRoomForAnotherControl) {
+    ReportQueueHost   host;
+    report_keyboard_t keyboard = {};
+
+    // The first report is being transmitted, the rest wait behind it
+    for (int i = 0; i < USB_REPORT_QUEUE_SIZE; i++) {
+        keyboard.keys[0] = (i % 2 == 0) ? KC_A : 0;
+        host.send_unpaced(&keyboard, sizeof(keyboard), REPORT_KIND_KEYBOARD, (i % 2 == 0) ? REPORT_TRANSITION_PRESS : REPORT_TRANSITION_RELEASE);
+    }
+    EXPECT_EQ(host.queue.count, USB_REPORT_QUEUE_SIZE);
+
+    // Two waiting keyboard reports are collapsed to make room, the mouse report is still sent
+    report_mouse_t mouse = {};
+    mouse.buttons        = 1;
+    EXPECT_FALSE(host.send_unpaced(&mouse, sizeof(mouse), REPORT_KIND_MOUSE, 0));
+    host.drain();
+
+    ASSERT_EQ(host.received.size(), (size_t)USB_REPORT_QUEUE_SIZE);
+    EXPECT_EQ(host.received.back().kind, REPORT_KIND_MOUSE);
+    EXPECT_EQ(host.received.back().report.mouse.buttons, 1);
+    EXPECT_EQ(memcmp(&host.received[USB_REPORT_QUEUE_SIZE - 2].report.keyboard, &keyboard, sizeof(keyboard)), 0);
+}
+
+TEST_F(KeyboardReportQueue, SendStringBurstIsNotLost) {
+    // What SEND_STRING("hello") does: a press and a release per character, with nothing collected in between
+    for (auto c : std::string("hello")) {
+        send_keys(0, {(uint8_t)(KC_A + (c - 'a'))});
+        send_keys(0, {});
+    }
+    host.drain();
+
+    std::string typed;
+    report_keyboard_t previous = {};
+    for (auto &report : received()) {
+        for (auto key : held(report)) {
+            if (held(previous).count(key) == 0) typed += (char)('a' + (key - KC_A));
+        }
+        previous = report;
+    }
+    EXPECT_EQ(typed, "hello");
+}
+
+TEST_F(KeyboardReportQueue, ShiftedBurstKeepsModifierOrder) {
+    // "Hi": the shift has to be down before the h, and up before the i
+    send_keys(MOD_BIT(KC_LEFT_SHIFT), {});
+    send_keys(MOD_BIT(KC_LEFT_SHIFT), {KC_H});
+    send_keys(MOD_BIT(KC_LEFT_SHIFT), {});
+    send_keys(0, {});
+    send_keys(0, {KC_I});
+    send_keys(0, {});
+    host.drain();
+
+    EXPECT_EQ(states(received()), states(generated));
+}
+
+TEST_F(KeyboardReportQueue, RandomBurstsKeepEveryState) {
+    std::mt19937                   rng(0x5eed);
+    std::set<uint8_t>              keys;
+    uint8_t                        mods = 0;
+    const std::vector<uint8_t>     pool = {KC_A, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H};
+
+    for (int i = 0; i < 5000; i++) {
+        switch (rng() % 4) {
+            case 0:
+                mods ^= 1 << (rng() % 8);
+                break;
+            case 1:
+                // Repeats the current state, which is allowed to be merged away
+                break;
+            default: {
+                uint8_t key = pool[rng() % pool.size()];
+                if (keys.count(key)) {
+                    keys.erase(key);
+                } else if (keys.size() < KEYBOARD_REPORT_KEYS) {
+                    keys.insert(key);
+                }
+                break;
+            }
+        }
+        send_keys(mods, keys);
+
+        // The host collects reports at its own pace, often not at all between two sends
+        while (rng() % 3 == 0) {
+            host.complete();
+        }
+        EXPECT_LE(host.queue.count, USB_REPORT_QUEUE_SIZE);
+    }
+    host.drain();
+
+    EXPECT_EQ(states(received()), states(generated));
+}
+
+TEST_F(KeyboardReportQueue, UnpacedBurstsEndInLatestState) {
+    std::mt19937               rng(0xfade);
+    std::set<uint8_t>          keys;
+    const std::vector<uint8_t> pool = {KC_A, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H};
+
+    for (int i = 0; i < 5000; i++) {
+        uint8_t key = pool[rng() % pool.size()];
+        if (keys.count(key)) {
+            keys.erase(key);
+        } else if (keys.size() < KEYBOARD_REPORT_KEYS) {
+            keys.insert(key);
+        }
+        send_keys(0, keys, false);
+
+        // Never waits, however slowly the host collects reports
+        while (rng() % 5 == 0) {
+            host.complete();
+        }
+        EXPECT_LE(host.queue.count, USB_REPORT_QUEUE_SIZE);
+
+        // Once everything queued is out, the host holds exactly what was sent last
+        if (rng() % 100 == 0) {
+            host.drain();
+            EXPECT_EQ(held(received().back()), keys);
+        }
+    }
+    host.drain();
+
+    EXPECT_EQ(held(received().back()), keys);
+}
+
+TEST(MouseReportQueue, MovementAddsUpAndButtonsAreKept) {
+    ReportQueueHost      host;
+    std::mt19937         rng(0xc0ffee);
+    std::vector<uint8_t> buttons_sent;
+    int32_t              x_sent = 0, y_sent = 0, v_sent = 0;
+
+    for (int i = 0; i < 2000; i++) {
+        report_mouse_t report = {};
+        report.buttons        = (rng() % 16 == 0) ? (rng() % 4) : (buttons_sent.empty() ? 0 : buttons_sent.back());
+        report.x              = (int8_t)(rng() % 255 - 127);
+        report.y              = (int8_t)(rng() % 255 - 127);
+        report.v              = (int8_t)(rng() % 3 - 1);
+        host.send(&report, sizeof(report), REPORT_KIND_MOUSE, 0);
+
+        x_sent += report.x;
+        y_sent += report.y;
+        v_sent += report.v;
+        if (buttons_sent.empty() || buttons_sent.back() != report.buttons) buttons_sent.push_back(report.buttons);
+
+        while (rng() % 4 == 0) {
+            host.complete();
+        }
+    }
+    host.drain();
+
+    std::vector<uint8_t> buttons_received;
+    int32_t              x_received = 0, y_received = 0, v_received = 0;
+    for (auto &entry : host.received) {
+        x_received += entry.report.mouse.x;
+        y_received += entry.report.mouse.y;
+        v_received += entry.report.mouse.v;
+        if (buttons_received.empty() || buttons_received.back() != entry.report.mouse.buttons) buttons_received.push_back(entry.report.mouse.buttons);
+    }
+
+    EXPECT_EQ(x_received, x_sent);
+    EXPECT_EQ(y_received, y_sent);
+    EXPECT_EQ(v_received, v_sent);
+    EXPECT_EQ(buttons_received, buttons_sent);
+    EXPECT_LT(host.received.size(), 2000u);
+}
+
+TEST(ExtraReportQueue, TapsAreKept) {
+    ReportQueueHost       host;
+    std::vector<uint16_t> sent;
+
+    for (int i = 0; i < 20; i++) {
+        report_extra_t report = {};
+        report.report_id      = REPORT_ID_CONSUMER;
+        report.usage          = (i % 2 == 0) ? AUDIO_VOL_UP : 0;
+        host.send(&report, sizeof(report), REPORT_KIND_EXTRA, 0);
+        sent.push_back(report.usage);
+    }
+    host.drain();
+
+    std::vector<uint16_t> received;
+    for (auto &entry : host.received) {
+        received.push_back(entry.report.extra.usage);
+    }
+    EXPECT_EQ(received, sent);
+}
+
+TEST(ExtraReportQueue, ChangesOfUsageAreKept) {
+    ReportQueueHost       host;
+    std::vector<uint16_t> sent = {AUDIO_VOL_UP, AUDIO_VOL_DOWN, AUDIO_VOL_DOWN, AUDIO_MUTE, 0, 0, AUDIO_VOL_UP};
+
+    for (auto usage : sent) {
+        report_extra_t report = {};
+        report.report_id      = REPORT_ID_CONSUMER;
+        report.usage          = usage;
+        host.send(&report, sizeof(report), REPORT_KIND_EXTRA, 0);
+    }
+    host.drain();
+
+    // Repeats are merged away, every change reaches the host
+    std::vector<uint16_t> received;
+    for (auto &entry : host.received) {
+        received.push_back(entry.report.extra.usage);
+    }
+    EXPECT_EQ(received, std::vector<uint16_t>({AUDIO_VOL_UP, AUDIO_VOL_DOWN, AUDIO_MUTE, 0, AUDIO_VOL_UP}));
+}
+
+TEST(ReportQueue, UnknownReportsAreNeverMerged) {
+    ReportQueueHost host;
+    uint8_t         report[8] = {};
+
+    for (uint8_t i = 0; i < 10; i++) {
+        report[0] = i;
+        host.send(report, sizeof(report), REPORT_KIND_NONE, 0);
+    }
+    host.drain();
+
+    ASSERT_EQ(host.received.size(), 10u);
+    for (uint8_t i = 0; i < 10; i++) {
+        EXPECT_EQ(((uint8_t *)&host.received[i].report)[0], i);
+    }
+}
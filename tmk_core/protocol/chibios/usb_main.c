@@ -43,6 +43,7 @@
 #include "usb_device_state.h"
 #include "usb_descriptor.h"
 #include "usb_driver.h"
+#include "usb_report_queue.h"
 
 #ifdef NKRO_ENABLE
 #    include "keycode_config.h"
@@ -129,28 +130,61 @@ static const USBDescriptor *usb_get_descriptor_cb(USBDriver *usbp, uint8_t dtype
         return &desc;
 }
 
+/* ---------------------------------------------------------
+ *                      Report queues
+ * ---------------------------------------------------------
+ */
+
+/* IN endpoint state for the HID report endpoints */
+typedef struct {
+    USBInEndpointState in_state; /* must be first, so the queue can be found from usbp->epc[ep]->in_state */
+    usb_report_queue_t queue;
+} report_ep_state_t;
+
+static inline usb_report_queue_t *usb_report_queue_get(USBDriver *usbp, usbep_t ep) {
+    return &((report_ep_state_t *)usbp->epc[ep]->in_state)->queue;
+}
+
+/* Starts transmitting the oldest queued report if the endpoint is idle
+ * must be called from locked state */
+static void usb_report_queue_start_i(USBDriver *usbp, usbep_t ep, usb_report_queue_t *queue) {
+    if (usbGetTransmitStatusI(usbp, ep)) {
+        return;
+    }
+
+    usb_report_queue_entry_t *entry = usb_report_queue_start(queue);
+    if (entry != NULL) {
+        usbStartTransmitI(usbp, ep, (uint8_t *)&entry->report, entry->size);
+    }
+}
+
 /*
- * USB notification callback that does nothing.  Needed to work around bugs in
- * some USB LLDs that fail to resume the waiting thread when the notification
- * callback pointer is NULL.
+ * IN notification callback for the HID report endpoints, called from ISR.
+ * Releases the report that was just sent and starts on the next one, so that
+ * usb_report_queue_send() never has to wait for the endpoint.
  */
-static void dummy_usb_cb(USBDriver *usbp, usbep_t ep) {
-    (void)usbp;
-    (void)ep;
+static void usb_report_in_cb(USBDriver *usbp, usbep_t ep) {
+    usb_report_queue_t *queue = usb_report_queue_get(usbp, ep);
+
+    osalSysLockFromISR();
+    /* the keyboard idle timer transmits outside of the queue, so there may be nothing to release */
+    usb_report_queue_release(queue);
+    usb_report_queue_start_i(usbp, ep, queue);
+    osalSysUnlockFromISR();
 }
 
 #ifndef KEYBOARD_SHARED_EP
 /* keyboard endpoint state structure */
-static USBInEndpointState kbd_ep_state;
+static report_ep_state_t kbd_ep_state;
 /* keyboard endpoint initialization structure (IN) - see USBEndpointConfig comment at top of file */
 static const USBEndpointConfig kbd_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    usb_report_in_cb,       /* IN notification callback */
     NULL,                   /* OUT notification callback */
     KEYBOARD_EPSIZE,        /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
-    &kbd_ep_state,          /* IN Endpoint state */
+    &kbd_ep_state.in_state, /* IN Endpoint state */
     NULL,                   /* OUT endpoint state */
     usb_lld_endpoint_fields /* USB driver specific endpoint fields */
 };
@@ -158,73 +192,73 @@ static const USBEndpointConfig kbd_ep_config = {
 
 #if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
 /* mouse endpoint state structure */
-static USBInEndpointState mouse_ep_state;
+static report_ep_state_t mouse_ep_state;
 
 /* mouse endpoint initialization structure (IN) - see USBEndpointConfig comment at top of file */
 static const USBEndpointConfig mouse_ep_config = {
-    USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
-    NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
-    NULL,                   /* OUT notification callback */
-    MOUSE_EPSIZE,           /* IN maximum packet size */
-    0,                      /* OUT maximum packet size */
-    &mouse_ep_state,        /* IN Endpoint state */
-    NULL,                   /* OUT endpoint state */
-    usb_lld_endpoint_fields /* USB driver specific endpoint fields */
+    USB_EP_MODE_TYPE_INTR,    /* Interrupt EP */
+    NULL,                     /* SETUP packet notification callback */
+    usb_report_in_cb,         /* IN notification callback */
+    NULL,                     /* OUT notification callback */
+    MOUSE_EPSIZE,             /* IN maximum packet size */
+    0,                        /* OUT maximum packet size */
+    &mouse_ep_state.in_state, /* IN Endpoint state */
+    NULL,                     /* OUT endpoint state */
+    usb_lld_endpoint_fields   /* USB driver specific endpoint fields */
 };
 #endif
 
 #ifdef SHARED_EP_ENABLE
 /* shared endpoint state structure */
-static USBInEndpointState shared_ep_state;
+static report_ep_state_t shared_ep_state;
 
 /* shared endpoint initialization structure (IN) - see USBEndpointConfig comment at top of file */
 static const USBEndpointConfig shared_ep_config = {
-    USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
-    NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
-    NULL,                   /* OUT notification callback */
-    SHARED_EPSIZE,          /* IN maximum packet size */
-    0,                      /* OUT maximum packet size */
-    &shared_ep_state,       /* IN Endpoint state */
-    NULL,                   /* OUT endpoint state */
-    usb_lld_endpoint_fields /* USB driver specific endpoint fields */
+    USB_EP_MODE_TYPE_INTR,     /* Interrupt EP */
+    NULL,                      /* SETUP packet notification callback */
+    usb_report_in_cb,          /* IN notification callback */
+    NULL,                      /* OUT notification callback */
+    SHARED_EPSIZE,             /* IN maximum packet size */
+    0,                         /* OUT maximum packet size */
+    &shared_ep_state.in_state, /* IN Endpoint state */
+    NULL,                      /* OUT endpoint state */
+    usb_lld_endpoint_fields    /* USB driver specific endpoint fields */
 };
 #endif
 
 #if defined(JOYSTICK_ENABLE) && !defined(JOYSTICK_SHARED_EP)
 /* joystick endpoint state structure */
-static USBInEndpointState joystick_ep_state;
+static report_ep_state_t joystick_ep_state;
 
 /* joystick endpoint initialization structure (IN) - see USBEndpointConfig comment at top of file */
 static const USBEndpointConfig joystick_ep_config = {
-    USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
-    NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
-    NULL,                   /* OUT notification callback */
-    JOYSTICK_EPSIZE,        /* IN maximum packet size */
-    0,                      /* OUT maximum packet size */
-    &joystick_ep_state,     /* IN Endpoint state */
-    NULL,                   /* OUT endpoint state */
-    usb_lld_endpoint_fields /* USB driver specific endpoint fields */
+    USB_EP_MODE_TYPE_INTR,       /* Interrupt EP */
+    NULL,                        /* SETUP packet notification callback */
+    usb_report_in_cb,            /* IN notification callback */
+    NULL,                        /* OUT notification callback */
+    JOYSTICK_EPSIZE,             /* IN maximum packet size */
+    0,                           /* OUT maximum packet size */
+    &joystick_ep_state.in_state, /* IN Endpoint state */
+    NULL,                        /* OUT endpoint state */
+    usb_lld_endpoint_fields      /* USB driver specific endpoint fields */
 };
 #endif
 
 #if defined(DIGITIZER_ENABLE) && !defined(DIGITIZER_SHARED_EP)
 /* digitizer endpoint state structure */
-static USBInEndpointState digitizer_ep_state;
+static report_ep_state_t digitizer_ep_state;
 
 /* digitizer endpoint initialization structure (IN) - see USBEndpointConfig comment at top of file */
 static const USBEndpointConfig digitizer_ep_config = {
-    USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
-    NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
-    NULL,                   /* OUT notification callback */
-    DIGITIZER_EPSIZE,       /* IN maximum packet size */
-    0,                      /* OUT maximum packet size */
-    &digitizer_ep_state,    /* IN Endpoint state */
-    NULL,                   /* OUT endpoint state */
-    usb_lld_endpoint_fields /* USB driver specific endpoint fields */
+    USB_EP_MODE_TYPE_INTR,        /* Interrupt EP */
+    NULL,                         /* SETUP packet notification callback */
+    usb_report_in_cb,             /* IN notification callback */
+    NULL,                         /* OUT notification callback */
+    DIGITIZER_EPSIZE,             /* IN maximum packet size */
+    0,                            /* OUT maximum packet size */
+    &digitizer_ep_state.in_state, /* IN Endpoint state */
+    NULL,                         /* OUT endpoint state */
+    usb_lld_endpoint_fields       /* USB driver specific endpoint fields */
 };
 #endif
 
@@ -508,18 +542,23 @@ static void usb_event_cb(USBDriver *usbp, usbevent_t event) {
             osalSysLockFromISR();
             /* Enable the endpoints specified into the configuration. */
 #ifndef KEYBOARD_SHARED_EP
+            usb_report_queue_reset(&kbd_ep_state.queue);
             usbInitEndpointI(usbp, KEYBOARD_IN_EPNUM, &kbd_ep_config);
 #endif
 #if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
+            usb_report_queue_reset(&mouse_ep_state.queue);
             usbInitEndpointI(usbp, MOUSE_IN_EPNUM, &mouse_ep_config);
 #endif
 #ifdef SHARED_EP_ENABLE
+            usb_report_queue_reset(&shared_ep_state.queue);
             usbInitEndpointI(usbp, SHARED_IN_EPNUM, &shared_ep_config);
 #endif
 #if defined(JOYSTICK_ENABLE) && !defined(JOYSTICK_SHARED_EP)
+            usb_report_queue_reset(&joystick_ep_state.queue);
             usbInitEndpointI(usbp, JOYSTICK_IN_EPNUM, &joystick_ep_config);
 #endif
 #if defined(DIGITIZER_ENABLE) && !defined(DIGITIZER_SHARED_EP)
+            usb_report_queue_reset(&digitizer_ep_state.queue);
             usbInitEndpointI(usbp, DIGITIZER_IN_EPNUM, &digitizer_ep_config);
 #endif
             for (int i = 0; i < NUM_USB_DRIVERS; i++) {
@@ -859,36 +898,65 @@ uint8_t keyboard_leds(void) {
     return keyboard_led_state;
 }
 
-void send_report(uint8_t endpoint, void *report, size_t size) {
+/* Queues a report for the given IN endpoint, it's sent from usb_report_in_cb() once the
+ * reports ahead of it are out. The report is copied, so the caller's buffer can be reused
+ * immediately. Never waits: if the queue is full, the report is collapsed into the newest
+ * queued state for the same control, see usb_report_queue_push(). Callers that produce
+ * bursts of reports pace themselves with keyboard_ready().
+ * not callable from ISR or locked state */
+static void usb_report_queue_send(uint8_t endpoint, const void *report, size_t size, report_kind_t kind, uint8_t transitions) {
     osalSysLock();
     if (usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE) {
         osalSysUnlock();
         return;
     }
 
-    if (usbGetTransmitStatusI(&USB_DRIVER, endpoint)) {
-        /* Need to either suspend, or loop and call unlock/lock during
-         * every iteration - otherwise the system will remain locked,
-         * no interrupts served, so USB not going through as well.
-         * Note: for suspend, need USB_USE_WAIT == TRUE in halconf.h */
-        if (osalThreadSuspendTimeoutS(&(&USB_DRIVER)->epc[endpoint]->in_state->thread, TIME_MS2I(10)) == MSG_TIMEOUT) {
-            osalSysUnlock();
-            return;
-        }
+    usb_report_queue_t *queue = usb_report_queue_get(&USB_DRIVER, endpoint);
+
+    /* A transfer can be lost across a suspend without its callback ever running */
+    if (queue->in_flight && !usbGetTransmitStatusI(&USB_DRIVER, endpoint)) {
+        usb_report_queue_release(queue);
     }
-    usbStartTransmitI(&USB_DRIVER, endpoint, report, size);
+
+    usb_report_queue_push(queue, report, size, kind, transitions);
+    usb_report_queue_start_i(&USB_DRIVER, endpoint, queue);
     osalSysUnlock();
 }
 
+void send_report(uint8_t endpoint, void *report, size_t size) {
+    usb_report_queue_send(endpoint, report, size, REPORT_KIND_NONE, 0);
+}
+
+/* check whether the queue the next keyboard report goes to has room for it
+ * not callable from ISR or locked state */
+bool keyboard_ready(void) {
+    uint8_t ep = KEYBOARD_IN_EPNUM;
+#ifdef NKRO_ENABLE
+    if (keyboard_protocol && keymap_config.nkro) {
+        ep = SHARED_IN_EPNUM;
+    }
+#endif
+
+    osalSysLock();
+    bool ready = usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE || usb_report_queue_has_room(usb_report_queue_get(&USB_DRIVER, ep));
+    osalSysUnlock();
+    return ready;
+}
+
 /* prepare and start sending a report IN
  * not callable from ISR or locked state */
 void send_keyboard(report_keyboard_t *report) {
-    uint8_t ep   = KEYBOARD_IN_EPNUM;
-    size_t  size = KEYBOARD_REPORT_SIZE;
+    uint8_t ep          = KEYBOARD_IN_EPNUM;
+    size_t  size        = KEYBOARD_REPORT_SIZE;
+    bool    nkro        = false;
+#ifdef NKRO_ENABLE
+    nkro = keyboard_protocol && keymap_config.nkro;
+#endif
+    uint8_t transitions = usb_report_keyboard_transitions(&keyboard_report_sent, report, nkro);
 
     /* If we're in Boot Protocol, don't send any report ID or other funky fields */
     if (!keyboard_protocol) {
-        send_report(ep, &report->mods, 8);
+        usb_report_queue_send(ep, &report->mods, 8, REPORT_KIND_KEYBOARD, transitions);
     } else {
 #ifdef NKRO_ENABLE
         if (keymap_config.nkro) {
@@ -897,7 +965,7 @@ void send_keyboard(report_keyboard_t *report) {
         }
 #endif
 
-        send_report(ep, report, size);
+        usb_report_queue_send(ep, report, size, REPORT_KIND_KEYBOARD, transitions);
     }
 
     keyboard_report_sent = *report;
@@ -908,9 +976,24 @@ void send_keyboard(report_keyboard_t *report) {
  * ---------------------------------------------------------
  */
 
+/* check whether the mouse endpoint has nothing waiting behind the report it's sending,
+ * so that movement can be held back and combined until it has
+ * not callable from ISR or locked state */
+bool mouse_ready(void) {
+    bool ready = true;
+#ifdef MOUSE_ENABLE
+    osalSysLock();
+    if (usbGetDriverStateI(&USB_DRIVER) == USB_ACTIVE) {
+        ready = usb_report_queue_waiting(usb_report_queue_get(&USB_DRIVER, MOUSE_IN_EPNUM)) == 0;
+    }
+    osalSysUnlock();
+#endif
+    return ready;
+}
+
 void send_mouse(report_mouse_t *report) {
 #ifdef MOUSE_ENABLE
-    send_report(MOUSE_IN_EPNUM, report, sizeof(report_mouse_t));
+    usb_report_queue_send(MOUSE_IN_EPNUM, report, sizeof(report_mouse_t), REPORT_KIND_MOUSE, 0);
     mouse_report_sent = *report;
 #endif
 }
@@ -922,25 +1005,25 @@ void send_mouse(report_mouse_t *report) {
 
 void send_extra(report_extra_t *report) {
 #ifdef EXTRAKEY_ENABLE
-    send_report(SHARED_IN_EPNUM, report, sizeof(report_extra_t));
+    usb_report_queue_send(SHARED_IN_EPNUM, report, sizeof(report_extra_t), REPORT_KIND_EXTRA, 0);
 #endif
 }
 
 void send_programmable_button(report_programmable_button_t *report) {
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-    send_report(SHARED_IN_EPNUM, report, sizeof(report_programmable_button_t));
+    usb_report_queue_send(SHARED_IN_EPNUM, report, sizeof(report_programmable_button_t), REPORT_KIND_PROGRAMMABLE_BUTTON, 0);
 #endif
 }
 
 void send_joystick(report_joystick_t *report) {
 #ifdef JOYSTICK_ENABLE
-    send_report(JOYSTICK_IN_EPNUM, report, sizeof(report_joystick_t));
+    usb_report_queue_send(JOYSTICK_IN_EPNUM, report, sizeof(report_joystick_t), REPORT_KIND_JOYSTICK, 0);
 #endif
 }
 
 void send_digitizer(report_digitizer_t *report) {
 #ifdef DIGITIZER_ENABLE
-    send_report(DIGITIZER_IN_EPNUM, report, sizeof(report_digitizer_t));
+    usb_report_queue_send(DIGITIZER_IN_EPNUM, report, sizeof(report_digitizer_t), REPORT_KIND_DIGITIZER, 0);
 #endif
 }
 
@@ -0,0 +1,258 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <string.h>
+#include "usb_report_queue.h"
+
+#ifdef MOUSE_EXTENDED_REPORT
+#    define MOUSE_REPORT_XY_MIN INT16_MIN
+#    define MOUSE_REPORT_XY_MAX INT16_MAX
+#else
+#    define MOUSE_REPORT_XY_MIN INT8_MIN
+#    define MOUSE_REPORT_XY_MAX INT8_MAX
+#endif
+
+_Static_assert(USB_REPORT_QUEUE_SIZE >= 2, "USB_REPORT_QUEUE_SIZE must leave room for a report besides the one being transmitted");
+
+static inline usb_report_queue_entry_t *usb_report_queue_at(usb_report_queue_t *queue, uint8_t index) {
+    return &queue->entries[(queue->head + index) % USB_REPORT_QUEUE_SIZE];
+}
+
+void usb_report_queue_reset(usb_report_queue_t *queue) {
+    queue->head      = 0;
+    queue->count     = 0;
+    queue->in_flight = false;
+}
+
+/* Folds a new report into a queued one that hasn't been transmitted yet. Only done when the host can't tell the
+ * difference: reports carrying presses or releases that would be lost or reordered are never merged. */
+static bool usb_report_queue_merge(usb_report_queue_entry_t *pending, const void *report, size_t size, report_kind_t kind, uint8_t transitions) {
+    if (kind == REPORT_KIND_NONE || pending->kind != kind || pending->size != size) {
+        return false;
+    }
+
+    switch (kind) {
+        case REPORT_KIND_KEYBOARD:
+            /* Every press and release has to reach the host in order, or taps are lost and modifiers end up
+             * applied to the wrong key. Only a report that doesn't change any key may replace the waiting one. */
+            if (transitions != 0) {
+                return false;
+            }
+            break;
+
+#ifdef MOUSE_ENABLE
+        case REPORT_KIND_MOUSE: {
+            /* Movement adds up, button changes are kept as separate reports */
+            const report_mouse_t *mouse  = (const report_mouse_t *)report;
+            report_mouse_t       *queued = &pending->report.mouse;
+            if (mouse->buttons != queued->buttons) {
+                return false;
+            }
+
+            int32_t x = (int32_t)queued->x + mouse->x;
+            int32_t y = (int32_t)queued->y + mouse->y;
+            int16_t v = (int16_t)queued->v + mouse->v;
+            int16_t h = (int16_t)queued->h + mouse->h;
+            if (x < MOUSE_REPORT_XY_MIN || x > MOUSE_REPORT_XY_MAX || y < MOUSE_REPORT_XY_MIN || y > MOUSE_REPORT_XY_MAX || v < INT8_MIN || v > INT8_MAX || h < INT8_MIN || h > INT8_MAX) {
+                return false;
+            }
+
+            queued->x = x;
+            queued->y = y;
+            queued->v = v;
+            queued->h = h;
+#    ifdef MOUSE_EXTENDED_REPORT
+            queued->boot_x = (queued->x > 127) ? 127 : ((queued->x < -127) ? -127 : queued->x);
+            queued->boot_y = (queued->y > 127) ? 127 : ((queued->y < -127) ? -127 : queued->y);
+#    endif
+            return true;
+        }
+#endif
+
+#ifdef EXTRAKEY_ENABLE
+        case REPORT_KIND_EXTRA: {
+            /* System and consumer usages share the endpoint, but are separate controls */
+            const report_extra_t *extra  = (const report_extra_t *)report;
+            report_extra_t       *queued = &pending->report.extra;
+            if (extra->report_id != queued->report_id) {
+                return false;
+            }
+            /* Any change of usage releases one and/or presses another, so only a repeat of the same one is merged */
+            if (extra->usage != queued->usage) {
+                return false;
+            }
+            break;
+        }
+#endif
+
+        default:
+            /* Joystick, digitizer and programmable button reports carry button states, so they're always kept */
+            return false;
+    }
+
+    memcpy(&pending->report, report, size);
+    return true;
+}
+
+/* Whether a queued report and a new one are for the same control, so that the new one can stand in for it */
+static bool usb_report_queue_same_control(const usb_report_queue_entry_t *entry, const void *report, size_t size, report_kind_t kind) {
+    if (kind == REPORT_KIND_NONE || entry->kind != kind || entry->size != size) {
+        return false;
+    }
+#ifdef EXTRAKEY_ENABLE
+    /* System and consumer usages share the endpoint, but are separate controls */
+    if (kind == REPORT_KIND_EXTRA && entry->report.extra.report_id != ((const report_extra_t *)report)->report_id) {
+        return false;
+    }
+#endif
+    return true;
+}
+
+/* Replaces a waiting report with a newer state of the same control. The host never sees the state in between, but
+ * ends up with the right keys and buttons held; mouse movement still adds up, as far as the report can hold it. */
+static void usb_report_queue_collapse(usb_report_queue_entry_t *entry, const void *report, size_t size, uint8_t transitions) {
+#ifdef MOUSE_ENABLE
+    if (entry->kind == REPORT_KIND_MOUSE) {
+        const report_mouse_t *mouse  = (const report_mouse_t *)report;
+        report_mouse_t       *queued = &entry->report.mouse;
+        int32_t               x      = (int32_t)queued->x + mouse->x;
+        int32_t               y      = (int32_t)queued->y + mouse->y;
+        int16_t               v      = (int16_t)queued->v + mouse->v;
+        int16_t               h      = (int16_t)queued->h + mouse->h;
+
+        queued->buttons = mouse->buttons;
+        queued->x       = (x > MOUSE_REPORT_XY_MAX) ? MOUSE_REPORT_XY_MAX : ((x < MOUSE_REPORT_XY_MIN) ? MOUSE_REPORT_XY_MIN : x);
+        queued->y       = (y > MOUSE_REPORT_XY_MAX) ? MOUSE_REPORT_XY_MAX : ((y < MOUSE_REPORT_XY_MIN) ? MOUSE_REPORT_XY_MIN : y);
+        queued->v       = (v > INT8_MAX) ? INT8_MAX : ((v < INT8_MIN) ? INT8_MIN : v);
+        queued->h       = (h > INT8_MAX) ? INT8_MAX : ((h < INT8_MIN) ? INT8_MIN : h);
+#    ifdef MOUSE_EXTENDED_REPORT
+        queued->boot_x = (queued->x > 127) ? 127 : ((queued->x < -127) ? -127 : queued->x);
+        queued->boot_y = (queued->y > 127) ? 127 : ((queued->y < -127) ? -127 : queued->y);
+#    endif
+        entry->transitions |= transitions;
+        return;
+    }
+#endif
+
+    memcpy(&entry->report, report, size);
+    entry->transitions |= transitions;
+}
+
+/* Frees up a slot in a full queue by collapsing the newest waiting report into an older one for the same control.
+ * Returns false if every waiting report is for a different control. */
+static bool usb_report_queue_make_room(usb_report_queue_t *queue) {
+    uint8_t first = queue->in_flight ? 1 : 0;
+
+    for (uint8_t i = queue->count - 1; i > first; i--) {
+        usb_report_queue_entry_t *newer = usb_report_queue_at(queue, i);
+        for (uint8_t j = i; j-- > first;) {
+            usb_report_queue_entry_t *older = usb_report_queue_at(queue, j);
+            if (usb_report_queue_same_control(older, &newer->report, newer->size, newer->kind)) {
+                usb_report_queue_collapse(older, &newer->report, newer->size, newer->transitions);
+                for (uint8_t k = i; k + 1 < queue->count; k++) {
+                    *usb_report_queue_at(queue, k) = *usb_report_queue_at(queue, k + 1);
+                }
+                queue->count--;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool usb_report_queue_push(usb_report_queue_t *queue, const void *report, size_t size, report_kind_t kind, uint8_t transitions) {
+    /* Larger than any report this queue knows about, there's no way to send it */
+    if (size > sizeof(queue->entries[0].report)) {
+        return true;
+    }
+
+    /* Only the newest report can take the new one, and only while it hasn't started transmitting */
+    if (usb_report_queue_waiting(queue) > 0) {
+        usb_report_queue_entry_t *newest = usb_report_queue_at(queue, queue->count - 1);
+        if (usb_report_queue_merge(newest, report, size, kind, transitions)) {
+            return true;
+        }
+    }
+
+    bool kept = true;
+    if (!usb_report_queue_has_room(queue)) {
+        /* Full: the newest waiting report for the same control takes the new state instead */
+        for (uint8_t i = queue->count; i-- > (queue->in_flight ? 1 : 0);) {
+            usb_report_queue_entry_t *entry = usb_report_queue_at(queue, i);
+            if (usb_report_queue_same_control(entry, report, size, kind)) {
+                usb_report_queue_collapse(entry, report, size, transitions);
+                return false;
+            }
+        }
+
+        /* None waiting, so two that are for the same control are collapsed to make room */
+        if (!usb_report_queue_make_room(queue)) {
+            return false;
+        }
+        kept = false;
+    }
+
+    usb_report_queue_entry_t *entry = usb_report_queue_at(queue, queue->count);
+    memcpy(&entry->report, report, size);
+    entry->size        = size;
+    entry->kind        = kind;
+    entry->transitions = transitions;
+    queue->count++;
+    return kept;
+}
+
+usb_report_queue_entry_t *usb_report_queue_start(usb_report_queue_t *queue) {
+    if (queue->count == 0 || queue->in_flight) {
+        return NULL;
+    }
+
+    queue->in_flight = true;
+    return &queue->entries[queue->head];
+}
+
+void usb_report_queue_release(usb_report_queue_t *queue) {
+    if (queue->in_flight) {
+        queue->in_flight = false;
+        queue->head      = (queue->head + 1) % USB_REPORT_QUEUE_SIZE;
+        queue->count--;
+    }
+}
+
+uint8_t usb_report_queue_waiting(const usb_report_queue_t *queue) {
+    return queue->count - (queue->in_flight ? 1 : 0);
+}
+
+static bool keyboard_report_has_key(const report_keyboard_t *report, uint8_t key) {
+    for (int i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint8_t usb_report_keyboard_transitions(const report_keyboard_t *old_report, const report_keyboard_t *new_report, bool nkro) {
+    uint8_t transitions = 0;
+    uint8_t old_mods    = old_report->mods;
+    uint8_t new_mods    = new_report->mods;
+
+#ifdef NKRO_ENABLE
+    if (nkro) {
+        old_mods = old_report->nkro.mods;
+        new_mods = new_report->nkro.mods;
+        for (int i = 0; i < KEYBOARD_REPORT_BITS; i++) {
+            if (new_report->nkro.bits[i] & ~old_report->nkro.bits[i]) transitions |= REPORT_TRANSITION_PRESS;
+            if (old_report->nkro.bits[i] & ~new_report->nkro.bits[i]) transitions |= REPORT_TRANSITION_RELEASE;
+        }
+    } else
+#endif
+    {
+        for (int i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+            if (new_report->keys[i] && !keyboard_report_has_key(old_report, new_report->keys[i])) transitions |= REPORT_TRANSITION_PRESS;
+            if (old_report->keys[i] && !keyboard_report_has_key(new_report, old_report->keys[i])) transitions |= REPORT_TRANSITION_RELEASE;
+        }
+    }
+
+    if (new_mods & ~old_mods) transitions |= REPORT_TRANSITION_PRESS;
+    if (old_mods & ~new_mods) transitions |= REPORT_TRANSITION_RELEASE;
+    return transitions;
+}
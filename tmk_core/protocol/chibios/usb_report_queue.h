@@ -0,0 +1,96 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "report.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of reports each HID IN endpoint can hold, including the one being transmitted */
+#ifndef USB_REPORT_QUEUE_SIZE
+#    define USB_REPORT_QUEUE_SIZE 4
+#endif
+
+/* Decides how a report may be merged with the one queued before it */
+typedef enum {
+    REPORT_KIND_NONE,
+    REPORT_KIND_KEYBOARD,
+    REPORT_KIND_MOUSE,
+    REPORT_KIND_EXTRA,
+    REPORT_KIND_PROGRAMMABLE_BUTTON,
+    REPORT_KIND_JOYSTICK,
+    REPORT_KIND_DIGITIZER,
+} report_kind_t;
+
+/* What a keyboard report changed compared to the previous one */
+#define REPORT_TRANSITION_PRESS (1 << 0)
+#define REPORT_TRANSITION_RELEASE (1 << 1)
+
+typedef struct {
+    union {
+        report_keyboard_t keyboard;
+#ifdef EXTRAKEY_ENABLE
+        report_extra_t extra;
+#endif
+#ifdef MOUSE_ENABLE
+        report_mouse_t mouse;
+#endif
+#ifdef PROGRAMMABLE_BUTTON_ENABLE
+        report_programmable_button_t programmable_button;
+#endif
+#ifdef DIGITIZER_ENABLE
+        report_digitizer_t digitizer;
+#endif
+#ifdef JOYSTICK_ENABLE
+        report_joystick_t joystick;
+#endif
+    } report __attribute__((aligned(4)));
+    uint8_t size;
+    uint8_t kind;
+    uint8_t transitions;
+} usb_report_queue_entry_t;
+
+typedef struct {
+    usb_report_queue_entry_t entries[USB_REPORT_QUEUE_SIZE];
+    uint8_t                  head;
+    uint8_t                  count;
+    bool                     in_flight; /* entries[head] is being transmitted */
+} usb_report_queue_t;
+
+/* None of these lock, the caller is responsible for keeping the queue consistent with the endpoint's ISR */
+
+void usb_report_queue_reset(usb_report_queue_t *queue);
+
+/* Adds a report to the queue, or merges it into the newest one still waiting when that can be done without the host
+ * missing a press, a release or any movement. Never blocks: when the queue is full, the new report takes the place of
+ * the newest waiting report for the same control, or two waiting reports for the same control are collapsed to make
+ * room for it, so the host still ends up in the latest state. Only if every waiting report is for a different control
+ * is the new one dropped. Returns false if the host will miss a state, so that callers producing bursts of reports can
+ * pace themselves with usb_report_queue_has_room(). */
+bool usb_report_queue_push(usb_report_queue_t *queue, const void *report, size_t size, report_kind_t kind, uint8_t transitions);
+
+/* Marks the oldest queued report as being transmitted and returns it, or NULL if there is nothing to transmit or a
+ * transmission is already in progress */
+usb_report_queue_entry_t *usb_report_queue_start(usb_report_queue_t *queue);
+
+/* Frees the report that was being transmitted, if any */
+void usb_report_queue_release(usb_report_queue_t *queue);
+
+/* Number of reports waiting behind the one being transmitted */
+uint8_t usb_report_queue_waiting(const usb_report_queue_t *queue);
+
+static inline bool usb_report_queue_has_room(const usb_report_queue_t *queue) {
+    return queue->count < USB_REPORT_QUEUE_SIZE;
+}
+
+/* Works out whether a keyboard report presses and/or releases anything compared to the previous one */
+uint8_t usb_report_keyboard_transitions(const report_keyboard_t *old_report, const report_keyboard_t *new_report, bool nkro);
+
+#ifdef __cplusplus
+}
+#endif
@@ -21,6 +21,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "host.h"
 #include "util.h"
 #include "debug.h"
+#include "timer.h"
 
 #ifdef DIGITIZER_ENABLE
 #    include "digitizer.h"
@@ -40,6 +41,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 extern keymap_config_t keymap_config;
 #endif
 
+#ifndef HOST_KEYBOARD_READY_TIMEOUT
+#    define HOST_KEYBOARD_READY_TIMEOUT 10
+#endif
+
 static host_driver_t *driver;
 static uint16_t       last_system_usage   = 0;
 static uint16_t       last_consumer_usage = 0;
@@ -106,6 +111,38 @@ void host_keyboard_send(report_keyboard_t *report) {
     }
 }
 
+bool host_keyboard_ready(void) {
+#ifdef BLUETOOTH_ENABLE
+    if (where_to_send() == OUTPUT_BLUETOOTH) {
+        return true;
+    }
+#endif
+
+    if (!driver || !driver->keyboard_ready) return true;
+    return (*driver->keyboard_ready)();
+}
+
+/* Waits for the driver to have room for another keyboard report, for callers that generate several presses and
+ * releases in one go. Drivers that queue reports never wait themselves, and when their queue is full they collapse
+ * the report into one still waiting, so the host would miss the state in between. Gives up after
+ * HOST_KEYBOARD_READY_TIMEOUT milliseconds, in case the host has stopped collecting reports. */
+void host_keyboard_wait_ready(void) {
+    uint16_t start = timer_read();
+    while (!host_keyboard_ready() && timer_elapsed(start) < HOST_KEYBOARD_READY_TIMEOUT) {
+    }
+}
+
+bool host_mouse_ready(void) {
+#ifdef BLUETOOTH_ENABLE
+    if (where_to_send() == OUTPUT_BLUETOOTH) {
+        return true;
+    }
+#endif
+
+    if (!driver || !driver->mouse_ready) return true;
+    return (*driver->mouse_ready)();
+}
+
 void host_mouse_send(report_mouse_t *report) {
 #ifdef BLUETOOTH_ENABLE
     if (where_to_send() == OUTPUT_BLUETOOTH) {
@@ -41,7 +41,10 @@ host_driver_t *host_get_driver(void);
 uint8_t host_keyboard_leds(void);
 led_t   host_keyboard_led_state(void);
 void    host_keyboard_send(report_keyboard_t *report);
+bool    host_keyboard_ready(void);
+void    host_keyboard_wait_ready(void);
 void    host_mouse_send(report_mouse_t *report);
+bool    host_mouse_ready(void);
 void    host_system_send(uint16_t usage);
 void    host_consumer_send(uint16_t usage);
 void    host_programmable_button_send(uint32_t data);
@@ -18,6 +18,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "report.h"
 #ifdef MIDI_ENABLE
 #    include "midi.h"
@@ -28,6 +29,10 @@ typedef struct {
     void (*send_keyboard)(report_keyboard_t *);
     void (*send_mouse)(report_mouse_t *);
     void (*send_extra)(report_extra_t *);
+    /* optional, NULL means the keyboard endpoint is always considered ready */
+    bool (*keyboard_ready)(void);
+    /* optional, NULL means the mouse endpoint is always considered ready */
+    bool (*mouse_ready)(void);
 } host_driver_t;
 
 void send_joystick(report_joystick_t *report);
@@ -85,7 +85,9 @@ static uint8_t keyboard_leds(void);
 static void    send_keyboard(report_keyboard_t *report);
 static void    send_mouse(report_mouse_t *report);
 static void    send_extra(report_extra_t *report);
-host_driver_t  lufa_driver = {keyboard_leds, send_keyboard, send_mouse, send_extra};
+static bool    keyboard_ready(void);
+static bool    mouse_ready(void);
+host_driver_t  lufa_driver = {keyboard_leds, send_keyboard, send_mouse, send_extra, keyboard_ready, mouse_ready};
 
 void send_report(uint8_t endpoint, void *report, size_t size) {
     uint8_t timeout = 255;
@@ -580,6 +582,38 @@ static void send_keyboard(report_keyboard_t *report) {
     keyboard_report_sent = *report;
 }
 
+/** \brief Keyboard Ready
+ *
+ * Returns whether the endpoint the next keyboard report goes to can take it without send_report() having to wait for it
+ */
+static bool keyboard_ready(void) {
+    if (USB_DeviceState != DEVICE_STATE_Configured) return true;
+
+    uint8_t ep = KEYBOARD_IN_EPNUM;
+#ifdef NKRO_ENABLE
+    if (keyboard_protocol && keymap_config.nkro) {
+        ep = SHARED_IN_EPNUM;
+    }
+#endif
+    Endpoint_SelectEndpoint(ep);
+    return Endpoint_IsReadWriteAllowed();
+}
+
+/** \brief Mouse Ready
+ *
+ * Returns whether the mouse endpoint can take a report without send_report() having to wait for it
+ */
+static bool mouse_ready(void) {
+#ifdef MOUSE_ENABLE
+    if (USB_DeviceState != DEVICE_STATE_Configured) return true;
+
+    Endpoint_SelectEndpoint(MOUSE_IN_EPNUM);
+    return Endpoint_IsReadWriteAllowed();
+#else
+    return true;
+#endif
+}
+
 /** \brief Send Mouse
  *
  * FIXME: Needs doc
@@ -233,8 +233,9 @@ static uint8_t keyboard_leds(void);
 static void    send_keyboard(report_keyboard_t *report);
 static void    send_mouse(report_mouse_t *report);
 static void    send_extra(report_extra_t *report);
+static bool    keyboard_ready(void);
 
-static host_driver_t driver = {keyboard_leds, send_keyboard, send_mouse, send_extra};
+static host_driver_t driver = {keyboard_leds, send_keyboard, send_mouse, send_extra, keyboard_ready};
 
 host_driver_t *vusb_driver(void) {
     return &driver;
@@ -244,6 +245,11 @@ static uint8_t keyboard_leds(void) {
     return keyboard_led_state;
 }
 
+/* Whether the keyboard report buffer has room for another report */
+static bool keyboard_ready(void) {
+    return (kbuf_head + 1) % KBUF_SIZE != kbuf_tail;
+}
+
 static void send_keyboard(report_keyboard_t *report) {
     uint8_t next = (kbuf_head + 1) % KBUF_SIZE;
     if (next != kbuf_tail) {